@@ -1,7 +1,6 @@
 
 
 #include <avr/io.h>
-#include <avr/eeprom.h>
 #include <avr/pgmspace.h>
 #include <string.h>
 #include <util/delay.h>
@@ -11,35 +10,47 @@
 #include "usb_serial.h"
 #include "systemtime.h"
 #include "time.h"
+#include "syncservice.h"
 #include "rtc.h"
 #include "gps.h"
+#include "pps.h"
+#include "uart.h"
 #include "timezone.h"
+#include "tzdb.h"
+#include "display.h"
+#include "config.h"
 
 #include "cmdlineinterface.h"
 
-uint8_t EEMEM eeCmdlineOwner[12] = "Janis";
-uint8_t cmdlineOwner[12];
-
 void cmdlineInterfaceInit(void)
 {
 	cmdlineInit();
 	cmdlineSetOutputFunc(usb_serial_putchar);
 
-	eeprom_read_block(cmdlineOwner, eeCmdlineOwner, sizeof(cmdlineOwner));
-
 	cmdlineAddCommand("exit", exitFunction);
 	cmdlineAddCommand("help", helpFunction);
 
 	cmdlineAddCommand("settime", setTimeFunction);
 	cmdlineAddCommand("setdst", setDstFunction);
 	cmdlineAddCommand("setstd", setStdFunction);
+	cmdlineAddCommand("settz", setTzFunction);
+	cmdlineAddCommand("showtz", showTzFunction);
 	cmdlineAddCommand("setowner", setOwnerFunction);
+	cmdlineAddCommand("setsync", setSyncFunction);
+	cmdlineAddCommand("config", configInfo);
 
 	cmdlineAddCommand("rtc", rtcTime);
 	cmdlineAddCommand("gps", gpsTime);
 	cmdlineAddCommand("sys", systemTime);
 	cmdlineAddCommand("local", localTime);
 	cmdlineAddCommand("millis", milliview);
+	cmdlineAddCommand("nmeastat", nmeaStatistics);
+	cmdlineAddCommand("gpscfg", gpsConfigStatus);
+	cmdlineAddCommand("pps", ppsStatus);
+	cmdlineAddCommand("gpsprof", gpsProfile);
+	cmdlineAddCommand("uartstat", uartStatistics);
+	cmdlineAddCommand("stall", stallStatistics);
+	cmdlineAddCommand("sync", syncStatus);
 	
 }
 
@@ -70,7 +81,7 @@ void cmdlineInterfaceProcess(void)
 				// "AT command", which can still be buffered.
 				usb_serial_flush_input();
 				rprintf("Hey ");
-				rprintfStr(cmdlineOwner);
+				rprintfStr(configGet()->owner);
 				rprintf(", my current RTC time is:\r\n");
 				time_t t = rtcGetTime();
 				printTime(t);
@@ -108,12 +119,16 @@ void exitFunction(void)
 void helpFunction(void)
 {
 	rprintfProgStrM("\r\nSet the time (utc):\r\n");
-	rprintfProgStrM(" settime - yyyy mm dd hh mm ss\r\n\r\n");
+	rprintfProgStrM(" settime - yyyy mm dd hh mm ss [ms]\r\n\r\n");
 
 	rprintfProgStrM("Set the DST rule:\r\n");
 	rprintfProgStrM(" setdst - offset hour dow week month\r\n");
 	rprintfProgStrM("Set the STD rule:\r\n");
-	rprintfProgStrM(" setstd - offset hour dow week month\r\n\r\n");
+	rprintfProgStrM(" setstd - offset hour dow week month\r\n");
+	rprintfProgStrM("Select a zone (list without name):\r\n");
+	rprintfProgStrM(" settz - [zone]\r\n");
+	rprintfProgStrM("Zones the display rotates through:\r\n");
+	rprintfProgStrM(" showtz - [seconds zone ...]\r\n\r\n");
 	rprintfProgStrM(" DST example:\r\n");
 	rprintfProgStrM(" 120\t- offset in minutes\r\n");
 	rprintfProgStrM(" 2\t- hour of day\r\n");
@@ -124,11 +139,38 @@ void helpFunction(void)
 	rprintfProgStrM("Set the clock owner:\r\n");
 	rprintfProgStrM(" setowner - name\r\n\r\n");
 
+	rprintfProgStrM("Set the seconds between syncs:\r\n");
+	rprintfProgStrM(" setsync - seconds\r\n\r\n");
+
+	rprintfProgStrM("Get the stored configuration (or restore the defaults):\r\n");
+	rprintfProgStrM(" config [defaults]\r\n\r\n");
+
 	//rprintfProgStrM("Get milliseconds of system uptime:\r\n");
 	//rprintfProgStrM(" millis\r\n\r\n");
 
 	rprintfProgStrM("Get various times:\r\n");
 	rprintfProgStrM(" sys, rtc, gps, local\r\n\r\n");
+
+	rprintfProgStrM("Get NMEA sentence counters:\r\n");
+	rprintfProgStrM(" nmeastat\r\n\r\n");
+
+	rprintfProgStrM("Get GPS baud rate, receiver configuration and load:\r\n");
+	rprintfProgStrM(" gpscfg\r\n\r\n");
+
+	rprintfProgStrM("Get PPS lock and phase:\r\n");
+	rprintfProgStrM(" pps\r\n\r\n");
+
+	rprintfProgStrM("Get (or reset) GPS parser run time:\r\n");
+	rprintfProgStrM(" gpsprof [reset]\r\n\r\n");
+
+	rprintfProgStrM("Get (or reset) GPS UART counters:\r\n");
+	rprintfProgStrM(" uartstat [reset]\r\n\r\n");
+
+	rprintfProgStrM("Get (or reset) the longest main loop stall:\r\n");
+	rprintfProgStrM(" stall [reset]\r\n\r\n");
+
+	rprintfProgStrM("Get the time sources, the selected one and the sync history:\r\n");
+	rprintfProgStrM(" sync\r\n\r\n");
 }
 
 void setTimeFunction(void)
@@ -148,7 +190,9 @@ void setTimeFunction(void)
 	el.Hour = cmdlineGetArgInt(4);
 	el.Minute = cmdlineGetArgInt(5);
 	el.Second = cmdlineGetArgInt(6);
-	rtcSetTime(timeMake(el));
+	// optional milliseconds into that second, 0 if left out
+	timeSetTimePrecise(timeMake(el), cmdlineGetArgInt(7));
+	rtcSetTime(timeNow());
 
 	rtcTime();
 }
@@ -196,6 +240,95 @@ void setStdFunction(void)
 	getStdFunction();
 }
 
+/*
+Select a zone of the compiled tz database via cmdline, e.g.
+
+	settz Europe/Berlin
+
+Without a zone name the available zones are listed. The DST and standard
+time rules are taken from the zone and saved in the EEPROM, setdst and
+setstd replace them again.
+*/
+void setTzFunction(void)
+{
+	char* name = (char*)cmdlineGetArgStr(1);
+	uint8_t zone;
+
+	rprintfCRLF();
+	if(*name)
+	{
+		if(!timezoneSetZone(name))
+		{
+			rprintfProgStrM("Unknown zone, settz lists them\r\n");
+			return;
+		}
+		getDstFunction();
+		getStdFunction();
+		return;
+	}
+
+	rprintfProgStrM("Zones (tzdata " TZDB_VERSION "):\r\n");
+	for(zone=0; zone<TZDB_ZONES; zone++)
+	{
+		rprintfProgStrM(zone == timezoneGetZone() ? " * " : "   ");
+		rprintfProgStr(timezoneGetZoneName(zone));
+		rprintfCRLF();
+	}
+}
+
+/*
+Zones the display rotates through via cmdline, e.g.
+
+	showtz 5 America/New_York Asia/Tokyo
+
+shows the zone selected with settz and the given zones for 5 seconds each.
+The dots tell them apart: all dots for the selected zone, then only the
+upper, only the lower and no dots. 0 seconds or no zones show only the
+selected zone, without arguments the list is printed.
+
+List and seconds are saved in the EEPROM
+*/
+void showTzFunction(void)
+{
+	char name[TIMEZONE_NAME_LENGTH];
+	char* arg = (char*)cmdlineGetArgStr(1);
+	uint8_t position;
+	uint8_t zone;
+	uint8_t i;
+
+	rprintfCRLF();
+	if(*arg)
+	{
+		displaySetRotate(cmdlineGetArgInt(1));
+		timezoneListClear();
+		for(position=2; *(arg = (char*)cmdlineGetArgStr(position)); position++)
+		{
+			// the arguments are only separated by spaces
+			for(i=0; arg[i] && arg[i] != ' ' && i < sizeof(name)-1; i++)
+				name[i] = arg[i];
+			name[i] = 0;
+			if(!timezoneListAdd(name))
+			{
+				rprintfProgStrM("Skipped ");
+				rprintfStr(name);
+				rprintfCRLF();
+			}
+		}
+	}
+
+	rprintf("Rotate: %d s\r\n", displayGetRotate());
+	for(position=0; position<timezoneListGetLength(); position++)
+	{
+		zone = timezoneListGetZone(position);
+		rprintf(" %d: ", position);
+		if(zone == TIMEZONE_CUSTOM)
+			rprintfProgStrM("setdst/setstd rules");
+		else
+			rprintfProgStr(timezoneGetZoneName(zone));
+		rprintf(", offset: %d\r\n", timezoneListGetOffset(position, timeNow()));
+	}
+}
+
 void getDstFunction(void)
 {
 	timeChangeRule_t r = timezoneGetDst();
@@ -224,22 +357,53 @@ void getStdFunction(void)
 
 void setOwnerFunction(void)
 {
-	strcpy(cmdlineOwner, cmdlineGetArgStr(1));
-	eeprom_write_block(cmdlineOwner, eeCmdlineOwner, sizeof(cmdlineOwner));
+	char* owner = configGet()->owner;
+
+	// only written if the name changed
+	strncpy(owner, (char*)cmdlineGetArgStr(1), CONFIG_OWNER_LENGTH-1);
+	owner[CONFIG_OWNER_LENGTH-1] = 0;
+	configChanged();
 
 	rprintfCRLF();
 	rprintfProgStrM("Hello ");
-	rprintfStr(cmdlineOwner);
+	rprintfStr(owner);
 	rprintfProgStrM(", \n\rhave fun with your new clock! :)\n\rJanis\n\r\n\r");
 }
 
+/*
+Set the sync interval via cmdline, e.g.
+
+	setsync 30
+
+compares the time sources and syncs the clock every 30 seconds.
+
+Saved in the configuration
+*/
+void setSyncFunction(void)
+{
+	configData_t* config = configGet();
+
+	if(cmdlineGetArgInt(1) > 0)
+	{
+		config->syncServiceInterval = cmdlineGetArgInt(1);
+		configChanged();
+		timeSyncServiceSetInterval(config->syncServiceInterval);
+	}
+
+	rprintfCRLF();
+	rprintf("Sync every %d s\r\n", config->syncServiceInterval);
+}
+
 void systemTime(void)
 {
 	rprintfCRLF();
 	rprintf("SYS time (utc):\r\n");
 
-	time_t t = timeNow();
+	uint16_t millis;
+	time_t t = timeNowPrecise(&millis);
 	printTime(t);
+	rprintfNum(10, 3, FALSE, '0', (const long)millis);
+	rprintfProgStrM(" ms into the second\r\n");
 }
 
 void rtcTime(void)
@@ -298,3 +462,296 @@ void milliview(void)
 	rprintfNum(10, 9, FALSE, ' ', (const long)milli);
 	rprintfCRLF();
 }
+
+void nmeaStatistics(void)
+{
+	GpsInfoType* info = gpsGetInfo();
+
+	rprintfCRLF();
+	rprintf("NMEA sentences:\r\n");
+	rprintfProgStrM(" accepted:     ");
+	rprintfNum(10, 5, FALSE, ' ', (const long)info->NmeaStats.accepted);
+	rprintfCRLF();
+	rprintfProgStrM(" bad checksum: ");
+	rprintfNum(10, 5, FALSE, ' ', (const long)info->NmeaStats.badChecksum);
+	rprintfCRLF();
+	rprintfProgStrM(" truncated:    ");
+	rprintfNum(10, 5, FALSE, ' ', (const long)info->NmeaStats.truncated);
+	rprintfCRLF();
+	rprintfProgStrM(" overflowed:   ");
+	rprintfNum(10, 5, FALSE, ' ', (const long)info->NmeaStats.overflowed);
+	rprintfCRLF();
+	rprintfProgStrM(" ignored:      ");
+	rprintfNum(10, 5, FALSE, ' ', (const long)info->NmeaStats.ignored);
+	rprintfCRLF();
+}
+void gpsConfigStatus(void)
+{
+	GpsConfigType* config = gpsGetConfig();
+	GpsBaudType* baud = gpsGetBaud();
+
+	rprintfCRLF();
+	rprintfProgStrM("GPS baud rate: ");
+	rprintfNum(10, 6, FALSE, ' ', (const long)baud->rate);
+	if(baud->state == GPS_BAUD_LOCKED)
+		rprintfProgStrM(" (locked)\r\n");
+	else
+	{
+		rprintfProgStrM(" (searching, empty scans ");
+		rprintfNum(10, 3, FALSE, ' ', (const long)baud->scans);
+		rprintfProgStrM(")\r\n");
+	}
+	rprintfProgStrM("GPS output pruning: ");
+	if(config->state == GPS_CONFIG_DONE)
+		rprintfProgStrM("done");
+	else if(config->state == GPS_CONFIG_FAILED)
+		rprintfProgStrM("failed");
+	else
+		rprintfProgStrM("in progress");
+	rprintfProgStrM(" (retries ");
+	rprintfNum(10, 1, FALSE, ' ', (const long)config->retries);
+	rprintfProgStrM(")\r\n");
+	rprintfProgStrM(" before: ");
+	rprintfNum(10, 5, FALSE, ' ', (const long)config->bytesBefore);
+	rprintfProgStrM(" bytes/s ");
+	rprintfNum(10, 5, FALSE, ' ', (const long)config->overflowBefore);
+	rprintfProgStrM(" overflows\r\n");
+	rprintfProgStrM(" after:  ");
+	rprintfNum(10, 5, FALSE, ' ', (const long)config->bytesAfter);
+	rprintfProgStrM(" bytes/s ");
+	rprintfNum(10, 5, FALSE, ' ', (const long)config->overflowAfter);
+	rprintfProgStrM(" overflows\r\n");
+}
+
+void ppsStatus(void)
+{
+	PpsType pps;
+
+	ppsGetState(&pps);
+	rprintfCRLF();
+	rprintfProgStrM("PPS: ");
+	if(ppsIsLocked())
+		rprintfProgStrM("locked");
+	else
+		rprintfProgStrM("not locked");
+	rprintfProgStrM("\r\n edges:  ");
+	rprintfNum(10, 5, FALSE, ' ', (const long)pps.edges);
+	rprintfProgStrM("\r\n phase:  ");
+	rprintfNum(10, 5, TRUE, ' ', (const long)pps.phase);
+	rprintfProgStrM(" ticks\r\n drift:  ");
+	rprintfNum(10, 5, TRUE, ' ', (const long)pps.drift);
+	rprintfProgStrM(" ticks/s\r\n");
+}
+
+void gpsProfile(void)
+{
+	GpsProfileType* profile = gpsGetProfile();
+	uint32_t elapsed;
+
+	if(!strcmp_P((char*)cmdlineGetArgStr(1), PSTR("reset")))
+	{
+		gpsProfileReset();
+		return;
+	}
+
+	elapsed = (systemTimeGetMilliseconds() - profile->startMillis) / 1000;
+	if(!elapsed)
+		elapsed = 1;
+
+	rprintfCRLF();
+	rprintfProgStrM("GPS parser over ");
+	rprintfNum(10, 5, FALSE, ' ', (const long)elapsed);
+	rprintfProgStrM(" s:\r\n packets/s:    ");
+	rprintfNum(10, 5, FALSE, ' ', (const long)(profile->packets / elapsed));
+	rprintfProgStrM("\r\n calls:     ");
+	rprintfNum(10, 8, FALSE, ' ', (const long)profile->calls);
+	rprintfProgStrM("\r\n mean (us):    ");
+	rprintfNum(10, 5, FALSE, ' ', (const long)(profile->calls ? profile->busyTicks / profile->calls * (1000/SYSTEMTIME_TICKS_PER_MS) : 0));
+	rprintfProgStrM("\r\n max (us):  ");
+	rprintfNum(10, 8, FALSE, ' ', (const long)profile->maxTicks * (1000/SYSTEMTIME_TICKS_PER_MS));
+	rprintfProgStrM("\r\n overflows:    ");
+	rprintfNum(10, 5, FALSE, ' ', (const long)(uint16_t)(uartGetRxOverflow() - profile->startOverflow));
+	rprintfCRLF();
+}
+
+void uartStatistics(void)
+{
+	UartStatsType stats;
+
+	if(!strcmp_P((char*)cmdlineGetArgStr(1), PSTR("reset")))
+	{
+		uartResetStats();
+		return;
+	}
+
+	uartGetStats(&stats);
+	rprintfCRLF();
+	rprintfProgStrM("GPS UART receive:\r\n bytes:        ");
+	rprintfNum(10, 10, FALSE, ' ', (const long)stats.rxBytes);
+	rprintfProgStrM("\r\n overflow:     ");
+	rprintfNum(10, 10, FALSE, ' ', (const long)stats.rxOverflow);
+	rprintfProgStrM("\r\n overrun:      ");
+	rprintfNum(10, 10, FALSE, ' ', (const long)stats.rxOverrun);
+	rprintfProgStrM("\r\n framing:      ");
+	rprintfNum(10, 10, FALSE, ' ', (const long)stats.rxFrameError);
+	rprintfProgStrM("\r\n parity:       ");
+	rprintfNum(10, 10, FALSE, ' ', (const long)stats.rxParityError);
+	rprintfProgStrM("\r\n peak:         ");
+	rprintfNum(10, 10, FALSE, ' ', (const long)stats.rxPeak);
+	rprintfProgStrM(" of ");
+	rprintfNum(10, 3, FALSE, ' ', (const long)UART_RX_BUFFER_SIZE);
+	rprintfProgStrM("\r\nGPS UART transmit:\r\n bytes:        ");
+	rprintfNum(10, 10, FALSE, ' ', (const long)stats.txBytes);
+	rprintfProgStrM("\r\n overflow:     ");
+	rprintfNum(10, 10, FALSE, ' ', (const long)stats.txOverflow);
+	rprintfProgStrM("\r\n peak:         ");
+	rprintfNum(10, 10, FALSE, ' ', (const long)stats.txPeak);
+	rprintfProgStrM(" of ");
+	rprintfNum(10, 3, FALSE, ' ', (const long)UART_TX_BUFFER_SIZE);
+	rprintfCRLF();
+}
+
+void configInfo(void)
+{
+	configStatus_t* status = configGetStatus();
+	configData_t* config = configGet();
+
+	if(!strcmp_P((char*)cmdlineGetArgStr(1), PSTR("defaults")))
+	{
+		configSetDefaults();
+		timezoneInit();
+		timeSyncServiceSetInterval(config->syncServiceInterval);
+	}
+
+	rprintfCRLF();
+	rprintfProgStrM("Configuration version: ");
+	rprintfNum(10, 3, FALSE, ' ', (const long)CONFIG_VERSION);
+	rprintfCRLF();
+	if(status->slot < CONFIG_SLOTS)
+	{
+		rprintfProgStrM("Loaded from slot:      ");
+		rprintfNum(10, 3, FALSE, ' ', (const long)status->slot);
+		rprintfProgStrM(", sequence ");
+		rprintfNum(10, 5, FALSE, ' ', (const long)status->sequence);
+		rprintfCRLF();
+	}
+	else
+	{
+		rprintfProgStrM("Defaults, nothing stored yet\r\n");
+	}
+	rprintfProgStrM("Bad slots at start:    ");
+	rprintfNum(10, 3, FALSE, ' ', (const long)status->badSlots);
+	rprintfCRLF();
+	rprintfProgStrM("Records written:       ");
+	rprintfNum(10, 5, FALSE, ' ', (const long)status->writes);
+	rprintfCRLF();
+	rprintfProgStrM("Unchanged, not written:");
+	rprintfNum(10, 5, FALSE, ' ', (const long)status->skipped);
+	rprintfCRLF();
+	if(status->state != CONFIG_IDLE)
+		rprintfProgStrM("Changes not written yet\r\n");
+}
+
+void syncStatus(void)
+{
+	syncState_t* state = timeSyncServiceGetState();
+	syncSource_t* source;
+	syncTransition_t* entry;
+	uint16_t n;
+	uint8_t i;
+
+	rprintfCRLF();
+	rprintfProgStrM("Sync: ");
+	printSyncState(state->state);
+	rprintfProgStrM(", source ");
+	printSyncSource(state->source);
+	rprintfProgStrM(", uncertainty ");
+	rprintfNum(10, 7, FALSE, ' ', (const long)(state->uncertainty / 1000));
+	rprintfProgStrM(" ms\r\n");
+
+	rprintfProgStrM("Source  status  dispersion   offset ms  age s  reach  selected  rejected\r\n");
+	for(i=0; i<timeSyncServiceGetSources(); i++)
+	{
+		source = timeSyncServiceGetSource(i);
+		printSyncSource(i);
+		switch(source->status)
+		{
+		case SYNC_SOURCE_CANDIDATE:	rprintfProgStrM("    ok      "); break;
+		case SYNC_SOURCE_SELECTED:	rprintfProgStrM("    used    "); break;
+		case SYNC_SOURCE_OUTLIER:	rprintfProgStrM("    outlier "); break;
+		default:					rprintfProgStrM("    none    "); break;
+		}
+		rprintfNum(10, 5, FALSE, ' ', (const long)source->dispersion);
+		rprintfProgStrM("  ");
+		rprintfNum(10, 11, TRUE, ' ', (const long)source->offset);
+		rprintfProgStrM("  ");
+		if(source->reach || source->lastMillis)
+			rprintfNum(10, 5, FALSE, ' ', (const long)((systemTimeGetMilliseconds() - source->lastMillis) / 1000));
+		else
+			rprintfProgStrM("    -");
+		rprintfProgStrM("     ");
+		rprintfNum(16, 2, FALSE, '0', (const long)source->reach);
+		rprintfProgStrM("     ");
+		rprintfNum(10, 5, FALSE, ' ', (const long)source->selected);
+		rprintfProgStrM("     ");
+		rprintfNum(10, 5, FALSE, ' ', (const long)source->rejected);
+		rprintfCRLF();
+	}
+
+	// oldest transition first
+	rprintfProgStrM("Transitions: ");
+	rprintfNum(10, 5, FALSE, ' ', (const long)state->transitions);
+	rprintfCRLF();
+	n = (state->transitions > SYNCSERVICE_LOG) ? state->transitions - SYNCSERVICE_LOG : 0;
+	for(; n<state->transitions; n++)
+	{
+		entry = &state->log[n % SYNCSERVICE_LOG];
+		rprintfProgStrM(" ");
+		printSyncState(entry->from);
+		rprintfProgStrM(" -> ");
+		printSyncState(entry->to);
+		rprintfProgStrM(" (");
+		printSyncSource(entry->source);
+		rprintfProgStrM(") at ");
+		printTime(entry->time);
+	}
+}
+
+void printSyncState(uint8_t state)
+{
+	switch(state)
+	{
+	case SYNC_UNSYNCED:	rprintfProgStrM("unsynced"); break;
+	case SYNC_LOCKED:	rprintfProgStrM("locked"); break;
+	case SYNC_HOLDOVER:	rprintfProgStrM("holdover"); break;
+	default:			rprintfProgStrM("lost"); break;
+	}
+}
+
+void printSyncSource(uint8_t index)
+{
+	if(index < timeSyncServiceGetSources())
+		rprintfProgStr(timeSyncServiceGetSource(index)->name);
+	else
+		rprintfProgStrM("none");
+}
+
+void stallStatistics(void)
+{
+	timeStall_t* stall = timeGetStall();
+
+	if(!strcmp_P((char*)cmdlineGetArgStr(1), PSTR("reset")))
+	{
+		timeResetStall();
+		return;
+	}
+
+	rprintfCRLF();
+	rprintfProgStrM("Longest gap between clock updates: ");
+	rprintfNum(10, 7, FALSE, ' ', (const long)stall->maxGap);
+	rprintfProgStrM(" ms, ended at\r\n");
+	printTime(stall->maxGapTime);
+	rprintfProgStrM("Gaps of a second or more: ");
+	rprintfNum(10, 5, FALSE, ' ', (const long)stall->longGaps);
+	rprintfCRLF();
+}
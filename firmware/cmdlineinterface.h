@@ -10,9 +10,12 @@ void helpFunction(void);
 void setTimeFunction(void);
 void setDstFunction(void);
 void setStdFunction(void);
+void setTzFunction(void);
+void showTzFunction(void);
 void getDstFunction(void);
 void getStdFunction(void);
 void setOwnerFunction(void);
+void setSyncFunction(void);
 void systemTime(void);
 void rtcTime(void);
 void gpsTime(void);
@@ -20,6 +23,16 @@ void localTime(void);
 void printTime(time_t t);
 void milliview(void);
 void gpsInfoPrint(void);
+void nmeaStatistics(void);
+void gpsConfigStatus(void);
+void ppsStatus(void);
+void gpsProfile(void);
+void uartStatistics(void);
+void configInfo(void);
+void stallStatistics(void);
+void syncStatus(void);
+void printSyncState(uint8_t state);
+void printSyncSource(uint8_t index);
 
 
 
@@ -0,0 +1,177 @@
+#include <avr/io.h>
+#include <avr/eeprom.h>
+#include <avr/pgmspace.h>
+#include <stddef.h>
+#include <util/crc16.h>
+#include "systemtime.h"
+#include "timezone.h"
+
+#include "config.h"
+
+// used for a blank or corrupted EEPROM
+const configData_t ConfigDefaults PROGMEM =
+{
+	{"MESZ", 120, 2, Sun, Last, Mar},	// Germany
+	{"MEZ", 60, 3, Sun, Last, Oct},
+	"Europe/Berlin",
+	{"", "", ""},
+	"Janis",
+	30,
+	0,
+	9600
+};
+
+configSlot_t EEMEM EEconfigSlots[CONFIG_SLOTS];
+
+configData_t configData;
+configStatus_t configStatus;
+
+void configInit(void)
+{
+	uint16_t sequence;
+	uint8_t slot;
+
+	configStatus.state = CONFIG_IDLE;
+	configStatus.slot = CONFIG_SLOTS;
+	configStatus.sequence = 0;
+	configStatus.badSlots = 0;
+	configStatus.writes = 0;
+	configStatus.skipped = 0;
+
+	for(slot=0; slot<CONFIG_SLOTS; slot++)
+	{
+		// erased cells read 0xFF, a slot cut short by a reset keeps
+		// the crc of its previous contents, both fail here
+		if(eeprom_read_byte(&EEconfigSlots[slot].version) != CONFIG_VERSION ||
+		   eeprom_read_word(&EEconfigSlots[slot].crc) != configSlotCrc(slot))
+		{
+			configStatus.badSlots++;
+			continue;
+		}
+		// the sequence wraps, newer is less than half the range ahead
+		sequence = eeprom_read_word(&EEconfigSlots[slot].sequence);
+		if(configStatus.slot == CONFIG_SLOTS || (int16_t)(sequence - configStatus.sequence) > 0)
+		{
+			configStatus.slot = slot;
+			configStatus.sequence = sequence;
+		}
+	}
+
+	if(configStatus.slot < CONFIG_SLOTS)
+		eeprom_read_block(&configData, &EEconfigSlots[configStatus.slot].data, sizeof(configData_t));
+	else
+		memcpy_P(&configData, &ConfigDefaults, sizeof(configData_t));
+}
+
+void configProcess(void)
+{
+	uint8_t* slot;
+	uint8_t c;
+
+	switch(configStatus.state)
+	{
+	case CONFIG_PENDING:
+		if((systemTimeGetMilliseconds() - configStatus.changedMillis) < CONFIG_WRITE_DELAY_MS)
+			break;
+		// changes that were taken back again cost no write
+		if(configStatus.slot < CONFIG_SLOTS && configSlotMatches(configStatus.slot))
+		{
+			configStatus.skipped++;
+			configStatus.state = CONFIG_IDLE;
+			break;
+		}
+		configStatus.index = 0;
+		configStatus.crc = 0xFFFF;
+		configStatus.state = CONFIG_WRITING;
+		// fall through
+	case CONFIG_WRITING:
+		// never wait for the EEPROM, a changed byte takes 3.4ms to
+		// program, unchanged ones are skipped by eeprom_update_byte()
+		slot = (uint8_t*)&EEconfigSlots[configNextSlot()];
+		while(eeprom_is_ready())
+		{
+			if(configStatus.index >= sizeof(configSlot_t))
+			{
+				// the crc went in last, the slot is valid now
+				configStatus.slot = configNextSlot();
+				configStatus.sequence++;
+				configStatus.writes++;
+				configStatus.state = CONFIG_IDLE;
+				break;
+			}
+			c = configSlotByte(configStatus.index);
+			if(configStatus.index < offsetof(configSlot_t, crc))
+				configStatus.crc = _crc_ccitt_update(configStatus.crc, c);
+			eeprom_update_byte(&slot[configStatus.index++], c);
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+configData_t* configGet(void)
+{
+	return &configData;
+}
+
+void configChanged(void)
+{
+	// a write in progress starts over, the slot it uses is not valid yet
+	configStatus.changedMillis = systemTimeGetMilliseconds();
+	configStatus.state = CONFIG_PENDING;
+}
+
+void configSetDefaults(void)
+{
+	memcpy_P(&configData, &ConfigDefaults, sizeof(configData_t));
+	configChanged();
+}
+
+configStatus_t* configGetStatus(void)
+{
+	return &configStatus;
+}
+
+uint16_t configSlotCrc(uint8_t slot)
+{
+	const uint8_t* p = (const uint8_t*)&EEconfigSlots[slot];
+	uint16_t crc = 0xFFFF;
+	uint16_t i;
+
+	for(i=0; i<offsetof(configSlot_t, crc); i++)
+		crc = _crc_ccitt_update(crc, eeprom_read_byte(p++));
+	return crc;
+}
+
+uint8_t configSlotMatches(uint8_t slot)
+{
+	const uint8_t* p = (const uint8_t*)&EEconfigSlots[slot].data;
+	const uint8_t* data = (const uint8_t*)&configData;
+	uint16_t i;
+
+	for(i=0; i<sizeof(configData_t); i++)
+	{
+		if(eeprom_read_byte(p++) != *data++)
+			return FALSE;
+	}
+	return TRUE;
+}
+
+// slot the next write goes to, never the one holding the record
+uint8_t configNextSlot(void)
+{
+	return (configStatus.slot+1 < CONFIG_SLOTS) ? configStatus.slot+1 : 0;
+}
+
+// byte of the slot image, little endian like the AVR
+uint8_t configSlotByte(uint16_t index)
+{
+	if(index < offsetof(configSlot_t, version))
+		return (configStatus.sequence+1) >> (8*index);
+	if(index < offsetof(configSlot_t, data))
+		return CONFIG_VERSION;
+	if(index < offsetof(configSlot_t, crc))
+		return ((uint8_t*)&configData)[index - offsetof(configSlot_t, data)];
+	return configStatus.crc >> (8*(index - offsetof(configSlot_t, crc)));
+}
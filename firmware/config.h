@@ -0,0 +1,63 @@
+#ifndef CONFIG_H
+#define CONFIG_H
+
+#include "global.h"
+#include "timezone.h"
+
+#define CONFIG_VERSION			2		// change with the layout of configData_t
+#define CONFIG_SLOTS			4		// EEPROM copies the record rotates over
+#define CONFIG_WRITE_DELAY_MS	3000	// changes within this time are written together
+#define CONFIG_OWNER_LENGTH		12		// owner name with the NUL
+
+// Write states
+#define CONFIG_IDLE				0		// the EEPROM holds the record
+#define CONFIG_PENDING			1		// changed, waiting for CONFIG_WRITE_DELAY_MS
+#define CONFIG_WRITING			2		// copying the record to the next slot
+
+// Settings kept over a reset, loaded once and changed in RAM
+typedef struct
+{
+	timeChangeRule_t dst;						// rules of the timezone lib
+	timeChangeRule_t std;
+	char zone[TIMEZONE_NAME_LENGTH];			// selected tz database zone, empty for the rules
+	char list[TIMEZONE_LIST_LENGTH-1][TIMEZONE_NAME_LENGTH];	// further zones, empty if unused
+	char owner[CONFIG_OWNER_LENGTH];			// greeted on the cmdline
+	uint16_t syncServiceInterval;				// seconds between sync service runs
+	uint8_t displayRotate;						// seconds per zone on the display, 0 for one zone
+	uint32_t gpsBaudRate;						// rate the receiver was last found at
+} configData_t;
+
+// EEPROM slot, the one with the highest valid sequence is loaded
+typedef struct
+{
+	uint16_t sequence;		// incremented with every write
+	uint8_t version;		// CONFIG_VERSION
+	configData_t data;
+	uint16_t crc;			// CRC-CCITT of all bytes before, written last
+} configSlot_t;
+
+typedef struct
+{
+	uint8_t state;				// CONFIG_IDLE, CONFIG_PENDING or CONFIG_WRITING
+	uint8_t slot;				// slot holding the record, CONFIG_SLOTS for the defaults
+	uint16_t sequence;			// sequence of that slot
+	uint8_t badSlots;			// slots that failed the check at start-up
+	uint16_t writes;			// records written since start-up
+	uint16_t skipped;			// changes that left the record as stored
+	uint32_t changedMillis;		// system time of the last change
+	uint16_t index;				// next byte of the slot being written
+	uint16_t crc;				// crc of the slot being written
+} configStatus_t;
+
+void configInit(void);
+void configProcess(void);
+configData_t* configGet(void);
+void configChanged(void);
+void configSetDefaults(void);
+configStatus_t* configGetStatus(void);
+uint16_t configSlotCrc(uint8_t slot);
+uint8_t configSlotMatches(uint8_t slot);
+uint8_t configNextSlot(void);
+uint8_t configSlotByte(uint16_t index);
+
+#endif
@@ -1,6 +1,8 @@
 #include <avr/io.h>
 #include <avr/pgmspace.h>
 #include "time.h"
+#include "timezone.h"
+#include "config.h"
 #include "spi.h"
 
 #include "display.h"
@@ -107,6 +109,15 @@ typedef struct
 // global cache for actual displayed value
 display_t display;
 
+// dots per list position: all, the upper, the lower, none
+const uint8_t displayZoneDots[TIMEZONE_LIST_LENGTH] PROGMEM =
+{
+	DISPLAY_DOT_BR | DISPLAY_DOT_UR | DISPLAY_DOT_BL | DISPLAY_DOT_UL,
+	DISPLAY_DOT_UR | DISPLAY_DOT_UL,
+	DISPLAY_DOT_BR | DISPLAY_DOT_BL,
+	0
+};
+
 
 void displayInit(void)
 {
@@ -132,19 +143,60 @@ void displayTime(time_t time)
 {
 	tmElements_t el;
 	timeBreak(time, &el);
+	displayElements(&el);
+}
 
+void displayClock(time_t utc)
+{
+	tmElements_t el;
+	uint8_t rotate = configGet()->displayRotate;
+	uint8_t zones = timezoneListGetLength();
+	uint8_t position = 0;
+
+	// seconds each zone of the timezone list is shown, 0 shows only the selected zone
+	if(rotate && zones > 1)
+		position = (utc / rotate) % zones;
+
+	// the zones share the breakdown of utc, each only moves it by its offset
+	timeGetElements(utc, &el);
+	timeShift(&el, timezoneListGetOffset(position, utc));
+	displaySetDots(pgm_read_byte(&displayZoneDots[position]));
+	displayElements(&el);
+}
+
+void displayElements(tmElements_t* el)
+{
 	display_t *pdisplay = &display;
 
-	pdisplay->digits[5] = el.Second % 10;
-	pdisplay->digits[4] = el.Second / 10;
-	pdisplay->digits[3] = el.Minute % 10;
-	pdisplay->digits[2] = el.Minute / 10;
-	pdisplay->digits[1] = el.Hour % 10;
-	pdisplay->digits[0] = el.Hour / 10;
+	pdisplay->digits[5] = el->Second % 10;
+	pdisplay->digits[4] = el->Second / 10;
+	pdisplay->digits[3] = el->Minute % 10;
+	pdisplay->digits[2] = el->Minute / 10;
+	pdisplay->digits[1] = el->Hour % 10;
+	pdisplay->digits[0] = el->Hour / 10;
 
 	displayShow();
 }
 
+void displaySetDots(uint8_t dots)
+{
+	display.dotBR = (dots & DISPLAY_DOT_BR) != 0;
+	display.dotUR = (dots & DISPLAY_DOT_UR) != 0;
+	display.dotBL = (dots & DISPLAY_DOT_BL) != 0;
+	display.dotUL = (dots & DISPLAY_DOT_UL) != 0;
+}
+
+void displaySetRotate(uint8_t seconds)
+{
+	configGet()->displayRotate = seconds;
+	configChanged();
+}
+
+uint8_t displayGetRotate(void)
+{
+	return configGet()->displayRotate;
+}
+
 
 void displayShow()
 {
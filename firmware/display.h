@@ -2,9 +2,21 @@
 #define DISPLAY_H
 
 #include "global.h"
+#include "time.h"
+
+// separation dots for displaySetDots()
+#define DISPLAY_DOT_BR	0x01	// bottom right
+#define DISPLAY_DOT_UR	0x02	// upper right
+#define DISPLAY_DOT_BL	0x04	// bottom left
+#define DISPLAY_DOT_UL	0x08	// upper left
 
 void displayInit(void);
 void displayTime(time_t time);
+void displayClock(time_t utc);
+void displayElements(tmElements_t* el);
+void displaySetDots(uint8_t dots);
+void displaySetRotate(uint8_t seconds);
+uint8_t displayGetRotate(void);
 void displayShow();
 
 uint8_t displayHighVoltageRead();
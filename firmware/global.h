@@ -43,6 +43,11 @@
 // needs big rx buffer for nmea parsing
 #define UART_RX_BUFFER_SIZE		0x0080
 
+// the receive interrupt stamps the start of every message
+#ifdef GPS_UBX
+#define UART_RX_STAMP_CHAR		0xB5	// UBX_SYNC1
+#endif
+
 
 //#define NMEA_DEBUG_RMC 0
 
@@ -20,12 +20,18 @@
 //*****************************************************************************
 
 #include <avr/io.h>
+#include <avr/pgmspace.h>
 #include "global.h"
 #include "uart.h"
 #include "rprintf.h"
+#ifdef GPS_UBX
+#include "ubx.h"
+#else
 #include "nmea.h"
+#endif
 #include "systemtime.h"
 #include "time.h"
+#include "config.h"
 
 #include "gps.h"
 
@@ -34,15 +40,59 @@
 #define TRS_3V3_EN_ON		(PORTB |= (1<<6))
 #define TRS_3V3_EN_OFF		(PORTB &= ~(1<<6))
 
+// Program ROM constants
+
+// Rates tried by the autobaud stage, the common receiver defaults first
+const uint32_t GpsBaudRates[GPS_BAUD_RATES] PROGMEM =
+{
+	9600, 38400, 115200, 57600, 19200, 4800
+};
+
+#ifndef GPS_UBX
+
+// Commands switching off every sentence nmea.c does not decode,
+// NUL separated, the list ends with an empty string
+#ifdef GPS_RECEIVER_MTK
+// GLL, RMC, VTG, GGA, GSA, GSV, 11 reserved, ZDA, MCHN: keep RMC and GGA
+const char GpsConfigCommands[] PROGMEM = "PMTK314,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0\0";
+const char GpsConfigBaudCommand[] PROGMEM = "PMTK251,";
+const char GpsConfigBaudSuffix[] PROGMEM = "";
+#else
+// rates for DDC, UART1, UART2, USB, SPI, reserved: keep RMC and GGA
+const char GpsConfigCommands[] PROGMEM =
+	"PUBX,40,GLL,0,0,0,0,0,0\0"
+	"PUBX,40,GSA,0,0,0,0,0,0\0"
+	"PUBX,40,GSV,0,0,0,0,0,0\0"
+	"PUBX,40,VTG,0,0,0,0,0,0\0";
+// port 1, UBX+NMEA in, NMEA out, baud rate, no autobauding
+const char GpsConfigBaudCommand[] PROGMEM = "PUBX,41,1,0003,0002,";
+const char GpsConfigBaudSuffix[] PROGMEM = ",0";
+#endif
+#endif
+
 // Global variables
 GpsInfoType GpsInfo;
+GpsConfigType GpsConfig;
+GpsBaudType GpsBaud;
+GpsProfileType GpsProfile;
+uint8_t GpsSendChecksum;
 
 // Functions
 void gpsInit(void)
 {
 	uartInit();
-	uartSetBaudRate(9600);
+#ifdef GPS_UBX
+	ubxInit();
+	// the UBX configuration already limits the output
+	GpsConfig.state = GPS_CONFIG_DONE;
+#else
+	nmeaInit();
+	GpsConfig.state = GPS_CONFIG_WAIT;
+	GpsConfig.retries = 0;
+#endif
 	GpsInfo.validTimeReceivedMillis = 0;
+	gpsProfileReset();
+	gpsBaudInit();
 
 	TRS_3V3_EN_CONFIG;
 	TRS_3V3_EN_OFF;
@@ -55,27 +105,388 @@ GpsInfoType* gpsGetInfo(void)
 	return &GpsInfo;
 }
 
+GpsConfigType* gpsGetConfig(void)
+{
+	return &GpsConfig;
+}
+
+GpsBaudType* gpsGetBaud(void)
+{
+	return &GpsBaud;
+}
+
+GpsProfileType* gpsGetProfile(void)
+{
+	return &GpsProfile;
+}
+
+void gpsProfileReset(void)
+{
+	GpsProfile.startMillis = systemTimeGetMilliseconds();
+	GpsProfile.calls = 0;
+	GpsProfile.busyTicks = 0;
+	GpsProfile.maxTicks = 0;
+	GpsProfile.packets = 0;
+	GpsProfile.startOverflow = uartGetRxOverflow();
+}
+
 void gpsProcess(void)
 {
-	nmeaProcess(uartGetRxBuffer());
+	uint32_t ticks = systemTimeGetTicks();
+	uint8_t packet;
+
+#ifdef GPS_UBX
+	packet = ubxProcess(uartGetRxBuffer());
+#else
+	packet = nmeaProcess(uartGetRxBuffer());
+#endif
+
+	// measure the parser only, on the target and with the real receiver load
+	ticks = systemTimeGetTicks() - ticks;
+	GpsProfile.calls++;
+	GpsProfile.busyTicks += ticks;
+	if(ticks > GpsProfile.maxTicks)
+		GpsProfile.maxTicks = ticks;
+	if(packet)
+		GpsProfile.packets++;
+
+	// the receiver must be understood before it can be configured
+	if(GpsBaud.state != GPS_BAUD_LOCKED)
+		gpsBaudProcess();
+#ifndef GPS_UBX
+	else if(GpsConfig.state < GPS_CONFIG_DONE)
+		gpsConfigProcess();
+#endif
+}
+
+void gpsBaudInit(void)
+{
+	uint32_t rate = configGet()->gpsBaudRate;
+	uint8_t i;
+
+	GpsBaud.index = 0;
+	GpsBaud.fast = FALSE;
+	GpsBaud.best = 0;
+	GpsBaud.bestScore = 0;
+	GpsBaud.scans = 0;
+	// try the rate that worked last time before scanning all of them
+	for(i=0; i<GPS_BAUD_RATES; i++)
+	{
+		if(pgm_read_dword(&GpsBaudRates[i]) == rate)
+		{
+			GpsBaud.index = i;
+			GpsBaud.fast = TRUE;
+		}
+	}
+	GpsBaud.state = GPS_BAUD_SWITCH;
+}
+
+void gpsBaudProcess(void)
+{
+	uint32_t elapsed = systemTimeGetMilliseconds() - GpsBaud.windowMillis;
+	uint16_t score;
+
+	switch(GpsBaud.state)
+	{
+	case GPS_BAUD_SWITCH:
+		// a poll sent at the previous rate must leave first
+		if(!uartTransmitIsIdle())
+			break;
+		gpsBaudSetRate(pgm_read_dword(&GpsBaudRates[GpsBaud.index]));
+		GpsBaud.windowMillis = systemTimeGetMilliseconds();
+		GpsBaud.state = GPS_BAUD_SETTLE;
+		break;
+	case GPS_BAUD_SETTLE:
+		// frames still buffered from the previous rate must not count
+		if(elapsed < GPS_BAUD_SETTLE_MS)
+			break;
+#ifdef GPS_UBX
+		// the UBX output may still be off, a poll is answered in UBX anyway
+		ubxPollPort();
+#endif
+		GpsBaud.windowMillis = systemTimeGetMilliseconds();
+		GpsBaud.windowAccepted = gpsBaudAccepted();
+		GpsBaud.state = GPS_BAUD_TRIAL;
+		break;
+	case GPS_BAUD_TRIAL:
+		if(elapsed < GPS_BAUD_WINDOW_MS)
+			break;
+		// garbage at a wrong rate practically never passes the checksum
+		score = gpsBaudAccepted() - GpsBaud.windowAccepted;
+		if(GpsBaud.fast)
+		{
+			// the saved rate still works, skip the scan
+			GpsBaud.fast = FALSE;
+			if(score)
+			{
+				gpsBaudLock();
+				break;
+			}
+			GpsBaud.index = 0;
+		}
+		else
+		{
+			if(score > GpsBaud.bestScore)
+			{
+				GpsBaud.best = GpsBaud.index;
+				GpsBaud.bestScore = score;
+			}
+			if(++GpsBaud.index >= GPS_BAUD_RATES)
+			{
+				if(GpsBaud.bestScore)
+				{
+					GpsBaud.index = GpsBaud.best;
+					gpsBaudLock();
+					break;
+				}
+				// nothing at any rate, the receiver may still be booting
+				GpsBaud.index = 0;
+				GpsBaud.scans++;
+			}
+		}
+		GpsBaud.state = GPS_BAUD_SWITCH;
+		break;
+	default:
+		break;
+	}
+}
+
+void gpsBaudLock(void)
+{
+	gpsBaudSetRate(pgm_read_dword(&GpsBaudRates[GpsBaud.index]));
+	// the next start skips the scan
+	gpsBaudSave();
+	GpsBaud.state = GPS_BAUD_LOCKED;
+}
+
+void gpsBaudSave(void)
+{
+	// only stored when it changed
+	if(configGet()->gpsBaudRate == GpsBaud.rate)
+		return;
+	configGet()->gpsBaudRate = GpsBaud.rate;
+	configChanged();
+}
+
+void gpsBaudSetRate(uint32_t rate)
+{
+	GpsBaud.rate = rate;
+	uartSetBaudRate(rate);
 }
 
+uint8_t gpsBaudIsLocked(void)
+{
+	return (GpsBaud.state == GPS_BAUD_LOCKED);
+}
+
+uint16_t gpsBaudAccepted(void)
+{
+#ifdef GPS_UBX
+	return GpsInfo.UbxStats.accepted;
+#else
+	return GpsInfo.NmeaStats.accepted;
+#endif
+}
+
+#ifndef GPS_UBX
+void gpsConfigProcess(void)
+{
+	uint32_t elapsed = systemTimeGetMilliseconds() - GpsConfig.windowMillis;
+	uint16_t ignored;
+	uint16_t accepted;
+
+	switch(GpsConfig.state)
+	{
+	case GPS_CONFIG_WAIT:
+		// the receiver needs some time to boot, start once it talks
+		if(GpsInfo.NmeaStats.bytes)
+		{
+			gpsConfigStartWindow();
+			GpsConfig.state = GPS_CONFIG_MEASURE;
+		}
+		break;
+	case GPS_CONFIG_MEASURE:
+		if(elapsed < GPS_CONFIG_WINDOW_MS)
+			break;
+		GpsConfig.bytesBefore = (GpsInfo.NmeaStats.bytes - GpsConfig.windowBytes)*1000/elapsed;
+		GpsConfig.overflowBefore = uartGetRxOverflow() - GpsConfig.windowOverflow;
+		GpsConfig.command = 0;
+		GpsConfig.state = GPS_CONFIG_SEND;
+		break;
+	case GPS_CONFIG_SEND:
+		// one command per pass, each one fills most of the transmit buffer
+		if(!uartTransmitIsIdle())
+			break;
+		if(gpsConfigSendCommand(GpsConfig.command))
+			GpsConfig.command++;
+		else
+			GpsConfig.state = GPS_CONFIG_BAUD;
+		break;
+	case GPS_CONFIG_BAUD:
+		// the receiver switches after the last command, so do we
+		if(!uartTransmitIsIdle())
+			break;
+#if GPS_CONFIG_BAUDRATE
+		gpsBaudSetRate(GPS_CONFIG_BAUDRATE);
+#endif
+		GpsConfig.windowMillis = systemTimeGetMilliseconds();
+		GpsConfig.state = GPS_CONFIG_SETTLE;
+		break;
+	case GPS_CONFIG_SETTLE:
+		// sentences already queued in the receiver still arrive
+		if(elapsed < GPS_CONFIG_SETTLE_MS)
+			break;
+		gpsConfigStartWindow();
+		GpsConfig.state = GPS_CONFIG_VERIFY;
+		break;
+	case GPS_CONFIG_VERIFY:
+		if(elapsed < GPS_CONFIG_WINDOW_MS)
+			break;
+		GpsConfig.bytesAfter = (GpsInfo.NmeaStats.bytes - GpsConfig.windowBytes)*1000/elapsed;
+		GpsConfig.overflowAfter = uartGetRxOverflow() - GpsConfig.windowOverflow;
+		ignored = GpsInfo.NmeaStats.ignored - GpsConfig.windowIgnored;
+		accepted = GpsInfo.NmeaStats.accepted - GpsConfig.windowAccepted;
+		// done when the fix still arrives and nothing else does
+		if(accepted && !ignored)
+		{
+#if GPS_CONFIG_BAUDRATE
+			// try the new rate first at the next start
+			gpsBaudSave();
+#endif
+			GpsConfig.state = GPS_CONFIG_DONE;
+			break;
+		}
+#if GPS_CONFIG_BAUDRATE
+		// the receiver may not have switched, talk to it at the rate it was found at
+		gpsBaudSetRate(pgm_read_dword(&GpsBaudRates[GpsBaud.index]));
+#endif
+		if(++GpsConfig.retries < GPS_CONFIG_RETRIES)
+		{
+			GpsConfig.command = 0;
+			GpsConfig.state = GPS_CONFIG_SEND;
+		}
+		else
+			GpsConfig.state = GPS_CONFIG_FAILED;
+		break;
+	default:
+		break;
+	}
+}
+
+void gpsConfigStartWindow(void)
+{
+	GpsConfig.windowMillis = systemTimeGetMilliseconds();
+	GpsConfig.windowBytes = GpsInfo.NmeaStats.bytes;
+	GpsConfig.windowIgnored = GpsInfo.NmeaStats.ignored;
+	GpsConfig.windowAccepted = GpsInfo.NmeaStats.accepted;
+	GpsConfig.windowOverflow = uartGetRxOverflow();
+}
+
+uint8_t gpsConfigSendCommand(uint8_t command)
+{
+	const char* str = GpsConfigCommands;
+
+	// skip to the requested command
+	while(command && pgm_read_byte(str))
+	{
+		str += strlen_P(str) + 1;
+		command--;
+	}
+
+	if(pgm_read_byte(str))
+	{
+		gpsSendNmeaStart();
+		gpsSendNmeaStr(str);
+		gpsSendNmeaEnd();
+		return TRUE;
+	}
+#if GPS_CONFIG_BAUDRATE
+	// the baud rate change follows the list
+	if(!command)
+	{
+		gpsSendNmeaStart();
+		gpsSendNmeaStr(GpsConfigBaudCommand);
+		gpsSendNmeaNum(GPS_CONFIG_BAUDRATE);
+		gpsSendNmeaStr(GpsConfigBaudSuffix);
+		gpsSendNmeaEnd();
+		return TRUE;
+	}
+#endif
+	return FALSE;
+}
+
+void gpsSendNmeaStart(void)
+{
+	uartAddToTxBuffer('$');
+	GpsSendChecksum = 0;
+}
+
+void gpsSendNmeaStr(const char* str)
+{
+	uint8_t c;
+
+	// string is stored in program memory
+	while((c = pgm_read_byte(str++)))
+	{
+		GpsSendChecksum ^= c;
+		uartAddToTxBuffer(c);
+	}
+}
+
+void gpsSendNmeaNum(uint32_t n)
+{
+	char digits[10];
+	uint8_t i = 0;
+
+	do
+	{
+		digits[i++] = '0' + n%10;
+		n /= 10;
+	} while(n);
+
+	while(i)
+	{
+		GpsSendChecksum ^= digits[--i];
+		uartAddToTxBuffer(digits[i]);
+	}
+}
+
+void gpsSendNmeaEnd(void)
+{
+	uint8_t hex;
+
+	uartAddToTxBuffer('*');
+	hex = GpsSendChecksum>>4;
+	uartAddToTxBuffer(hex < 10 ? '0'+hex : 'A'-10+hex);
+	hex = GpsSendChecksum & 0x0F;
+	uartAddToTxBuffer(hex < 10 ? '0'+hex : 'A'-10+hex);
+	uartAddToTxBuffer('\r');
+	uartAddToTxBuffer('\n');
+	uartSendTxBuffer();
+}
+#endif
+
 time_t gpsGetTime(void)
 {
-	if((systemTimeGetMilliseconds() - GpsInfo.validTimeReceivedMillis) > 2000 && (systemTimeGetMilliseconds > 2000))
+	uint32_t millis;
+	return gpsGetTimeAt(&millis);
+}
+
+time_t gpsGetTimeAt(uint32_t* millis)
+{
+	// the month stays zero until a sentence with a valid date arrived
+	if(GpsInfo.UtcTime.month == 0 || (systemTimeGetMilliseconds() - GpsInfo.validTimeReceivedMillis) > 2000)
 		return 0;
 
 	tmElements_t el;
-	uint32_t gpstime = (uint32_t)GpsInfo.PosLLA.TimeOfFix.f;
-	//rprintfNum(10, 6, FALSE, '0', (const long)gpstime);
-	el.Second = gpstime % 100;
-	el.Minute = (gpstime / 100) % 100;
-	el.Hour = (gpstime / 10000);
-	uint32_t gpsdate = GpsInfo.UtDate;
-	//rprintfNum(10, 6, FALSE, '0', (const long)gpsdate);
-	el.Year = (gpsdate % 100) + 30;
-	el.Month = (gpsdate / 100) % 100;
-	el.Day = (gpsdate / 10000);
+	el.Second = GpsInfo.UtcTime.second;
+	el.Minute = GpsInfo.UtcTime.minute;
+	el.Hour = GpsInfo.UtcTime.hour;
+	el.Year = y2kYearToTm(GpsInfo.UtcTime.year);
+	el.Month = GpsInfo.UtcTime.month;
+	el.Day = GpsInfo.UtcTime.day;
+	// system time the second started at, the sentence was sent later
+	*millis = GpsInfo.validTimeReceivedMillis - GpsInfo.UtcTime.millis - GPS_OUTPUT_DELAY_MS;
 	return timeMake(el);
 }
 
@@ -38,6 +38,92 @@
 #include "global.h"
 
 // constants/macros/typdefs
+
+// Receiver command set used to prune the NMEA output at startup,
+// define GPS_RECEIVER_MTK for MediaTek (PMTK), u-blox (PUBX) otherwise
+//#define GPS_RECEIVER_MTK
+
+// Time from the start of a UTC second until the first sentence about it
+// starts arriving, the receiver output latency, calibrate per receiver
+#ifndef GPS_OUTPUT_DELAY_MS
+#define GPS_OUTPUT_DELAY_MS		0
+#endif
+// Error of the second start derived from a sentence, the spread of the
+// output latency and the receive buffering
+#define GPS_DISPERSION_MS		100
+
+// Baud rate the receiver is switched to after pruning, 0 keeps the
+// rate found by the autobaud stage, must be one of GpsBaudRates
+#ifndef GPS_CONFIG_BAUDRATE
+#define GPS_CONFIG_BAUDRATE		0
+#endif
+
+#define GPS_BAUD_RATES			6		///< number of rates in GpsBaudRates
+#define GPS_BAUD_SETTLE_MS		100		///< time to parse what arrived at the previous rate
+#define GPS_BAUD_WINDOW_MS		1200	///< trial length, more than one output period at 1 Hz
+
+// Autobaud stages
+#define GPS_BAUD_SWITCH			0	// switching to the next rate
+#define GPS_BAUD_SETTLE			1	// parsing what arrived at the previous rate
+#define GPS_BAUD_TRIAL			2	// counting valid frames at the current rate
+#define GPS_BAUD_LOCKED			3	// rate found, the configuration may start
+
+#define GPS_CONFIG_WINDOW_MS	3000	///< length of the load measurement windows
+#define GPS_CONFIG_SETTLE_MS	1500	///< time the receiver gets to apply the commands
+#define GPS_CONFIG_RETRIES		3		///< attempts before giving up
+
+// Configuration stages
+#define GPS_CONFIG_WAIT			0	// waiting for the receiver to start talking
+#define GPS_CONFIG_MEASURE		1	// measuring the load of the default output
+#define GPS_CONFIG_SEND			2	// sending the pruning commands
+#define GPS_CONFIG_BAUD			3	// waiting for the commands to leave, switching the baud rate
+#define GPS_CONFIG_SETTLE		4	// giving the receiver time to apply the commands
+#define GPS_CONFIG_VERIFY		5	// checking that only decoded sentences arrive
+#define GPS_CONFIG_DONE			6	// receiver emits only what we decode
+#define GPS_CONFIG_FAILED		7	// receiver ignored the commands, default output
+
+//! Receiver configuration stage and the receive load around it
+typedef struct struct_GpsConfig
+{
+	uint8_t state;				///< configuration stage (GPS_CONFIG_*)
+	uint8_t retries;			///< attempts made so far
+	uint8_t command;			///< index of the next command to send
+	uint32_t windowMillis;		///< start of the current stage
+	uint32_t windowBytes;		///< received bytes at the start of the window
+	uint16_t windowIgnored;		///< ignored sentences at the start of the window
+	uint16_t windowAccepted;	///< accepted sentences at the start of the window
+	uint16_t windowOverflow;	///< uart overflows at the start of the window
+	uint16_t bytesBefore;		///< received bytes/s of the default output
+	uint16_t overflowBefore;	///< uart overflows during the window before
+	uint16_t bytesAfter;		///< received bytes/s after pruning
+	uint16_t overflowAfter;		///< uart overflows during the window after
+} GpsConfigType;
+
+//! Autobaud stage, finds the rate the receiver talks at
+typedef struct struct_GpsBaud
+{
+	uint8_t state;				///< autobaud stage (GPS_BAUD_*)
+	uint8_t index;				///< rate under trial, index into GpsBaudRates
+	uint8_t fast;				///< trying the rate saved in EEPROM before scanning
+	uint8_t best;				///< rate with the most valid frames so far
+	uint16_t bestScore;			///< valid frames received at the best rate
+	uint16_t scans;				///< complete scans without a single valid frame
+	uint32_t rate;				///< rate the uart runs at
+	uint32_t windowMillis;		///< start of the current stage
+	uint16_t windowAccepted;	///< valid frames at the start of the trial
+} GpsBaudType;
+
+//! Parser run time, measured around every parser call in gpsProcess()
+typedef struct struct_GpsProfile
+{
+	uint32_t startMillis;		///< system time the measurement started
+	uint32_t calls;				///< number of parser calls
+	uint32_t busyTicks;			///< timer ticks spent in the parser
+	uint32_t maxTicks;			///< longest single call in timer ticks
+	uint16_t packets;			///< packets reported by the parser
+	uint16_t startOverflow;		///< uart overflows when the measurement started
+} GpsProfileType;
+
 typedef union union_float_u32
 {
 	float f;
@@ -70,22 +156,78 @@ struct VelocityHS
 	uint16_t updates;
 };
 
+//! UTC time and date of the last valid fix, decoded digit by digit
+typedef struct struct_GpsTime
+{
+	uint8_t hour;
+	uint8_t minute;
+	uint8_t second;
+	uint16_t millis;
+	uint8_t day;
+	uint8_t month;
+	uint8_t year;		///< two digit year, offset from 2000
+} GpsTimeType;
+
+//! NMEA sentence counters, maintained by the parser in nmea.c
+struct NmeaStatistics
+{
+	uint16_t accepted;		///< sentences with a valid checksum
+	uint16_t badChecksum;	///< sentences dropped because of a checksum mismatch
+	uint16_t truncated;		///< sentences cut short or without checksum
+	uint16_t overflowed;	///< sentences longer than the packet buffer
+	uint16_t ignored;		///< sentences dropped after the header, nobody decodes them
+	uint32_t bytes;			///< bytes taken from the receive buffer
+};
+
+//! UBX message counters, maintained by the parser in ubx.c
+struct UbxStatistics
+{
+	uint16_t accepted;		///< messages with a valid checksum
+	uint16_t badChecksum;	///< messages dropped because of a checksum mismatch
+	uint16_t badLength;		///< messages dropped because of a length above UBX_MAXLENGTH
+	uint8_t configured;		///< receiver answered the configuration with navigation data
+};
+
 typedef struct struct_GpsInfo
 {
 	uint8_t numSVs;
-	uint32_t UtDate;
-	uint32_t validTimeReceivedMillis;
+	GpsTimeType UtcTime;
+	int32_t UtcNano;		///< fraction of the second in ns (UBX only)
+	uint32_t UtcAccuracy;	///< time accuracy estimate in ns (UBX only)
+	uint8_t UtcValid;		///< valid flags of the last time solution (UBX only)
+	uint32_t validTimeReceivedMillis;	///< system time the last valid time started arriving
 
 	struct PositionLLA PosLLA;
 	struct VelocityHS VelHS;
+	struct NmeaStatistics NmeaStats;
+	struct UbxStatistics UbxStats;
 } GpsInfoType;
 
 
 // functions
 void gpsInit(void);
 GpsInfoType* gpsGetInfo(void);
+GpsConfigType* gpsGetConfig(void);
+GpsBaudType* gpsGetBaud(void);
+GpsProfileType* gpsGetProfile(void);
+void gpsProfileReset(void);
 void gpsProcess(void);
+void gpsBaudInit(void);
+void gpsBaudProcess(void);
+void gpsBaudLock(void);
+void gpsBaudSave(void);
+void gpsBaudSetRate(uint32_t rate);
+uint8_t gpsBaudIsLocked(void);
+uint16_t gpsBaudAccepted(void);
+void gpsConfigProcess(void);
+void gpsConfigStartWindow(void);
+uint8_t gpsConfigSendCommand(uint8_t command);
+void gpsSendNmeaStart(void);
+void gpsSendNmeaStr(const char* str);
+void gpsSendNmeaNum(uint32_t n);
+void gpsSendNmeaEnd(void);
 time_t gpsGetTime(void);
+time_t gpsGetTimeAt(uint32_t* millis);
 
 void gpsPowerEnable(void);
 void gpsPowerDisable(void);
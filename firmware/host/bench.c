@@ -0,0 +1,190 @@
+//*****************************************************************************
+//
+// File Name	: 'bench.c'
+// Title		: Times the uart receive interrupt and the NMEA parser
+// Target MCU	: host (gcc)
+// Editor Tabs	: 4
+//
+// Built once against the firmware sources of an older revision and once
+// against the working tree, see make bench.  Only the functions every
+// revision has are used: uartInit(), nmeaInit(), the receive interrupt
+// and nmeaProcess() on the buffer of uartGetRxBuffer().  The log is fed
+// in bursts of BURST bytes, each burst is parsed before the next one.
+// The best of RUNS runs is reported, the slow calls as the 99th
+// percentile since the host preempts the longest ones.  With a sentence
+// type like RMC only those sentences are fed.  Host times rank two
+// versions of the same code, the gpsprof command measures the target.
+//
+//	bench <log> [rounds] [sentence]
+//
+//*****************************************************************************
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "global.h"
+#include "uart.h"
+#include "systemtime.h"
+#include "gps.h"
+#include "nmea.h"
+#include "host.h"
+
+// the older code names of the sentences
+#ifndef NMEA_RMC
+#define NMEA_RMC		NMEA_GPRMC
+#endif
+
+#define BURST			32		// bytes, leaves room for a sentence kept in the buffer
+#define RUNS			7
+#define BUCKET_NS		8		// call time histogram
+#define BUCKETS			8192
+
+GpsInfoType GpsInfo;
+
+static uint32_t histogram[BUCKETS];
+
+// the parsers stamp the sentences, every revision reads the milliseconds,
+// time.c starts the clock
+static uint32_t benchMillis;
+
+void systemTimeInit(void)
+{
+}
+
+uint32_t systemTimeGetMilliseconds(void)
+{
+	return benchMillis;
+}
+
+typedef struct
+{
+	uint64_t receive;		// ns in the receive interrupt
+	uint64_t parse;			// ns in nmeaProcess()
+	uint64_t slow;			// ns of the 99th percentile nmeaProcess() call
+	uint32_t bytes;
+	uint32_t packets;
+	uint32_t rmc;
+} benchResult;
+
+static void benchRun(const char* log, long size, uint16_t rounds, benchResult* result)
+{
+	uint64_t start;
+	uint64_t ns;
+	uint16_t round;
+	uint8_t packet;
+	uint32_t calls = 0;
+	uint32_t count = 0;
+	uint16_t i;
+	long sent;
+	long end;
+
+	memset(result, 0, sizeof(*result));
+	memset(histogram, 0, sizeof(histogram));
+	uartInit();
+	nmeaInit();
+	for(round=0; round<rounds; round++)
+	{
+		for(sent=0; sent<size; sent=end)
+		{
+			benchMillis++;
+			end = (sent + BURST < size) ? sent + BURST : size;
+			start = hostNanoseconds();
+			while(sent < end)
+				hostUartReceive(log[sent++]);
+			result->receive += hostNanoseconds() - start;
+
+			do
+			{
+				start = hostNanoseconds();
+				packet = nmeaProcess(uartGetRxBuffer());
+				ns = hostNanoseconds() - start;
+				result->parse += ns;
+				histogram[(ns/BUCKET_NS < BUCKETS) ? ns/BUCKET_NS : BUCKETS-1]++;
+				calls++;
+				if(packet != NMEA_NODATA)
+					result->packets++;
+				if(packet == NMEA_RMC)
+					result->rmc++;
+			} while(packet != NMEA_NODATA);
+		}
+	}
+	result->bytes = size * rounds;
+	for(i=0; i<BUCKETS && count < calls - calls/100; i++)
+		count += histogram[i];
+	result->slow = (uint64_t)i * BUCKET_NS;
+}
+
+// keeps the sentences of one type, returns the new size
+static long benchFilter(char* log, long size, const char* type)
+{
+	char* line = log;
+	char* next;
+	long kept = 0;
+
+	while(line < log + size)
+	{
+		next = memchr(line, '\n', log + size - line);
+		next = next ? next+1 : log + size;
+		if(next - line > 6 && strncmp(line+3, type, 3) == 0)
+		{
+			memmove(log + kept, line, next - line);
+			kept += next - line;
+		}
+		line = next;
+	}
+	return kept;
+}
+
+int main(int argc, char** argv)
+{
+	benchResult best;
+	benchResult result;
+	uint16_t rounds = 20;
+	uint8_t run;
+	char* log;
+	long size;
+	FILE* f;
+
+	if(argc < 2)
+	{
+		fprintf(stderr, "usage: %s <log> [rounds]\n", argv[0]);
+		return 2;
+	}
+	if(argc > 2)
+		rounds = strtoul(argv[2], 0, 10);
+	if(!(f = fopen(argv[1], "rb")))
+	{
+		perror(argv[1]);
+		return 2;
+	}
+	fseek(f, 0, SEEK_END);
+	size = ftell(f);
+	rewind(f);
+	log = malloc(size);
+	if(fread(log, 1, size, f) != size)
+		return 2;
+	fclose(f);
+	if(argc > 3)
+		size = benchFilter(log, size, argv[3]);
+
+	benchRun(log, size, rounds, &best);
+	for(run=1; run<RUNS; run++)
+	{
+		benchRun(log, size, rounds, &result);
+		if(result.receive < best.receive)
+			best.receive = result.receive;
+		if(result.parse < best.parse)
+			best.parse = result.parse;
+		if(result.slow < best.slow)
+			best.slow = result.slow;
+	}
+
+	printf(" decoded:      %lu packets, %lu RMC of %lu bytes\n", (unsigned long)best.packets,
+		(unsigned long)best.rmc, (unsigned long)best.bytes);
+	printf(" receive:      %.1f ns/byte (host)\n", (double)best.receive / best.bytes);
+	printf(" nmeaProcess:  %.1f ns/byte, %.0f ns/packet, 99%% of calls within %lu ns (host)\n",
+		(double)best.parse / best.bytes, best.packets ? (double)best.parse / best.packets : 0.0,
+		(unsigned long)best.slow);
+	free(log);
+	return 0;
+}
@@ -0,0 +1,111 @@
+//*****************************************************************************
+//
+// File Name	: 'benchtick.c'
+// Title		: Times the millisecond tick and the system time getters
+// Target MCU	: host (gcc)
+// Editor Tabs	: 4
+//
+// Built against systemtime.c of an older revision and of the working tree
+// like bench.c.  timer32u4.c has AVR assembly, the functions systemtime.c
+// calls are replaced here, the compare A handler dispatches through the
+// timerAttach() table like timer32u4.c unless timer32u4.h leaves it to
+// systemtime.c.  The host shows the cost of the dispatch and of the
+// critical sections only, latency and jitter of the interrupt on the
+// target depend on the registers it saves and on the code that runs with
+// interrupts disabled.
+//
+//	benchtick [calls]
+//
+//*****************************************************************************
+
+#include <stdlib.h>
+
+#include "global.h"
+#include "timer32u4.h"
+#include "systemtime.h"
+#include "host.h"
+
+#define RUNS			7
+
+typedef void (*voidFuncPtr)(void);
+volatile static voidFuncPtr benchTimerFunc[TIMER_NUM_INTERRUPTS];
+
+// timer32u4.c, only what systemtime.c uses
+void timer3Init(void) {}
+void timer3SetMode(uint8_t mode) {}
+void timer3SetOutputModeA(uint8_t mode) {}
+void timer3SetCompareValueA(uint16_t value) { OCR3A = value; }
+
+void timerAttach(uint8_t interruptNum, void (*userFunc)(void))
+{
+	benchTimerFunc[interruptNum] = userFunc;
+}
+
+#ifndef TIMER3_COMPA_HANDLER_EXTERNAL
+ISR(TIMER3_COMPA_vect)
+{
+	// if a user function is defined, execute it
+	if(benchTimerFunc[TIMER3OUTCOMPAREA_INT])
+		benchTimerFunc[TIMER3OUTCOMPAREA_INT]();
+}
+#endif
+
+// best ns per call of RUNS runs
+static double benchCalls(void (*function)(uint32_t), uint32_t calls)
+{
+	uint64_t best = 0;
+	uint64_t start;
+	uint64_t ns;
+	uint8_t run;
+
+	for(run=0; run<RUNS; run++)
+	{
+		start = hostNanoseconds();
+		function(calls);
+		ns = hostNanoseconds() - start;
+		if(run == 0 || ns < best)
+			best = ns;
+	}
+	return (double)best / calls;
+}
+
+static volatile uint32_t benchSink;
+
+static void benchTick(uint32_t calls)
+{
+	while(calls--)
+		hostTimer3CompareInterrupt();
+}
+
+static void benchMilliseconds(uint32_t calls)
+{
+	while(calls--)
+		benchSink = systemTimeGetMilliseconds();
+}
+
+#ifdef SYSTEMTIME_TICKS_PER_MS
+static void benchTicks(uint32_t calls)
+{
+	while(calls--)
+		benchSink = systemTimeGetTicks();
+}
+#endif
+
+int main(int argc, char** argv)
+{
+	uint32_t calls = 10000000;
+	uint32_t ms;
+
+	if(argc > 1)
+		calls = strtoul(argv[1], 0, 10);
+	systemTimeInit();
+
+	printf(" tick:         %.2f ns/interrupt (host)\n", benchCalls(benchTick, calls));
+	ms = systemTimeGetMilliseconds();
+	printf(" getters:      systemTimeGetMilliseconds() %.2f ns", benchCalls(benchMilliseconds, calls));
+#ifdef SYSTEMTIME_TICKS_PER_MS
+	printf(", systemTimeGetTicks() %.2f ns", benchCalls(benchTicks, calls));
+#endif
+	printf(" (host)\n");
+	return ms == (uint32_t)(RUNS*calls) ? 0 : 1;
+}
@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+"""Write a synthetic NMEA log for the replay harness (replay.c).
+
+The log is synthesized, not captured from a receiver.  It follows the
+default 1 Hz output of a u-blox receiver: RMC, VTG, GGA, GSA, three
+GSV and GLL per epoch, about 500 bytes per second.  A small share of
+the sentences gets a flipped bit, like a noisy line would.  The seed is
+fixed, so the log is the same on every run.
+
+    python3 host/data/nmealog.py [seconds] > nmea.log
+
+A log captured from a real receiver can be replayed the same way.
+"""
+
+import datetime
+import random
+import sys
+
+START = datetime.datetime(2024, 2, 29, 23, 58, 0)
+NOISE = 0.005           # share of sentences with a flipped bit
+
+
+def sentence(body):
+    checksum = 0
+    for c in body:
+        checksum ^= ord(c)
+    return "$%s*%02X\r\n" % (body, checksum)
+
+
+def epoch(rnd, t):
+    hms = t.strftime("%H%M%S") + ".00"
+    dmy = t.strftime("%d%m%y")
+    lat = "4807.%05d" % rnd.randrange(3000, 4000)
+    lon = "01131.%05d" % rnd.randrange(0, 1000)
+    sats = rnd.randrange(7, 12)
+    speed = "%.3f" % (rnd.random() * 0.2)
+    out = [
+        "GPRMC,%s,A,%s,N,%s,E,%s,,%s,,,A" % (hms, lat, lon, speed, dmy),
+        "GPVTG,,T,,M,%s,N,%.3f,K,A" % (speed, float(speed) * 1.852),
+        "GPGGA,%s,%s,N,%s,E,1,%02d,%.2f,%.1f,M,47.0,M,," % (hms, lat, lon, sats, 0.8 + rnd.random(), 500 + rnd.random() * 10),
+        "GPGSA,A,3,%s,%.2f,%.2f,%.2f" % (",".join("%02d" % s for s in range(1, 13)), 1.5, 0.9, 1.2),
+    ]
+    for i in range(3):
+        view = ",".join("%02d,%02d,%03d,%02d" % (4*i + s + 1, rnd.randrange(5, 90), rnd.randrange(360), rnd.randrange(20, 50))
+                        for s in range(4))
+        out.append("GPGSV,3,%d,12,%s" % (i + 1, view))
+    out.append("GPGLL,%s,N,%s,E,%s,A,A" % (lat, lon, hms))
+
+    text = ""
+    for body in out:
+        s = sentence(body)
+        if rnd.random() < NOISE:
+            i = rnd.randrange(1, len(s) - 5)
+            s = s[:i] + chr(ord(s[i]) ^ 0x02) + s[i + 1:]
+        text += s
+    return text
+
+
+def main():
+    seconds = int(sys.argv[1]) if len(sys.argv) > 1 else 600
+    rnd = random.Random(1)
+    for n in range(seconds):
+        sys.stdout.write(epoch(rnd, START + datetime.timedelta(seconds=n)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,4777 @@
+// tzref.h - reference offsets of the zones in tzdata/zones.txt,
+// generated by host/data/tzref.py with Python zoneinfo, do not edit
+
+#define TZREF_VERSION	"2025b"
+
+// zone, UTC second, minutes to add to UTC and daylight saving time
+// around every change of the offset and halfway between two changes
+static const tzref_t TzrefTimes[] =
+{
+	// America/Chicago
+	{"America/Chicago", 1262304000u, -360, 0},
+	{"America/Chicago", 1268553599u, -360, 0},
+	{"America/Chicago", 1268553600u, -300, 1},
+	{"America/Chicago", 1265428800u, -360, 0},
+	{"America/Chicago", 1289113199u, -300, 1},
+	{"America/Chicago", 1289113200u, -360, 0},
+	{"America/Chicago", 1278833400u, -300, 1},
+	{"America/Chicago", 1300003199u, -360, 0},
+	{"America/Chicago", 1300003200u, -300, 1},
+	{"America/Chicago", 1294558200u, -360, 0},
+	{"America/Chicago", 1320562799u, -300, 1},
+	{"America/Chicago", 1320562800u, -360, 0},
+	{"America/Chicago", 1310283000u, -300, 1},
+	{"America/Chicago", 1331452799u, -360, 0},
+	{"America/Chicago", 1331452800u, -300, 1},
+	{"America/Chicago", 1326007800u, -360, 0},
+	{"America/Chicago", 1352012399u, -300, 1},
+	{"America/Chicago", 1352012400u, -360, 0},
+	{"America/Chicago", 1341732600u, -300, 1},
+	{"America/Chicago", 1362902399u, -360, 0},
+	{"America/Chicago", 1362902400u, -300, 1},
+	{"America/Chicago", 1357457400u, -360, 0},
+	{"America/Chicago", 1383461999u, -300, 1},
+	{"America/Chicago", 1383462000u, -360, 0},
+	{"America/Chicago", 1373182200u, -300, 1},
+	{"America/Chicago", 1394351999u, -360, 0},
+	{"America/Chicago", 1394352000u, -300, 1},
+	{"America/Chicago", 1388907000u, -360, 0},
+	{"America/Chicago", 1414911599u, -300, 1},
+	{"America/Chicago", 1414911600u, -360, 0},
+	{"America/Chicago", 1404631800u, -300, 1},
+	{"America/Chicago", 1425801599u, -360, 0},
+	{"America/Chicago", 1425801600u, -300, 1},
+	{"America/Chicago", 1420356600u, -360, 0},
+	{"America/Chicago", 1446361199u, -300, 1},
+	{"America/Chicago", 1446361200u, -360, 0},
+	{"America/Chicago", 1436081400u, -300, 1},
+	{"America/Chicago", 1457855999u, -360, 0},
+	{"America/Chicago", 1457856000u, -300, 1},
+	{"America/Chicago", 1452108600u, -360, 0},
+	{"America/Chicago", 1478415599u, -300, 1},
+	{"America/Chicago", 1478415600u, -360, 0},
+	{"America/Chicago", 1468135800u, -300, 1},
+	{"America/Chicago", 1489305599u, -360, 0},
+	{"America/Chicago", 1489305600u, -300, 1},
+	{"America/Chicago", 1483860600u, -360, 0},
+	{"America/Chicago", 1509865199u, -300, 1},
+	{"America/Chicago", 1509865200u, -360, 0},
+	{"America/Chicago", 1499585400u, -300, 1},
+	{"America/Chicago", 1520755199u, -360, 0},
+	{"America/Chicago", 1520755200u, -300, 1},
+	{"America/Chicago", 1515310200u, -360, 0},
+	{"America/Chicago", 1541314799u, -300, 1},
+	{"America/Chicago", 1541314800u, -360, 0},
+	{"America/Chicago", 1531035000u, -300, 1},
+	{"America/Chicago", 1552204799u, -360, 0},
+	{"America/Chicago", 1552204800u, -300, 1},
+	{"America/Chicago", 1546759800u, -360, 0},
+	{"America/Chicago", 1572764399u, -300, 1},
+	{"America/Chicago", 1572764400u, -360, 0},
+	{"America/Chicago", 1562484600u, -300, 1},
+	{"America/Chicago", 1583654399u, -360, 0},
+	{"America/Chicago", 1583654400u, -300, 1},
+	{"America/Chicago", 1578209400u, -360, 0},
+	{"America/Chicago", 1604213999u, -300, 1},
+	{"America/Chicago", 1604214000u, -360, 0},
+	{"America/Chicago", 1593934200u, -300, 1},
+	{"America/Chicago", 1615708799u, -360, 0},
+	{"America/Chicago", 1615708800u, -300, 1},
+	{"America/Chicago", 1609961400u, -360, 0},
+	{"America/Chicago", 1636268399u, -300, 1},
+	{"America/Chicago", 1636268400u, -360, 0},
+	{"America/Chicago", 1625988600u, -300, 1},
+	{"America/Chicago", 1647158399u, -360, 0},
+	{"America/Chicago", 1647158400u, -300, 1},
+	{"America/Chicago", 1641713400u, -360, 0},
+	{"America/Chicago", 1667717999u, -300, 1},
+	{"America/Chicago", 1667718000u, -360, 0},
+	{"America/Chicago", 1657438200u, -300, 1},
+	{"America/Chicago", 1678607999u, -360, 0},
+	{"America/Chicago", 1678608000u, -300, 1},
+	{"America/Chicago", 1673163000u, -360, 0},
+	{"America/Chicago", 1699167599u, -300, 1},
+	{"America/Chicago", 1699167600u, -360, 0},
+	{"America/Chicago", 1688887800u, -300, 1},
+	{"America/Chicago", 1710057599u, -360, 0},
+	{"America/Chicago", 1710057600u, -300, 1},
+	{"America/Chicago", 1704612600u, -360, 0},
+	{"America/Chicago", 1730617199u, -300, 1},
+	{"America/Chicago", 1730617200u, -360, 0},
+	{"America/Chicago", 1720337400u, -300, 1},
+	{"America/Chicago", 1741507199u, -360, 0},
+	{"America/Chicago", 1741507200u, -300, 1},
+	{"America/Chicago", 1736062200u, -360, 0},
+	{"America/Chicago", 1762066799u, -300, 1},
+	{"America/Chicago", 1762066800u, -360, 0},
+	{"America/Chicago", 1751787000u, -300, 1},
+	{"America/Chicago", 1772956799u, -360, 0},
+	{"America/Chicago", 1772956800u, -300, 1},
+	{"America/Chicago", 1767511800u, -360, 0},
+	{"America/Chicago", 1793516399u, -300, 1},
+	{"America/Chicago", 1793516400u, -360, 0},
+	{"America/Chicago", 1783236600u, -300, 1},
+	{"America/Chicago", 1805011199u, -360, 0},
+	{"America/Chicago", 1805011200u, -300, 1},
+	{"America/Chicago", 1799263800u, -360, 0},
+	{"America/Chicago", 1825570799u, -300, 1},
+	{"America/Chicago", 1825570800u, -360, 0},
+	{"America/Chicago", 1815291000u, -300, 1},
+	{"America/Chicago", 1836460799u, -360, 0},
+	{"America/Chicago", 1836460800u, -300, 1},
+	{"America/Chicago", 1831015800u, -360, 0},
+	{"America/Chicago", 1857020399u, -300, 1},
+	{"America/Chicago", 1857020400u, -360, 0},
+	{"America/Chicago", 1846740600u, -300, 1},
+	{"America/Chicago", 1867910399u, -360, 0},
+	{"America/Chicago", 1867910400u, -300, 1},
+	{"America/Chicago", 1862465400u, -360, 0},
+	{"America/Chicago", 1888469999u, -300, 1},
+	{"America/Chicago", 1888470000u, -360, 0},
+	{"America/Chicago", 1878190200u, -300, 1},
+	{"America/Chicago", 1899359999u, -360, 0},
+	{"America/Chicago", 1899360000u, -300, 1},
+	{"America/Chicago", 1893915000u, -360, 0},
+	{"America/Chicago", 1919919599u, -300, 1},
+	{"America/Chicago", 1919919600u, -360, 0},
+	{"America/Chicago", 1909639800u, -300, 1},
+	{"America/Chicago", 1930809599u, -360, 0},
+	{"America/Chicago", 1930809600u, -300, 1},
+	{"America/Chicago", 1925364600u, -360, 0},
+	{"America/Chicago", 1951369199u, -300, 1},
+	{"America/Chicago", 1951369200u, -360, 0},
+	{"America/Chicago", 1941089400u, -300, 1},
+	{"America/Chicago", 1962863999u, -360, 0},
+	{"America/Chicago", 1962864000u, -300, 1},
+	{"America/Chicago", 1957116600u, -360, 0},
+	{"America/Chicago", 1983423599u, -300, 1},
+	{"America/Chicago", 1983423600u, -360, 0},
+	{"America/Chicago", 1973143800u, -300, 1},
+	{"America/Chicago", 1994313599u, -360, 0},
+	{"America/Chicago", 1994313600u, -300, 1},
+	{"America/Chicago", 1988868600u, -360, 0},
+	{"America/Chicago", 2014873199u, -300, 1},
+	{"America/Chicago", 2014873200u, -360, 0},
+	{"America/Chicago", 2004593400u, -300, 1},
+	{"America/Chicago", 2025763199u, -360, 0},
+	{"America/Chicago", 2025763200u, -300, 1},
+	{"America/Chicago", 2020318200u, -360, 0},
+	{"America/Chicago", 2046322799u, -300, 1},
+	{"America/Chicago", 2046322800u, -360, 0},
+	{"America/Chicago", 2036043000u, -300, 1},
+	{"America/Chicago", 2057212799u, -360, 0},
+	{"America/Chicago", 2057212800u, -300, 1},
+	{"America/Chicago", 2051767800u, -360, 0},
+	{"America/Chicago", 2077772399u, -300, 1},
+	{"America/Chicago", 2077772400u, -360, 0},
+	{"America/Chicago", 2067492600u, -300, 1},
+	{"America/Chicago", 2088662399u, -360, 0},
+	{"America/Chicago", 2088662400u, -300, 1},
+	{"America/Chicago", 2083217400u, -360, 0},
+	{"America/Chicago", 2109221999u, -300, 1},
+	{"America/Chicago", 2109222000u, -360, 0},
+	{"America/Chicago", 2098942200u, -300, 1},
+	{"America/Chicago", 2120111999u, -360, 0},
+	{"America/Chicago", 2120112000u, -300, 1},
+	{"America/Chicago", 2114667000u, -360, 0},
+	{"America/Chicago", 2140671599u, -300, 1},
+	{"America/Chicago", 2140671600u, -360, 0},
+	{"America/Chicago", 2130391800u, -300, 1},
+	{"America/Chicago", 2152166399u, -360, 0},
+	{"America/Chicago", 2152166400u, -300, 1},
+	{"America/Chicago", 2146419000u, -360, 0},
+	{"America/Chicago", 2172725999u, -300, 1},
+	{"America/Chicago", 2172726000u, -360, 0},
+	{"America/Chicago", 2162446200u, -300, 1},
+	{"America/Chicago", 2183615999u, -360, 0},
+	{"America/Chicago", 2183616000u, -300, 1},
+	{"America/Chicago", 2178171000u, -360, 0},
+	{"America/Chicago", 2204175599u, -300, 1},
+	{"America/Chicago", 2204175600u, -360, 0},
+	{"America/Chicago", 2193895800u, -300, 1},
+	{"America/Chicago", 2215065599u, -360, 0},
+	{"America/Chicago", 2215065600u, -300, 1},
+	{"America/Chicago", 2209620600u, -360, 0},
+	{"America/Chicago", 2235625199u, -300, 1},
+	{"America/Chicago", 2235625200u, -360, 0},
+	{"America/Chicago", 2225345400u, -300, 1},
+	{"America/Chicago", 2246515199u, -360, 0},
+	{"America/Chicago", 2246515200u, -300, 1},
+	{"America/Chicago", 2241070200u, -360, 0},
+	{"America/Chicago", 2267074799u, -300, 1},
+	{"America/Chicago", 2267074800u, -360, 0},
+	{"America/Chicago", 2256795000u, -300, 1},
+	{"America/Chicago", 2277964799u, -360, 0},
+	{"America/Chicago", 2277964800u, -300, 1},
+	{"America/Chicago", 2272519800u, -360, 0},
+	{"America/Chicago", 2298524399u, -300, 1},
+	{"America/Chicago", 2298524400u, -360, 0},
+	{"America/Chicago", 2288244600u, -300, 1},
+	{"America/Chicago", 2309414399u, -360, 0},
+	{"America/Chicago", 2309414400u, -300, 1},
+	{"America/Chicago", 2303969400u, -360, 0},
+	{"America/Chicago", 2329973999u, -300, 1},
+	{"America/Chicago", 2329974000u, -360, 0},
+	{"America/Chicago", 2319694200u, -300, 1},
+	{"America/Chicago", 2341468799u, -360, 0},
+	{"America/Chicago", 2341468800u, -300, 1},
+	{"America/Chicago", 2335721400u, -360, 0},
+	{"America/Chicago", 2362028399u, -300, 1},
+	{"America/Chicago", 2362028400u, -360, 0},
+	{"America/Chicago", 2351748600u, -300, 1},
+	{"America/Chicago", 2372918399u, -360, 0},
+	{"America/Chicago", 2372918400u, -300, 1},
+	{"America/Chicago", 2367473400u, -360, 0},
+	{"America/Chicago", 2393477999u, -300, 1},
+	{"America/Chicago", 2393478000u, -360, 0},
+	{"America/Chicago", 2383198200u, -300, 1},
+	{"America/Chicago", 2404367999u, -360, 0},
+	{"America/Chicago", 2404368000u, -300, 1},
+	{"America/Chicago", 2398923000u, -360, 0},
+	{"America/Chicago", 2424927599u, -300, 1},
+	{"America/Chicago", 2424927600u, -360, 0},
+	{"America/Chicago", 2414647800u, -300, 1},
+	{"America/Chicago", 2435817599u, -360, 0},
+	{"America/Chicago", 2435817600u, -300, 1},
+	{"America/Chicago", 2430372600u, -360, 0},
+	{"America/Chicago", 2456377199u, -300, 1},
+	{"America/Chicago", 2456377200u, -360, 0},
+	{"America/Chicago", 2446097400u, -300, 1},
+	{"America/Chicago", 2467267199u, -360, 0},
+	{"America/Chicago", 2467267200u, -300, 1},
+	{"America/Chicago", 2461822200u, -360, 0},
+	{"America/Chicago", 2487826799u, -300, 1},
+	{"America/Chicago", 2487826800u, -360, 0},
+	{"America/Chicago", 2477547000u, -300, 1},
+	{"America/Chicago", 2499321599u, -360, 0},
+	{"America/Chicago", 2499321600u, -300, 1},
+	{"America/Chicago", 2493574200u, -360, 0},
+	{"America/Chicago", 2519881199u, -300, 1},
+	{"America/Chicago", 2519881200u, -360, 0},
+	{"America/Chicago", 2509601400u, -300, 1},
+	{"America/Chicago", 2530771199u, -360, 0},
+	{"America/Chicago", 2530771200u, -300, 1},
+	{"America/Chicago", 2525326200u, -360, 0},
+	{"America/Chicago", 2551330799u, -300, 1},
+	{"America/Chicago", 2551330800u, -360, 0},
+	{"America/Chicago", 2541051000u, -300, 1},
+	{"America/Chicago", 2562220799u, -360, 0},
+	{"America/Chicago", 2562220800u, -300, 1},
+	{"America/Chicago", 2556775800u, -360, 0},
+	{"America/Chicago", 2582780399u, -300, 1},
+	{"America/Chicago", 2582780400u, -360, 0},
+	{"America/Chicago", 2572500600u, -300, 1},
+	{"America/Chicago", 2593670399u, -360, 0},
+	{"America/Chicago", 2593670400u, -300, 1},
+	{"America/Chicago", 2588225400u, -360, 0},
+	{"America/Chicago", 2614229999u, -300, 1},
+	{"America/Chicago", 2614230000u, -360, 0},
+	{"America/Chicago", 2603950200u, -300, 1},
+	{"America/Chicago", 2625119999u, -360, 0},
+	{"America/Chicago", 2625120000u, -300, 1},
+	{"America/Chicago", 2619675000u, -360, 0},
+	{"America/Chicago", 2645679599u, -300, 1},
+	{"America/Chicago", 2645679600u, -360, 0},
+	{"America/Chicago", 2635399800u, -300, 1},
+	{"America/Chicago", 2656569599u, -360, 0},
+	{"America/Chicago", 2656569600u, -300, 1},
+	{"America/Chicago", 2651124600u, -360, 0},
+	{"America/Chicago", 2677129199u, -300, 1},
+	{"America/Chicago", 2677129200u, -360, 0},
+	{"America/Chicago", 2666849400u, -300, 1},
+	{"America/Chicago", 2688623999u, -360, 0},
+	{"America/Chicago", 2688624000u, -300, 1},
+	{"America/Chicago", 2682876600u, -360, 0},
+	{"America/Chicago", 2709183599u, -300, 1},
+	{"America/Chicago", 2709183600u, -360, 0},
+	{"America/Chicago", 2698903800u, -300, 1},
+	{"America/Chicago", 2720073599u, -360, 0},
+	{"America/Chicago", 2720073600u, -300, 1},
+	{"America/Chicago", 2714628600u, -360, 0},
+	{"America/Chicago", 2740633199u, -300, 1},
+	{"America/Chicago", 2740633200u, -360, 0},
+	{"America/Chicago", 2730353400u, -300, 1},
+	{"America/Chicago", 2751523199u, -360, 0},
+	{"America/Chicago", 2751523200u, -300, 1},
+	{"America/Chicago", 2746078200u, -360, 0},
+	{"America/Chicago", 2772082799u, -300, 1},
+	{"America/Chicago", 2772082800u, -360, 0},
+	{"America/Chicago", 2761803000u, -300, 1},
+	{"America/Chicago", 2782972799u, -360, 0},
+	{"America/Chicago", 2782972800u, -300, 1},
+	{"America/Chicago", 2777527800u, -360, 0},
+	{"America/Chicago", 2803532399u, -300, 1},
+	{"America/Chicago", 2803532400u, -360, 0},
+	{"America/Chicago", 2793252600u, -300, 1},
+	{"America/Chicago", 2814422399u, -360, 0},
+	{"America/Chicago", 2814422400u, -300, 1},
+	{"America/Chicago", 2808977400u, -360, 0},
+	{"America/Chicago", 2834981999u, -300, 1},
+	{"America/Chicago", 2834982000u, -360, 0},
+	{"America/Chicago", 2824702200u, -300, 1},
+	{"America/Chicago", 2846476799u, -360, 0},
+	{"America/Chicago", 2846476800u, -300, 1},
+	{"America/Chicago", 2840729400u, -360, 0},
+	{"America/Chicago", 2867036399u, -300, 1},
+	{"America/Chicago", 2867036400u, -360, 0},
+	{"America/Chicago", 2856756600u, -300, 1},
+	{"America/Chicago", 2877926399u, -360, 0},
+	{"America/Chicago", 2877926400u, -300, 1},
+	{"America/Chicago", 2872481400u, -360, 0},
+	{"America/Chicago", 2898485999u, -300, 1},
+	{"America/Chicago", 2898486000u, -360, 0},
+	{"America/Chicago", 2888206200u, -300, 1},
+	{"America/Chicago", 2909375999u, -360, 0},
+	{"America/Chicago", 2909376000u, -300, 1},
+	{"America/Chicago", 2903931000u, -360, 0},
+	{"America/Chicago", 2929935599u, -300, 1},
+	{"America/Chicago", 2929935600u, -360, 0},
+	{"America/Chicago", 2919655800u, -300, 1},
+	{"America/Chicago", 2940825599u, -360, 0},
+	{"America/Chicago", 2940825600u, -300, 1},
+	{"America/Chicago", 2935380600u, -360, 0},
+	{"America/Chicago", 2961385199u, -300, 1},
+	{"America/Chicago", 2961385200u, -360, 0},
+	{"America/Chicago", 2951105400u, -300, 1},
+	{"America/Chicago", 2972275199u, -360, 0},
+	{"America/Chicago", 2972275200u, -300, 1},
+	{"America/Chicago", 2966830200u, -360, 0},
+	{"America/Chicago", 2992834799u, -300, 1},
+	{"America/Chicago", 2992834800u, -360, 0},
+	{"America/Chicago", 2982555000u, -300, 1},
+	{"America/Chicago", 3003724799u, -360, 0},
+	{"America/Chicago", 3003724800u, -300, 1},
+	{"America/Chicago", 2998279800u, -360, 0},
+	{"America/Chicago", 3024284399u, -300, 1},
+	{"America/Chicago", 3024284400u, -360, 0},
+	{"America/Chicago", 3014004600u, -300, 1},
+	{"America/Chicago", 3035779199u, -360, 0},
+	{"America/Chicago", 3035779200u, -300, 1},
+	{"America/Chicago", 3030031800u, -360, 0},
+	{"America/Chicago", 3056338799u, -300, 1},
+	{"America/Chicago", 3056338800u, -360, 0},
+	{"America/Chicago", 3046059000u, -300, 1},
+	{"America/Chicago", 3067228799u, -360, 0},
+	{"America/Chicago", 3067228800u, -300, 1},
+	{"America/Chicago", 3061783800u, -360, 0},
+	{"America/Chicago", 3087788399u, -300, 1},
+	{"America/Chicago", 3087788400u, -360, 0},
+	{"America/Chicago", 3077508600u, -300, 1},
+	{"America/Chicago", 3098678399u, -360, 0},
+	{"America/Chicago", 3098678400u, -300, 1},
+	{"America/Chicago", 3093233400u, -360, 0},
+	{"America/Chicago", 3119237999u, -300, 1},
+	{"America/Chicago", 3119238000u, -360, 0},
+	{"America/Chicago", 3108958200u, -300, 1},
+	{"America/Chicago", 3130127999u, -360, 0},
+	{"America/Chicago", 3130128000u, -300, 1},
+	{"America/Chicago", 3124683000u, -360, 0},
+	{"America/Chicago", 3150687599u, -300, 1},
+	{"America/Chicago", 3150687600u, -360, 0},
+	{"America/Chicago", 3140407800u, -300, 1},
+	{"America/Chicago", 3161577599u, -360, 0},
+	{"America/Chicago", 3161577600u, -300, 1},
+	{"America/Chicago", 3156132600u, -360, 0},
+	{"America/Chicago", 3182137199u, -300, 1},
+	{"America/Chicago", 3182137200u, -360, 0},
+	{"America/Chicago", 3171857400u, -300, 1},
+	{"America/Chicago", 3193027199u, -360, 0},
+	{"America/Chicago", 3193027200u, -300, 1},
+	{"America/Chicago", 3187582200u, -360, 0},
+	{"America/Chicago", 3213586799u, -300, 1},
+	{"America/Chicago", 3213586800u, -360, 0},
+	{"America/Chicago", 3203307000u, -300, 1},
+	{"America/Chicago", 3225081599u, -360, 0},
+	{"America/Chicago", 3225081600u, -300, 1},
+	{"America/Chicago", 3219334200u, -360, 0},
+	{"America/Chicago", 3245641199u, -300, 1},
+	{"America/Chicago", 3245641200u, -360, 0},
+	{"America/Chicago", 3235361400u, -300, 1},
+	{"America/Chicago", 3256531199u, -360, 0},
+	{"America/Chicago", 3256531200u, -300, 1},
+	{"America/Chicago", 3251086200u, -360, 0},
+	{"America/Chicago", 3277090799u, -300, 1},
+	{"America/Chicago", 3277090800u, -360, 0},
+	{"America/Chicago", 3266811000u, -300, 1},
+	{"America/Chicago", 3287980799u, -360, 0},
+	{"America/Chicago", 3287980800u, -300, 1},
+	{"America/Chicago", 3282535800u, -360, 0},
+	{"America/Chicago", 3308540399u, -300, 1},
+	{"America/Chicago", 3308540400u, -360, 0},
+	{"America/Chicago", 3298260600u, -300, 1},
+	{"America/Chicago", 3319430399u, -360, 0},
+	{"America/Chicago", 3319430400u, -300, 1},
+	{"America/Chicago", 3313985400u, -360, 0},
+	{"America/Chicago", 3339989999u, -300, 1},
+	{"America/Chicago", 3339990000u, -360, 0},
+	{"America/Chicago", 3329710200u, -300, 1},
+	{"America/Chicago", 3350879999u, -360, 0},
+	{"America/Chicago", 3350880000u, -300, 1},
+	{"America/Chicago", 3345435000u, -360, 0},
+	{"America/Chicago", 3371439599u, -300, 1},
+	{"America/Chicago", 3371439600u, -360, 0},
+	{"America/Chicago", 3361159800u, -300, 1},
+	{"America/Chicago", 3382934399u, -360, 0},
+	{"America/Chicago", 3382934400u, -300, 1},
+	{"America/Chicago", 3377187000u, -360, 0},
+	{"America/Chicago", 3403493999u, -300, 1},
+	{"America/Chicago", 3403494000u, -360, 0},
+	{"America/Chicago", 3393214200u, -300, 1},
+	{"America/Chicago", 3414383999u, -360, 0},
+	{"America/Chicago", 3414384000u, -300, 1},
+	{"America/Chicago", 3408939000u, -360, 0},
+	{"America/Chicago", 3434943599u, -300, 1},
+	{"America/Chicago", 3434943600u, -360, 0},
+	{"America/Chicago", 3424663800u, -300, 1},
+	{"America/Chicago", 3445833599u, -360, 0},
+	{"America/Chicago", 3445833600u, -300, 1},
+	{"America/Chicago", 3440388600u, -360, 0},
+	{"America/Chicago", 3466393199u, -300, 1},
+	{"America/Chicago", 3466393200u, -360, 0},
+	{"America/Chicago", 3456113400u, -300, 1},
+	{"America/Chicago", 3477283199u, -360, 0},
+	{"America/Chicago", 3477283200u, -300, 1},
+	{"America/Chicago", 3471838200u, -360, 0},
+	{"America/Chicago", 3497842799u, -300, 1},
+	{"America/Chicago", 3497842800u, -360, 0},
+	{"America/Chicago", 3487563000u, -300, 1},
+	{"America/Chicago", 3508732799u, -360, 0},
+	{"America/Chicago", 3508732800u, -300, 1},
+	{"America/Chicago", 3503287800u, -360, 0},
+	{"America/Chicago", 3529292399u, -300, 1},
+	{"America/Chicago", 3529292400u, -360, 0},
+	{"America/Chicago", 3519012600u, -300, 1},
+	{"America/Chicago", 3540182399u, -360, 0},
+	{"America/Chicago", 3540182400u, -300, 1},
+	{"America/Chicago", 3534737400u, -360, 0},
+	{"America/Chicago", 3560741999u, -300, 1},
+	{"America/Chicago", 3560742000u, -360, 0},
+	{"America/Chicago", 3550462200u, -300, 1},
+	{"America/Chicago", 3572236799u, -360, 0},
+	{"America/Chicago", 3572236800u, -300, 1},
+	{"America/Chicago", 3566489400u, -360, 0},
+	{"America/Chicago", 3592796399u, -300, 1},
+	{"America/Chicago", 3592796400u, -360, 0},
+	{"America/Chicago", 3582516600u, -300, 1},
+	{"America/Chicago", 3603686399u, -360, 0},
+	{"America/Chicago", 3603686400u, -300, 1},
+	{"America/Chicago", 3598241400u, -360, 0},
+	{"America/Chicago", 3624245999u, -300, 1},
+	{"America/Chicago", 3624246000u, -360, 0},
+	{"America/Chicago", 3613966200u, -300, 1},
+	{"America/Chicago", 3635135999u, -360, 0},
+	{"America/Chicago", 3635136000u, -300, 1},
+	{"America/Chicago", 3629691000u, -360, 0},
+	{"America/Chicago", 3655695599u, -300, 1},
+	{"America/Chicago", 3655695600u, -360, 0},
+	{"America/Chicago", 3645415800u, -300, 1},
+	{"America/Chicago", 3666585599u, -360, 0},
+	{"America/Chicago", 3666585600u, -300, 1},
+	{"America/Chicago", 3661140600u, -360, 0},
+	{"America/Chicago", 3687145199u, -300, 1},
+	{"America/Chicago", 3687145200u, -360, 0},
+	{"America/Chicago", 3676865400u, -300, 1},
+	{"America/Chicago", 3698035199u, -360, 0},
+	{"America/Chicago", 3698035200u, -300, 1},
+	{"America/Chicago", 3692590200u, -360, 0},
+	{"America/Chicago", 3718594799u, -300, 1},
+	{"America/Chicago", 3718594800u, -360, 0},
+	{"America/Chicago", 3708315000u, -300, 1},
+	{"America/Chicago", 3730089599u, -360, 0},
+	{"America/Chicago", 3730089600u, -300, 1},
+	{"America/Chicago", 3724342200u, -360, 0},
+	{"America/Chicago", 3750649199u, -300, 1},
+	{"America/Chicago", 3750649200u, -360, 0},
+	{"America/Chicago", 3740369400u, -300, 1},
+	{"America/Chicago", 3761539199u, -360, 0},
+	{"America/Chicago", 3761539200u, -300, 1},
+	{"America/Chicago", 3756094200u, -360, 0},
+	{"America/Chicago", 3782098799u, -300, 1},
+	{"America/Chicago", 3782098800u, -360, 0},
+	{"America/Chicago", 3771819000u, -300, 1},
+	{"America/Chicago", 3792988799u, -360, 0},
+	{"America/Chicago", 3792988800u, -300, 1},
+	{"America/Chicago", 3787543800u, -360, 0},
+	{"America/Chicago", 3813548399u, -300, 1},
+	{"America/Chicago", 3813548400u, -360, 0},
+	{"America/Chicago", 3803268600u, -300, 1},
+	{"America/Chicago", 3824438399u, -360, 0},
+	{"America/Chicago", 3824438400u, -300, 1},
+	{"America/Chicago", 3818993400u, -360, 0},
+	{"America/Chicago", 3844997999u, -300, 1},
+	{"America/Chicago", 3844998000u, -360, 0},
+	{"America/Chicago", 3834718200u, -300, 1},
+	{"America/Chicago", 3855887999u, -360, 0},
+	{"America/Chicago", 3855888000u, -300, 1},
+	{"America/Chicago", 3850443000u, -360, 0},
+	{"America/Chicago", 3876447599u, -300, 1},
+	{"America/Chicago", 3876447600u, -360, 0},
+	{"America/Chicago", 3866167800u, -300, 1},
+	{"America/Chicago", 3887337599u, -360, 0},
+	{"America/Chicago", 3887337600u, -300, 1},
+	{"America/Chicago", 3881892600u, -360, 0},
+	{"America/Chicago", 3907897199u, -300, 1},
+	{"America/Chicago", 3907897200u, -360, 0},
+	{"America/Chicago", 3897617400u, -300, 1},
+	{"America/Chicago", 3919391999u, -360, 0},
+	{"America/Chicago", 3919392000u, -300, 1},
+	{"America/Chicago", 3913644600u, -360, 0},
+	{"America/Chicago", 3939951599u, -300, 1},
+	{"America/Chicago", 3939951600u, -360, 0},
+	{"America/Chicago", 3929671800u, -300, 1},
+	{"America/Chicago", 3950841599u, -360, 0},
+	{"America/Chicago", 3950841600u, -300, 1},
+	{"America/Chicago", 3945396600u, -360, 0},
+	{"America/Chicago", 3971401199u, -300, 1},
+	{"America/Chicago", 3971401200u, -360, 0},
+	{"America/Chicago", 3961121400u, -300, 1},
+	{"America/Chicago", 3982291199u, -360, 0},
+	{"America/Chicago", 3982291200u, -300, 1},
+	{"America/Chicago", 3976846200u, -360, 0},
+	{"America/Chicago", 4002850799u, -300, 1},
+	{"America/Chicago", 4002850800u, -360, 0},
+	{"America/Chicago", 3992571000u, -300, 1},
+	{"America/Chicago", 4013740799u, -360, 0},
+	{"America/Chicago", 4013740800u, -300, 1},
+	{"America/Chicago", 4008295800u, -360, 0},
+	{"America/Chicago", 4034300399u, -300, 1},
+	{"America/Chicago", 4034300400u, -360, 0},
+	{"America/Chicago", 4024020600u, -300, 1},
+	{"America/Chicago", 4045190399u, -360, 0},
+	{"America/Chicago", 4045190400u, -300, 1},
+	{"America/Chicago", 4039745400u, -360, 0},
+	{"America/Chicago", 4065749999u, -300, 1},
+	{"America/Chicago", 4065750000u, -360, 0},
+	{"America/Chicago", 4055470200u, -300, 1},
+	{"America/Chicago", 4076639999u, -360, 0},
+	{"America/Chicago", 4076640000u, -300, 1},
+	{"America/Chicago", 4071195000u, -360, 0},
+	{"America/Chicago", 4097199599u, -300, 1},
+	{"America/Chicago", 4097199600u, -360, 0},
+	{"America/Chicago", 4086919800u, -300, 1},
+	{"America/Chicago", 4108694399u, -360, 0},
+	{"America/Chicago", 4108694400u, -300, 1},
+	{"America/Chicago", 4102947000u, -360, 0},
+	{"America/Chicago", 4129253999u, -300, 1},
+	{"America/Chicago", 4129254000u, -360, 0},
+	{"America/Chicago", 4118974200u, -300, 1},
+	{"America/Chicago", 4140143999u, -360, 0},
+	{"America/Chicago", 4140144000u, -300, 1},
+	{"America/Chicago", 4134699000u, -360, 0},
+	{"America/Chicago", 4160703599u, -300, 1},
+	{"America/Chicago", 4160703600u, -360, 0},
+	{"America/Chicago", 4150423800u, -300, 1},
+	{"America/Chicago", 4171593599u, -360, 0},
+	{"America/Chicago", 4171593600u, -300, 1},
+	{"America/Chicago", 4166148600u, -360, 0},
+	{"America/Chicago", 4192153199u, -300, 1},
+	{"America/Chicago", 4192153200u, -360, 0},
+	{"America/Chicago", 4181873400u, -300, 1},
+	{"America/Chicago", 4203043199u, -360, 0},
+	{"America/Chicago", 4203043200u, -300, 1},
+	{"America/Chicago", 4197598200u, -360, 0},
+	{"America/Chicago", 4223602799u, -300, 1},
+	{"America/Chicago", 4223602800u, -360, 0},
+	{"America/Chicago", 4213323000u, -300, 1},
+	{"America/Chicago", 4234492799u, -360, 0},
+	{"America/Chicago", 4234492800u, -300, 1},
+	{"America/Chicago", 4229047800u, -360, 0},
+	{"America/Chicago", 4255052399u, -300, 1},
+	{"America/Chicago", 4255052400u, -360, 0},
+	{"America/Chicago", 4244772600u, -300, 1},
+	{"America/Chicago", 4265942399u, -360, 0},
+	{"America/Chicago", 4265942400u, -300, 1},
+	{"America/Chicago", 4260497400u, -360, 0},
+	{"America/Chicago", 4286501999u, -300, 1},
+	{"America/Chicago", 4286502000u, -360, 0},
+	{"America/Chicago", 4276222200u, -300, 1},
+	{"America/Chicago", 4294967295u, -360, 0},
+	// America/Denver
+	{"America/Denver", 1262304000u, -420, 0},
+	{"America/Denver", 1268557199u, -420, 0},
+	{"America/Denver", 1268557200u, -360, 1},
+	{"America/Denver", 1265430600u, -420, 0},
+	{"America/Denver", 1289116799u, -360, 1},
+	{"America/Denver", 1289116800u, -420, 0},
+	{"America/Denver", 1278837000u, -360, 1},
+	{"America/Denver", 1300006799u, -420, 0},
+	{"America/Denver", 1300006800u, -360, 1},
+	{"America/Denver", 1294561800u, -420, 0},
+	{"America/Denver", 1320566399u, -360, 1},
+	{"America/Denver", 1320566400u, -420, 0},
+	{"America/Denver", 1310286600u, -360, 1},
+	{"America/Denver", 1331456399u, -420, 0},
+	{"America/Denver", 1331456400u, -360, 1},
+	{"America/Denver", 1326011400u, -420, 0},
+	{"America/Denver", 1352015999u, -360, 1},
+	{"America/Denver", 1352016000u, -420, 0},
+	{"America/Denver", 1341736200u, -360, 1},
+	{"America/Denver", 1362905999u, -420, 0},
+	{"America/Denver", 1362906000u, -360, 1},
+	{"America/Denver", 1357461000u, -420, 0},
+	{"America/Denver", 1383465599u, -360, 1},
+	{"America/Denver", 1383465600u, -420, 0},
+	{"America/Denver", 1373185800u, -360, 1},
+	{"America/Denver", 1394355599u, -420, 0},
+	{"America/Denver", 1394355600u, -360, 1},
+	{"America/Denver", 1388910600u, -420, 0},
+	{"America/Denver", 1414915199u, -360, 1},
+	{"America/Denver", 1414915200u, -420, 0},
+	{"America/Denver", 1404635400u, -360, 1},
+	{"America/Denver", 1425805199u, -420, 0},
+	{"America/Denver", 1425805200u, -360, 1},
+	{"America/Denver", 1420360200u, -420, 0},
+	{"America/Denver", 1446364799u, -360, 1},
+	{"America/Denver", 1446364800u, -420, 0},
+	{"America/Denver", 1436085000u, -360, 1},
+	{"America/Denver", 1457859599u, -420, 0},
+	{"America/Denver", 1457859600u, -360, 1},
+	{"America/Denver", 1452112200u, -420, 0},
+	{"America/Denver", 1478419199u, -360, 1},
+	{"America/Denver", 1478419200u, -420, 0},
+	{"America/Denver", 1468139400u, -360, 1},
+	{"America/Denver", 1489309199u, -420, 0},
+	{"America/Denver", 1489309200u, -360, 1},
+	{"America/Denver", 1483864200u, -420, 0},
+	{"America/Denver", 1509868799u, -360, 1},
+	{"America/Denver", 1509868800u, -420, 0},
+	{"America/Denver", 1499589000u, -360, 1},
+	{"America/Denver", 1520758799u, -420, 0},
+	{"America/Denver", 1520758800u, -360, 1},
+	{"America/Denver", 1515313800u, -420, 0},
+	{"America/Denver", 1541318399u, -360, 1},
+	{"America/Denver", 1541318400u, -420, 0},
+	{"America/Denver", 1531038600u, -360, 1},
+	{"America/Denver", 1552208399u, -420, 0},
+	{"America/Denver", 1552208400u, -360, 1},
+	{"America/Denver", 1546763400u, -420, 0},
+	{"America/Denver", 1572767999u, -360, 1},
+	{"America/Denver", 1572768000u, -420, 0},
+	{"America/Denver", 1562488200u, -360, 1},
+	{"America/Denver", 1583657999u, -420, 0},
+	{"America/Denver", 1583658000u, -360, 1},
+	{"America/Denver", 1578213000u, -420, 0},
+	{"America/Denver", 1604217599u, -360, 1},
+	{"America/Denver", 1604217600u, -420, 0},
+	{"America/Denver", 1593937800u, -360, 1},
+	{"America/Denver", 1615712399u, -420, 0},
+	{"America/Denver", 1615712400u, -360, 1},
+	{"America/Denver", 1609965000u, -420, 0},
+	{"America/Denver", 1636271999u, -360, 1},
+	{"America/Denver", 1636272000u, -420, 0},
+	{"America/Denver", 1625992200u, -360, 1},
+	{"America/Denver", 1647161999u, -420, 0},
+	{"America/Denver", 1647162000u, -360, 1},
+	{"America/Denver", 1641717000u, -420, 0},
+	{"America/Denver", 1667721599u, -360, 1},
+	{"America/Denver", 1667721600u, -420, 0},
+	{"America/Denver", 1657441800u, -360, 1},
+	{"America/Denver", 1678611599u, -420, 0},
+	{"America/Denver", 1678611600u, -360, 1},
+	{"America/Denver", 1673166600u, -420, 0},
+	{"America/Denver", 1699171199u, -360, 1},
+	{"America/Denver", 1699171200u, -420, 0},
+	{"America/Denver", 1688891400u, -360, 1},
+	{"America/Denver", 1710061199u, -420, 0},
+	{"America/Denver", 1710061200u, -360, 1},
+	{"America/Denver", 1704616200u, -420, 0},
+	{"America/Denver", 1730620799u, -360, 1},
+	{"America/Denver", 1730620800u, -420, 0},
+	{"America/Denver", 1720341000u, -360, 1},
+	{"America/Denver", 1741510799u, -420, 0},
+	{"America/Denver", 1741510800u, -360, 1},
+	{"America/Denver", 1736065800u, -420, 0},
+	{"America/Denver", 1762070399u, -360, 1},
+	{"America/Denver", 1762070400u, -420, 0},
+	{"America/Denver", 1751790600u, -360, 1},
+	{"America/Denver", 1772960399u, -420, 0},
+	{"America/Denver", 1772960400u, -360, 1},
+	{"America/Denver", 1767515400u, -420, 0},
+	{"America/Denver", 1793519999u, -360, 1},
+	{"America/Denver", 1793520000u, -420, 0},
+	{"America/Denver", 1783240200u, -360, 1},
+	{"America/Denver", 1805014799u, -420, 0},
+	{"America/Denver", 1805014800u, -360, 1},
+	{"America/Denver", 1799267400u, -420, 0},
+	{"America/Denver", 1825574399u, -360, 1},
+	{"America/Denver", 1825574400u, -420, 0},
+	{"America/Denver", 1815294600u, -360, 1},
+	{"America/Denver", 1836464399u, -420, 0},
+	{"America/Denver", 1836464400u, -360, 1},
+	{"America/Denver", 1831019400u, -420, 0},
+	{"America/Denver", 1857023999u, -360, 1},
+	{"America/Denver", 1857024000u, -420, 0},
+	{"America/Denver", 1846744200u, -360, 1},
+	{"America/Denver", 1867913999u, -420, 0},
+	{"America/Denver", 1867914000u, -360, 1},
+	{"America/Denver", 1862469000u, -420, 0},
+	{"America/Denver", 1888473599u, -360, 1},
+	{"America/Denver", 1888473600u, -420, 0},
+	{"America/Denver", 1878193800u, -360, 1},
+	{"America/Denver", 1899363599u, -420, 0},
+	{"America/Denver", 1899363600u, -360, 1},
+	{"America/Denver", 1893918600u, -420, 0},
+	{"America/Denver", 1919923199u, -360, 1},
+	{"America/Denver", 1919923200u, -420, 0},
+	{"America/Denver", 1909643400u, -360, 1},
+	{"America/Denver", 1930813199u, -420, 0},
+	{"America/Denver", 1930813200u, -360, 1},
+	{"America/Denver", 1925368200u, -420, 0},
+	{"America/Denver", 1951372799u, -360, 1},
+	{"America/Denver", 1951372800u, -420, 0},
+	{"America/Denver", 1941093000u, -360, 1},
+	{"America/Denver", 1962867599u, -420, 0},
+	{"America/Denver", 1962867600u, -360, 1},
+	{"America/Denver", 1957120200u, -420, 0},
+	{"America/Denver", 1983427199u, -360, 1},
+	{"America/Denver", 1983427200u, -420, 0},
+	{"America/Denver", 1973147400u, -360, 1},
+	{"America/Denver", 1994317199u, -420, 0},
+	{"America/Denver", 1994317200u, -360, 1},
+	{"America/Denver", 1988872200u, -420, 0},
+	{"America/Denver", 2014876799u, -360, 1},
+	{"America/Denver", 2014876800u, -420, 0},
+	{"America/Denver", 2004597000u, -360, 1},
+	{"America/Denver", 2025766799u, -420, 0},
+	{"America/Denver", 2025766800u, -360, 1},
+	{"America/Denver", 2020321800u, -420, 0},
+	{"America/Denver", 2046326399u, -360, 1},
+	{"America/Denver", 2046326400u, -420, 0},
+	{"America/Denver", 2036046600u, -360, 1},
+	{"America/Denver", 2057216399u, -420, 0},
+	{"America/Denver", 2057216400u, -360, 1},
+	{"America/Denver", 2051771400u, -420, 0},
+	{"America/Denver", 2077775999u, -360, 1},
+	{"America/Denver", 2077776000u, -420, 0},
+	{"America/Denver", 2067496200u, -360, 1},
+	{"America/Denver", 2088665999u, -420, 0},
+	{"America/Denver", 2088666000u, -360, 1},
+	{"America/Denver", 2083221000u, -420, 0},
+	{"America/Denver", 2109225599u, -360, 1},
+	{"America/Denver", 2109225600u, -420, 0},
+	{"America/Denver", 2098945800u, -360, 1},
+	{"America/Denver", 2120115599u, -420, 0},
+	{"America/Denver", 2120115600u, -360, 1},
+	{"America/Denver", 2114670600u, -420, 0},
+	{"America/Denver", 2140675199u, -360, 1},
+	{"America/Denver", 2140675200u, -420, 0},
+	{"America/Denver", 2130395400u, -360, 1},
+	{"America/Denver", 2152169999u, -420, 0},
+	{"America/Denver", 2152170000u, -360, 1},
+	{"America/Denver", 2146422600u, -420, 0},
+	{"America/Denver", 2172729599u, -360, 1},
+	{"America/Denver", 2172729600u, -420, 0},
+	{"America/Denver", 2162449800u, -360, 1},
+	{"America/Denver", 2183619599u, -420, 0},
+	{"America/Denver", 2183619600u, -360, 1},
+	{"America/Denver", 2178174600u, -420, 0},
+	{"America/Denver", 2204179199u, -360, 1},
+	{"America/Denver", 2204179200u, -420, 0},
+	{"America/Denver", 2193899400u, -360, 1},
+	{"America/Denver", 2215069199u, -420, 0},
+	{"America/Denver", 2215069200u, -360, 1},
+	{"America/Denver", 2209624200u, -420, 0},
+	{"America/Denver", 2235628799u, -360, 1},
+	{"America/Denver", 2235628800u, -420, 0},
+	{"America/Denver", 2225349000u, -360, 1},
+	{"America/Denver", 2246518799u, -420, 0},
+	{"America/Denver", 2246518800u, -360, 1},
+	{"America/Denver", 2241073800u, -420, 0},
+	{"America/Denver", 2267078399u, -360, 1},
+	{"America/Denver", 2267078400u, -420, 0},
+	{"America/Denver", 2256798600u, -360, 1},
+	{"America/Denver", 2277968399u, -420, 0},
+	{"America/Denver", 2277968400u, -360, 1},
+	{"America/Denver", 2272523400u, -420, 0},
+	{"America/Denver", 2298527999u, -360, 1},
+	{"America/Denver", 2298528000u, -420, 0},
+	{"America/Denver", 2288248200u, -360, 1},
+	{"America/Denver", 2309417999u, -420, 0},
+	{"America/Denver", 2309418000u, -360, 1},
+	{"America/Denver", 2303973000u, -420, 0},
+	{"America/Denver", 2329977599u, -360, 1},
+	{"America/Denver", 2329977600u, -420, 0},
+	{"America/Denver", 2319697800u, -360, 1},
+	{"America/Denver", 2341472399u, -420, 0},
+	{"America/Denver", 2341472400u, -360, 1},
+	{"America/Denver", 2335725000u, -420, 0},
+	{"America/Denver", 2362031999u, -360, 1},
+	{"America/Denver", 2362032000u, -420, 0},
+	{"America/Denver", 2351752200u, -360, 1},
+	{"America/Denver", 2372921999u, -420, 0},
+	{"America/Denver", 2372922000u, -360, 1},
+	{"America/Denver", 2367477000u, -420, 0},
+	{"America/Denver", 2393481599u, -360, 1},
+	{"America/Denver", 2393481600u, -420, 0},
+	{"America/Denver", 2383201800u, -360, 1},
+	{"America/Denver", 2404371599u, -420, 0},
+	{"America/Denver", 2404371600u, -360, 1},
+	{"America/Denver", 2398926600u, -420, 0},
+	{"America/Denver", 2424931199u, -360, 1},
+	{"America/Denver", 2424931200u, -420, 0},
+	{"America/Denver", 2414651400u, -360, 1},
+	{"America/Denver", 2435821199u, -420, 0},
+	{"America/Denver", 2435821200u, -360, 1},
+	{"America/Denver", 2430376200u, -420, 0},
+	{"America/Denver", 2456380799u, -360, 1},
+	{"America/Denver", 2456380800u, -420, 0},
+	{"America/Denver", 2446101000u, -360, 1},
+	{"America/Denver", 2467270799u, -420, 0},
+	{"America/Denver", 2467270800u, -360, 1},
+	{"America/Denver", 2461825800u, -420, 0},
+	{"America/Denver", 2487830399u, -360, 1},
+	{"America/Denver", 2487830400u, -420, 0},
+	{"America/Denver", 2477550600u, -360, 1},
+	{"America/Denver", 2499325199u, -420, 0},
+	{"America/Denver", 2499325200u, -360, 1},
+	{"America/Denver", 2493577800u, -420, 0},
+	{"America/Denver", 2519884799u, -360, 1},
+	{"America/Denver", 2519884800u, -420, 0},
+	{"America/Denver", 2509605000u, -360, 1},
+	{"America/Denver", 2530774799u, -420, 0},
+	{"America/Denver", 2530774800u, -360, 1},
+	{"America/Denver", 2525329800u, -420, 0},
+	{"America/Denver", 2551334399u, -360, 1},
+	{"America/Denver", 2551334400u, -420, 0},
+	{"America/Denver", 2541054600u, -360, 1},
+	{"America/Denver", 2562224399u, -420, 0},
+	{"America/Denver", 2562224400u, -360, 1},
+	{"America/Denver", 2556779400u, -420, 0},
+	{"America/Denver", 2582783999u, -360, 1},
+	{"America/Denver", 2582784000u, -420, 0},
+	{"America/Denver", 2572504200u, -360, 1},
+	{"America/Denver", 2593673999u, -420, 0},
+	{"America/Denver", 2593674000u, -360, 1},
+	{"America/Denver", 2588229000u, -420, 0},
+	{"America/Denver", 2614233599u, -360, 1},
+	{"America/Denver", 2614233600u, -420, 0},
+	{"America/Denver", 2603953800u, -360, 1},
+	{"America/Denver", 2625123599u, -420, 0},
+	{"America/Denver", 2625123600u, -360, 1},
+	{"America/Denver", 2619678600u, -420, 0},
+	{"America/Denver", 2645683199u, -360, 1},
+	{"America/Denver", 2645683200u, -420, 0},
+	{"America/Denver", 2635403400u, -360, 1},
+	{"America/Denver", 2656573199u, -420, 0},
+	{"America/Denver", 2656573200u, -360, 1},
+	{"America/Denver", 2651128200u, -420, 0},
+	{"America/Denver", 2677132799u, -360, 1},
+	{"America/Denver", 2677132800u, -420, 0},
+	{"America/Denver", 2666853000u, -360, 1},
+	{"America/Denver", 2688627599u, -420, 0},
+	{"America/Denver", 2688627600u, -360, 1},
+	{"America/Denver", 2682880200u, -420, 0},
+	{"America/Denver", 2709187199u, -360, 1},
+	{"America/Denver", 2709187200u, -420, 0},
+	{"America/Denver", 2698907400u, -360, 1},
+	{"America/Denver", 2720077199u, -420, 0},
+	{"America/Denver", 2720077200u, -360, 1},
+	{"America/Denver", 2714632200u, -420, 0},
+	{"America/Denver", 2740636799u, -360, 1},
+	{"America/Denver", 2740636800u, -420, 0},
+	{"America/Denver", 2730357000u, -360, 1},
+	{"America/Denver", 2751526799u, -420, 0},
+	{"America/Denver", 2751526800u, -360, 1},
+	{"America/Denver", 2746081800u, -420, 0},
+	{"America/Denver", 2772086399u, -360, 1},
+	{"America/Denver", 2772086400u, -420, 0},
+	{"America/Denver", 2761806600u, -360, 1},
+	{"America/Denver", 2782976399u, -420, 0},
+	{"America/Denver", 2782976400u, -360, 1},
+	{"America/Denver", 2777531400u, -420, 0},
+	{"America/Denver", 2803535999u, -360, 1},
+	{"America/Denver", 2803536000u, -420, 0},
+	{"America/Denver", 2793256200u, -360, 1},
+	{"America/Denver", 2814425999u, -420, 0},
+	{"America/Denver", 2814426000u, -360, 1},
+	{"America/Denver", 2808981000u, -420, 0},
+	{"America/Denver", 2834985599u, -360, 1},
+	{"America/Denver", 2834985600u, -420, 0},
+	{"America/Denver", 2824705800u, -360, 1},
+	{"America/Denver", 2846480399u, -420, 0},
+	{"America/Denver", 2846480400u, -360, 1},
+	{"America/Denver", 2840733000u, -420, 0},
+	{"America/Denver", 2867039999u, -360, 1},
+	{"America/Denver", 2867040000u, -420, 0},
+	{"America/Denver", 2856760200u, -360, 1},
+	{"America/Denver", 2877929999u, -420, 0},
+	{"America/Denver", 2877930000u, -360, 1},
+	{"America/Denver", 2872485000u, -420, 0},
+	{"America/Denver", 2898489599u, -360, 1},
+	{"America/Denver", 2898489600u, -420, 0},
+	{"America/Denver", 2888209800u, -360, 1},
+	{"America/Denver", 2909379599u, -420, 0},
+	{"America/Denver", 2909379600u, -360, 1},
+	{"America/Denver", 2903934600u, -420, 0},
+	{"America/Denver", 2929939199u, -360, 1},
+	{"America/Denver", 2929939200u, -420, 0},
+	{"America/Denver", 2919659400u, -360, 1},
+	{"America/Denver", 2940829199u, -420, 0},
+	{"America/Denver", 2940829200u, -360, 1},
+	{"America/Denver", 2935384200u, -420, 0},
+	{"America/Denver", 2961388799u, -360, 1},
+	{"America/Denver", 2961388800u, -420, 0},
+	{"America/Denver", 2951109000u, -360, 1},
+	{"America/Denver", 2972278799u, -420, 0},
+	{"America/Denver", 2972278800u, -360, 1},
+	{"America/Denver", 2966833800u, -420, 0},
+	{"America/Denver", 2992838399u, -360, 1},
+	{"America/Denver", 2992838400u, -420, 0},
+	{"America/Denver", 2982558600u, -360, 1},
+	{"America/Denver", 3003728399u, -420, 0},
+	{"America/Denver", 3003728400u, -360, 1},
+	{"America/Denver", 2998283400u, -420, 0},
+	{"America/Denver", 3024287999u, -360, 1},
+	{"America/Denver", 3024288000u, -420, 0},
+	{"America/Denver", 3014008200u, -360, 1},
+	{"America/Denver", 3035782799u, -420, 0},
+	{"America/Denver", 3035782800u, -360, 1},
+	{"America/Denver", 3030035400u, -420, 0},
+	{"America/Denver", 3056342399u, -360, 1},
+	{"America/Denver", 3056342400u, -420, 0},
+	{"America/Denver", 3046062600u, -360, 1},
+	{"America/Denver", 3067232399u, -420, 0},
+	{"America/Denver", 3067232400u, -360, 1},
+	{"America/Denver", 3061787400u, -420, 0},
+	{"America/Denver", 3087791999u, -360, 1},
+	{"America/Denver", 3087792000u, -420, 0},
+	{"America/Denver", 3077512200u, -360, 1},
+	{"America/Denver", 3098681999u, -420, 0},
+	{"America/Denver", 3098682000u, -360, 1},
+	{"America/Denver", 3093237000u, -420, 0},
+	{"America/Denver", 3119241599u, -360, 1},
+	{"America/Denver", 3119241600u, -420, 0},
+	{"America/Denver", 3108961800u, -360, 1},
+	{"America/Denver", 3130131599u, -420, 0},
+	{"America/Denver", 3130131600u, -360, 1},
+	{"America/Denver", 3124686600u, -420, 0},
+	{"America/Denver", 3150691199u, -360, 1},
+	{"America/Denver", 3150691200u, -420, 0},
+	{"America/Denver", 3140411400u, -360, 1},
+	{"America/Denver", 3161581199u, -420, 0},
+	{"America/Denver", 3161581200u, -360, 1},
+	{"America/Denver", 3156136200u, -420, 0},
+	{"America/Denver", 3182140799u, -360, 1},
+	{"America/Denver", 3182140800u, -420, 0},
+	{"America/Denver", 3171861000u, -360, 1},
+	{"America/Denver", 3193030799u, -420, 0},
+	{"America/Denver", 3193030800u, -360, 1},
+	{"America/Denver", 3187585800u, -420, 0},
+	{"America/Denver", 3213590399u, -360, 1},
+	{"America/Denver", 3213590400u, -420, 0},
+	{"America/Denver", 3203310600u, -360, 1},
+	{"America/Denver", 3225085199u, -420, 0},
+	{"America/Denver", 3225085200u, -360, 1},
+	{"America/Denver", 3219337800u, -420, 0},
+	{"America/Denver", 3245644799u, -360, 1},
+	{"America/Denver", 3245644800u, -420, 0},
+	{"America/Denver", 3235365000u, -360, 1},
+	{"America/Denver", 3256534799u, -420, 0},
+	{"America/Denver", 3256534800u, -360, 1},
+	{"America/Denver", 3251089800u, -420, 0},
+	{"America/Denver", 3277094399u, -360, 1},
+	{"America/Denver", 3277094400u, -420, 0},
+	{"America/Denver", 3266814600u, -360, 1},
+	{"America/Denver", 3287984399u, -420, 0},
+	{"America/Denver", 3287984400u, -360, 1},
+	{"America/Denver", 3282539400u, -420, 0},
+	{"America/Denver", 3308543999u, -360, 1},
+	{"America/Denver", 3308544000u, -420, 0},
+	{"America/Denver", 3298264200u, -360, 1},
+	{"America/Denver", 3319433999u, -420, 0},
+	{"America/Denver", 3319434000u, -360, 1},
+	{"America/Denver", 3313989000u, -420, 0},
+	{"America/Denver", 3339993599u, -360, 1},
+	{"America/Denver", 3339993600u, -420, 0},
+	{"America/Denver", 3329713800u, -360, 1},
+	{"America/Denver", 3350883599u, -420, 0},
+	{"America/Denver", 3350883600u, -360, 1},
+	{"America/Denver", 3345438600u, -420, 0},
+	{"America/Denver", 3371443199u, -360, 1},
+	{"America/Denver", 3371443200u, -420, 0},
+	{"America/Denver", 3361163400u, -360, 1},
+	{"America/Denver", 3382937999u, -420, 0},
+	{"America/Denver", 3382938000u, -360, 1},
+	{"America/Denver", 3377190600u, -420, 0},
+	{"America/Denver", 3403497599u, -360, 1},
+	{"America/Denver", 3403497600u, -420, 0},
+	{"America/Denver", 3393217800u, -360, 1},
+	{"America/Denver", 3414387599u, -420, 0},
+	{"America/Denver", 3414387600u, -360, 1},
+	{"America/Denver", 3408942600u, -420, 0},
+	{"America/Denver", 3434947199u, -360, 1},
+	{"America/Denver", 3434947200u, -420, 0},
+	{"America/Denver", 3424667400u, -360, 1},
+	{"America/Denver", 3445837199u, -420, 0},
+	{"America/Denver", 3445837200u, -360, 1},
+	{"America/Denver", 3440392200u, -420, 0},
+	{"America/Denver", 3466396799u, -360, 1},
+	{"America/Denver", 3466396800u, -420, 0},
+	{"America/Denver", 3456117000u, -360, 1},
+	{"America/Denver", 3477286799u, -420, 0},
+	{"America/Denver", 3477286800u, -360, 1},
+	{"America/Denver", 3471841800u, -420, 0},
+	{"America/Denver", 3497846399u, -360, 1},
+	{"America/Denver", 3497846400u, -420, 0},
+	{"America/Denver", 3487566600u, -360, 1},
+	{"America/Denver", 3508736399u, -420, 0},
+	{"America/Denver", 3508736400u, -360, 1},
+	{"America/Denver", 3503291400u, -420, 0},
+	{"America/Denver", 3529295999u, -360, 1},
+	{"America/Denver", 3529296000u, -420, 0},
+	{"America/Denver", 3519016200u, -360, 1},
+	{"America/Denver", 3540185999u, -420, 0},
+	{"America/Denver", 3540186000u, -360, 1},
+	{"America/Denver", 3534741000u, -420, 0},
+	{"America/Denver", 3560745599u, -360, 1},
+	{"America/Denver", 3560745600u, -420, 0},
+	{"America/Denver", 3550465800u, -360, 1},
+	{"America/Denver", 3572240399u, -420, 0},
+	{"America/Denver", 3572240400u, -360, 1},
+	{"America/Denver", 3566493000u, -420, 0},
+	{"America/Denver", 3592799999u, -360, 1},
+	{"America/Denver", 3592800000u, -420, 0},
+	{"America/Denver", 3582520200u, -360, 1},
+	{"America/Denver", 3603689999u, -420, 0},
+	{"America/Denver", 3603690000u, -360, 1},
+	{"America/Denver", 3598245000u, -420, 0},
+	{"America/Denver", 3624249599u, -360, 1},
+	{"America/Denver", 3624249600u, -420, 0},
+	{"America/Denver", 3613969800u, -360, 1},
+	{"America/Denver", 3635139599u, -420, 0},
+	{"America/Denver", 3635139600u, -360, 1},
+	{"America/Denver", 3629694600u, -420, 0},
+	{"America/Denver", 3655699199u, -360, 1},
+	{"America/Denver", 3655699200u, -420, 0},
+	{"America/Denver", 3645419400u, -360, 1},
+	{"America/Denver", 3666589199u, -420, 0},
+	{"America/Denver", 3666589200u, -360, 1},
+	{"America/Denver", 3661144200u, -420, 0},
+	{"America/Denver", 3687148799u, -360, 1},
+	{"America/Denver", 3687148800u, -420, 0},
+	{"America/Denver", 3676869000u, -360, 1},
+	{"America/Denver", 3698038799u, -420, 0},
+	{"America/Denver", 3698038800u, -360, 1},
+	{"America/Denver", 3692593800u, -420, 0},
+	{"America/Denver", 3718598399u, -360, 1},
+	{"America/Denver", 3718598400u, -420, 0},
+	{"America/Denver", 3708318600u, -360, 1},
+	{"America/Denver", 3730093199u, -420, 0},
+	{"America/Denver", 3730093200u, -360, 1},
+	{"America/Denver", 3724345800u, -420, 0},
+	{"America/Denver", 3750652799u, -360, 1},
+	{"America/Denver", 3750652800u, -420, 0},
+	{"America/Denver", 3740373000u, -360, 1},
+	{"America/Denver", 3761542799u, -420, 0},
+	{"America/Denver", 3761542800u, -360, 1},
+	{"America/Denver", 3756097800u, -420, 0},
+	{"America/Denver", 3782102399u, -360, 1},
+	{"America/Denver", 3782102400u, -420, 0},
+	{"America/Denver", 3771822600u, -360, 1},
+	{"America/Denver", 3792992399u, -420, 0},
+	{"America/Denver", 3792992400u, -360, 1},
+	{"America/Denver", 3787547400u, -420, 0},
+	{"America/Denver", 3813551999u, -360, 1},
+	{"America/Denver", 3813552000u, -420, 0},
+	{"America/Denver", 3803272200u, -360, 1},
+	{"America/Denver", 3824441999u, -420, 0},
+	{"America/Denver", 3824442000u, -360, 1},
+	{"America/Denver", 3818997000u, -420, 0},
+	{"America/Denver", 3845001599u, -360, 1},
+	{"America/Denver", 3845001600u, -420, 0},
+	{"America/Denver", 3834721800u, -360, 1},
+	{"America/Denver", 3855891599u, -420, 0},
+	{"America/Denver", 3855891600u, -360, 1},
+	{"America/Denver", 3850446600u, -420, 0},
+	{"America/Denver", 3876451199u, -360, 1},
+	{"America/Denver", 3876451200u, -420, 0},
+	{"America/Denver", 3866171400u, -360, 1},
+	{"America/Denver", 3887341199u, -420, 0},
+	{"America/Denver", 3887341200u, -360, 1},
+	{"America/Denver", 3881896200u, -420, 0},
+	{"America/Denver", 3907900799u, -360, 1},
+	{"America/Denver", 3907900800u, -420, 0},
+	{"America/Denver", 3897621000u, -360, 1},
+	{"America/Denver", 3919395599u, -420, 0},
+	{"America/Denver", 3919395600u, -360, 1},
+	{"America/Denver", 3913648200u, -420, 0},
+	{"America/Denver", 3939955199u, -360, 1},
+	{"America/Denver", 3939955200u, -420, 0},
+	{"America/Denver", 3929675400u, -360, 1},
+	{"America/Denver", 3950845199u, -420, 0},
+	{"America/Denver", 3950845200u, -360, 1},
+	{"America/Denver", 3945400200u, -420, 0},
+	{"America/Denver", 3971404799u, -360, 1},
+	{"America/Denver", 3971404800u, -420, 0},
+	{"America/Denver", 3961125000u, -360, 1},
+	{"America/Denver", 3982294799u, -420, 0},
+	{"America/Denver", 3982294800u, -360, 1},
+	{"America/Denver", 3976849800u, -420, 0},
+	{"America/Denver", 4002854399u, -360, 1},
+	{"America/Denver", 4002854400u, -420, 0},
+	{"America/Denver", 3992574600u, -360, 1},
+	{"America/Denver", 4013744399u, -420, 0},
+	{"America/Denver", 4013744400u, -360, 1},
+	{"America/Denver", 4008299400u, -420, 0},
+	{"America/Denver", 4034303999u, -360, 1},
+	{"America/Denver", 4034304000u, -420, 0},
+	{"America/Denver", 4024024200u, -360, 1},
+	{"America/Denver", 4045193999u, -420, 0},
+	{"America/Denver", 4045194000u, -360, 1},
+	{"America/Denver", 4039749000u, -420, 0},
+	{"America/Denver", 4065753599u, -360, 1},
+	{"America/Denver", 4065753600u, -420, 0},
+	{"America/Denver", 4055473800u, -360, 1},
+	{"America/Denver", 4076643599u, -420, 0},
+	{"America/Denver", 4076643600u, -360, 1},
+	{"America/Denver", 4071198600u, -420, 0},
+	{"America/Denver", 4097203199u, -360, 1},
+	{"America/Denver", 4097203200u, -420, 0},
+	{"America/Denver", 4086923400u, -360, 1},
+	{"America/Denver", 4108697999u, -420, 0},
+	{"America/Denver", 4108698000u, -360, 1},
+	{"America/Denver", 4102950600u, -420, 0},
+	{"America/Denver", 4129257599u, -360, 1},
+	{"America/Denver", 4129257600u, -420, 0},
+	{"America/Denver", 4118977800u, -360, 1},
+	{"America/Denver", 4140147599u, -420, 0},
+	{"America/Denver", 4140147600u, -360, 1},
+	{"America/Denver", 4134702600u, -420, 0},
+	{"America/Denver", 4160707199u, -360, 1},
+	{"America/Denver", 4160707200u, -420, 0},
+	{"America/Denver", 4150427400u, -360, 1},
+	{"America/Denver", 4171597199u, -420, 0},
+	{"America/Denver", 4171597200u, -360, 1},
+	{"America/Denver", 4166152200u, -420, 0},
+	{"America/Denver", 4192156799u, -360, 1},
+	{"America/Denver", 4192156800u, -420, 0},
+	{"America/Denver", 4181877000u, -360, 1},
+	{"America/Denver", 4203046799u, -420, 0},
+	{"America/Denver", 4203046800u, -360, 1},
+	{"America/Denver", 4197601800u, -420, 0},
+	{"America/Denver", 4223606399u, -360, 1},
+	{"America/Denver", 4223606400u, -420, 0},
+	{"America/Denver", 4213326600u, -360, 1},
+	{"America/Denver", 4234496399u, -420, 0},
+	{"America/Denver", 4234496400u, -360, 1},
+	{"America/Denver", 4229051400u, -420, 0},
+	{"America/Denver", 4255055999u, -360, 1},
+	{"America/Denver", 4255056000u, -420, 0},
+	{"America/Denver", 4244776200u, -360, 1},
+	{"America/Denver", 4265945999u, -420, 0},
+	{"America/Denver", 4265946000u, -360, 1},
+	{"America/Denver", 4260501000u, -420, 0},
+	{"America/Denver", 4286505599u, -360, 1},
+	{"America/Denver", 4286505600u, -420, 0},
+	{"America/Denver", 4276225800u, -360, 1},
+	{"America/Denver", 4294967295u, -420, 0},
+	// America/Los_Angeles
+	{"America/Los_Angeles", 1262304000u, -480, 0},
+	{"America/Los_Angeles", 1268560799u, -480, 0},
+	{"America/Los_Angeles", 1268560800u, -420, 1},
+	{"America/Los_Angeles", 1265432400u, -480, 0},
+	{"America/Los_Angeles", 1289120399u, -420, 1},
+	{"America/Los_Angeles", 1289120400u, -480, 0},
+	{"America/Los_Angeles", 1278840600u, -420, 1},
+	{"America/Los_Angeles", 1300010399u, -480, 0},
+	{"America/Los_Angeles", 1300010400u, -420, 1},
+	{"America/Los_Angeles", 1294565400u, -480, 0},
+	{"America/Los_Angeles", 1320569999u, -420, 1},
+	{"America/Los_Angeles", 1320570000u, -480, 0},
+	{"America/Los_Angeles", 1310290200u, -420, 1},
+	{"America/Los_Angeles", 1331459999u, -480, 0},
+	{"America/Los_Angeles", 1331460000u, -420, 1},
+	{"America/Los_Angeles", 1326015000u, -480, 0},
+	{"America/Los_Angeles", 1352019599u, -420, 1},
+	{"America/Los_Angeles", 1352019600u, -480, 0},
+	{"America/Los_Angeles", 1341739800u, -420, 1},
+	{"America/Los_Angeles", 1362909599u, -480, 0},
+	{"America/Los_Angeles", 1362909600u, -420, 1},
+	{"America/Los_Angeles", 1357464600u, -480, 0},
+	{"America/Los_Angeles", 1383469199u, -420, 1},
+	{"America/Los_Angeles", 1383469200u, -480, 0},
+	{"America/Los_Angeles", 1373189400u, -420, 1},
+	{"America/Los_Angeles", 1394359199u, -480, 0},
+	{"America/Los_Angeles", 1394359200u, -420, 1},
+	{"America/Los_Angeles", 1388914200u, -480, 0},
+	{"America/Los_Angeles", 1414918799u, -420, 1},
+	{"America/Los_Angeles", 1414918800u, -480, 0},
+	{"America/Los_Angeles", 1404639000u, -420, 1},
+	{"America/Los_Angeles", 1425808799u, -480, 0},
+	{"America/Los_Angeles", 1425808800u, -420, 1},
+	{"America/Los_Angeles", 1420363800u, -480, 0},
+	{"America/Los_Angeles", 1446368399u, -420, 1},
+	{"America/Los_Angeles", 1446368400u, -480, 0},
+	{"America/Los_Angeles", 1436088600u, -420, 1},
+	{"America/Los_Angeles", 1457863199u, -480, 0},
+	{"America/Los_Angeles", 1457863200u, -420, 1},
+	{"America/Los_Angeles", 1452115800u, -480, 0},
+	{"America/Los_Angeles", 1478422799u, -420, 1},
+	{"America/Los_Angeles", 1478422800u, -480, 0},
+	{"America/Los_Angeles", 1468143000u, -420, 1},
+	{"America/Los_Angeles", 1489312799u, -480, 0},
+	{"America/Los_Angeles", 1489312800u, -420, 1},
+	{"America/Los_Angeles", 1483867800u, -480, 0},
+	{"America/Los_Angeles", 1509872399u, -420, 1},
+	{"America/Los_Angeles", 1509872400u, -480, 0},
+	{"America/Los_Angeles", 1499592600u, -420, 1},
+	{"America/Los_Angeles", 1520762399u, -480, 0},
+	{"America/Los_Angeles", 1520762400u, -420, 1},
+	{"America/Los_Angeles", 1515317400u, -480, 0},
+	{"America/Los_Angeles", 1541321999u, -420, 1},
+	{"America/Los_Angeles", 1541322000u, -480, 0},
+	{"America/Los_Angeles", 1531042200u, -420, 1},
+	{"America/Los_Angeles", 1552211999u, -480, 0},
+	{"America/Los_Angeles", 1552212000u, -420, 1},
+	{"America/Los_Angeles", 1546767000u, -480, 0},
+	{"America/Los_Angeles", 1572771599u, -420, 1},
+	{"America/Los_Angeles", 1572771600u, -480, 0},
+	{"America/Los_Angeles", 1562491800u, -420, 1},
+	{"America/Los_Angeles", 1583661599u, -480, 0},
+	{"America/Los_Angeles", 1583661600u, -420, 1},
+	{"America/Los_Angeles", 1578216600u, -480, 0},
+	{"America/Los_Angeles", 1604221199u, -420, 1},
+	{"America/Los_Angeles", 1604221200u, -480, 0},
+	{"America/Los_Angeles", 1593941400u, -420, 1},
+	{"America/Los_Angeles", 1615715999u, -480, 0},
+	{"America/Los_Angeles", 1615716000u, -420, 1},
+	{"America/Los_Angeles", 1609968600u, -480, 0},
+	{"America/Los_Angeles", 1636275599u, -420, 1},
+	{"America/Los_Angeles", 1636275600u, -480, 0},
+	{"America/Los_Angeles", 1625995800u, -420, 1},
+	{"America/Los_Angeles", 1647165599u, -480, 0},
+	{"America/Los_Angeles", 1647165600u, -420, 1},
+	{"America/Los_Angeles", 1641720600u, -480, 0},
+	{"America/Los_Angeles", 1667725199u, -420, 1},
+	{"America/Los_Angeles", 1667725200u, -480, 0},
+	{"America/Los_Angeles", 1657445400u, -420, 1},
+	{"America/Los_Angeles", 1678615199u, -480, 0},
+	{"America/Los_Angeles", 1678615200u, -420, 1},
+	{"America/Los_Angeles", 1673170200u, -480, 0},
+	{"America/Los_Angeles", 1699174799u, -420, 1},
+	{"America/Los_Angeles", 1699174800u, -480, 0},
+	{"America/Los_Angeles", 1688895000u, -420, 1},
+	{"America/Los_Angeles", 1710064799u, -480, 0},
+	{"America/Los_Angeles", 1710064800u, -420, 1},
+	{"America/Los_Angeles", 1704619800u, -480, 0},
+	{"America/Los_Angeles", 1730624399u, -420, 1},
+	{"America/Los_Angeles", 1730624400u, -480, 0},
+	{"America/Los_Angeles", 1720344600u, -420, 1},
+	{"America/Los_Angeles", 1741514399u, -480, 0},
+	{"America/Los_Angeles", 1741514400u, -420, 1},
+	{"America/Los_Angeles", 1736069400u, -480, 0},
+	{"America/Los_Angeles", 1762073999u, -420, 1},
+	{"America/Los_Angeles", 1762074000u, -480, 0},
+	{"America/Los_Angeles", 1751794200u, -420, 1},
+	{"America/Los_Angeles", 1772963999u, -480, 0},
+	{"America/Los_Angeles", 1772964000u, -420, 1},
+	{"America/Los_Angeles", 1767519000u, -480, 0},
+	{"America/Los_Angeles", 1793523599u, -420, 1},
+	{"America/Los_Angeles", 1793523600u, -480, 0},
+	{"America/Los_Angeles", 1783243800u, -420, 1},
+	{"America/Los_Angeles", 1805018399u, -480, 0},
+	{"America/Los_Angeles", 1805018400u, -420, 1},
+	{"America/Los_Angeles", 1799271000u, -480, 0},
+	{"America/Los_Angeles", 1825577999u, -420, 1},
+	{"America/Los_Angeles", 1825578000u, -480, 0},
+	{"America/Los_Angeles", 1815298200u, -420, 1},
+	{"America/Los_Angeles", 1836467999u, -480, 0},
+	{"America/Los_Angeles", 1836468000u, -420, 1},
+	{"America/Los_Angeles", 1831023000u, -480, 0},
+	{"America/Los_Angeles", 1857027599u, -420, 1},
+	{"America/Los_Angeles", 1857027600u, -480, 0},
+	{"America/Los_Angeles", 1846747800u, -420, 1},
+	{"America/Los_Angeles", 1867917599u, -480, 0},
+	{"America/Los_Angeles", 1867917600u, -420, 1},
+	{"America/Los_Angeles", 1862472600u, -480, 0},
+	{"America/Los_Angeles", 1888477199u, -420, 1},
+	{"America/Los_Angeles", 1888477200u, -480, 0},
+	{"America/Los_Angeles", 1878197400u, -420, 1},
+	{"America/Los_Angeles", 1899367199u, -480, 0},
+	{"America/Los_Angeles", 1899367200u, -420, 1},
+	{"America/Los_Angeles", 1893922200u, -480, 0},
+	{"America/Los_Angeles", 1919926799u, -420, 1},
+	{"America/Los_Angeles", 1919926800u, -480, 0},
+	{"America/Los_Angeles", 1909647000u, -420, 1},
+	{"America/Los_Angeles", 1930816799u, -480, 0},
+	{"America/Los_Angeles", 1930816800u, -420, 1},
+	{"America/Los_Angeles", 1925371800u, -480, 0},
+	{"America/Los_Angeles", 1951376399u, -420, 1},
+	{"America/Los_Angeles", 1951376400u, -480, 0},
+	{"America/Los_Angeles", 1941096600u, -420, 1},
+	{"America/Los_Angeles", 1962871199u, -480, 0},
+	{"America/Los_Angeles", 1962871200u, -420, 1},
+	{"America/Los_Angeles", 1957123800u, -480, 0},
+	{"America/Los_Angeles", 1983430799u, -420, 1},
+	{"America/Los_Angeles", 1983430800u, -480, 0},
+	{"America/Los_Angeles", 1973151000u, -420, 1},
+	{"America/Los_Angeles", 1994320799u, -480, 0},
+	{"America/Los_Angeles", 1994320800u, -420, 1},
+	{"America/Los_Angeles", 1988875800u, -480, 0},
+	{"America/Los_Angeles", 2014880399u, -420, 1},
+	{"America/Los_Angeles", 2014880400u, -480, 0},
+	{"America/Los_Angeles", 2004600600u, -420, 1},
+	{"America/Los_Angeles", 2025770399u, -480, 0},
+	{"America/Los_Angeles", 2025770400u, -420, 1},
+	{"America/Los_Angeles", 2020325400u, -480, 0},
+	{"America/Los_Angeles", 2046329999u, -420, 1},
+	{"America/Los_Angeles", 2046330000u, -480, 0},
+	{"America/Los_Angeles", 2036050200u, -420, 1},
+	{"America/Los_Angeles", 2057219999u, -480, 0},
+	{"America/Los_Angeles", 2057220000u, -420, 1},
+	{"America/Los_Angeles", 2051775000u, -480, 0},
+	{"America/Los_Angeles", 2077779599u, -420, 1},
+	{"America/Los_Angeles", 2077779600u, -480, 0},
+	{"America/Los_Angeles", 2067499800u, -420, 1},
+	{"America/Los_Angeles", 2088669599u, -480, 0},
+	{"America/Los_Angeles", 2088669600u, -420, 1},
+	{"America/Los_Angeles", 2083224600u, -480, 0},
+	{"America/Los_Angeles", 2109229199u, -420, 1},
+	{"America/Los_Angeles", 2109229200u, -480, 0},
+	{"America/Los_Angeles", 2098949400u, -420, 1},
+	{"America/Los_Angeles", 2120119199u, -480, 0},
+	{"America/Los_Angeles", 2120119200u, -420, 1},
+	{"America/Los_Angeles", 2114674200u, -480, 0},
+	{"America/Los_Angeles", 2140678799u, -420, 1},
+	{"America/Los_Angeles", 2140678800u, -480, 0},
+	{"America/Los_Angeles", 2130399000u, -420, 1},
+	{"America/Los_Angeles", 2152173599u, -480, 0},
+	{"America/Los_Angeles", 2152173600u, -420, 1},
+	{"America/Los_Angeles", 2146426200u, -480, 0},
+	{"America/Los_Angeles", 2172733199u, -420, 1},
+	{"America/Los_Angeles", 2172733200u, -480, 0},
+	{"America/Los_Angeles", 2162453400u, -420, 1},
+	{"America/Los_Angeles", 2183623199u, -480, 0},
+	{"America/Los_Angeles", 2183623200u, -420, 1},
+	{"America/Los_Angeles", 2178178200u, -480, 0},
+	{"America/Los_Angeles", 2204182799u, -420, 1},
+	{"America/Los_Angeles", 2204182800u, -480, 0},
+	{"America/Los_Angeles", 2193903000u, -420, 1},
+	{"America/Los_Angeles", 2215072799u, -480, 0},
+	{"America/Los_Angeles", 2215072800u, -420, 1},
+	{"America/Los_Angeles", 2209627800u, -480, 0},
+	{"America/Los_Angeles", 2235632399u, -420, 1},
+	{"America/Los_Angeles", 2235632400u, -480, 0},
+	{"America/Los_Angeles", 2225352600u, -420, 1},
+	{"America/Los_Angeles", 2246522399u, -480, 0},
+	{"America/Los_Angeles", 2246522400u, -420, 1},
+	{"America/Los_Angeles", 2241077400u, -480, 0},
+	{"America/Los_Angeles", 2267081999u, -420, 1},
+	{"America/Los_Angeles", 2267082000u, -480, 0},
+	{"America/Los_Angeles", 2256802200u, -420, 1},
+	{"America/Los_Angeles", 2277971999u, -480, 0},
+	{"America/Los_Angeles", 2277972000u, -420, 1},
+	{"America/Los_Angeles", 2272527000u, -480, 0},
+	{"America/Los_Angeles", 2298531599u, -420, 1},
+	{"America/Los_Angeles", 2298531600u, -480, 0},
+	{"America/Los_Angeles", 2288251800u, -420, 1},
+	{"America/Los_Angeles", 2309421599u, -480, 0},
+	{"America/Los_Angeles", 2309421600u, -420, 1},
+	{"America/Los_Angeles", 2303976600u, -480, 0},
+	{"America/Los_Angeles", 2329981199u, -420, 1},
+	{"America/Los_Angeles", 2329981200u, -480, 0},
+	{"America/Los_Angeles", 2319701400u, -420, 1},
+	{"America/Los_Angeles", 2341475999u, -480, 0},
+	{"America/Los_Angeles", 2341476000u, -420, 1},
+	{"America/Los_Angeles", 2335728600u, -480, 0},
+	{"America/Los_Angeles", 2362035599u, -420, 1},
+	{"America/Los_Angeles", 2362035600u, -480, 0},
+	{"America/Los_Angeles", 2351755800u, -420, 1},
+	{"America/Los_Angeles", 2372925599u, -480, 0},
+	{"America/Los_Angeles", 2372925600u, -420, 1},
+	{"America/Los_Angeles", 2367480600u, -480, 0},
+	{"America/Los_Angeles", 2393485199u, -420, 1},
+	{"America/Los_Angeles", 2393485200u, -480, 0},
+	{"America/Los_Angeles", 2383205400u, -420, 1},
+	{"America/Los_Angeles", 2404375199u, -480, 0},
+	{"America/Los_Angeles", 2404375200u, -420, 1},
+	{"America/Los_Angeles", 2398930200u, -480, 0},
+	{"America/Los_Angeles", 2424934799u, -420, 1},
+	{"America/Los_Angeles", 2424934800u, -480, 0},
+	{"America/Los_Angeles", 2414655000u, -420, 1},
+	{"America/Los_Angeles", 2435824799u, -480, 0},
+	{"America/Los_Angeles", 2435824800u, -420, 1},
+	{"America/Los_Angeles", 2430379800u, -480, 0},
+	{"America/Los_Angeles", 2456384399u, -420, 1},
+	{"America/Los_Angeles", 2456384400u, -480, 0},
+	{"America/Los_Angeles", 2446104600u, -420, 1},
+	{"America/Los_Angeles", 2467274399u, -480, 0},
+	{"America/Los_Angeles", 2467274400u, -420, 1},
+	{"America/Los_Angeles", 2461829400u, -480, 0},
+	{"America/Los_Angeles", 2487833999u, -420, 1},
+	{"America/Los_Angeles", 2487834000u, -480, 0},
+	{"America/Los_Angeles", 2477554200u, -420, 1},
+	{"America/Los_Angeles", 2499328799u, -480, 0},
+	{"America/Los_Angeles", 2499328800u, -420, 1},
+	{"America/Los_Angeles", 2493581400u, -480, 0},
+	{"America/Los_Angeles", 2519888399u, -420, 1},
+	{"America/Los_Angeles", 2519888400u, -480, 0},
+	{"America/Los_Angeles", 2509608600u, -420, 1},
+	{"America/Los_Angeles", 2530778399u, -480, 0},
+	{"America/Los_Angeles", 2530778400u, -420, 1},
+	{"America/Los_Angeles", 2525333400u, -480, 0},
+	{"America/Los_Angeles", 2551337999u, -420, 1},
+	{"America/Los_Angeles", 2551338000u, -480, 0},
+	{"America/Los_Angeles", 2541058200u, -420, 1},
+	{"America/Los_Angeles", 2562227999u, -480, 0},
+	{"America/Los_Angeles", 2562228000u, -420, 1},
+	{"America/Los_Angeles", 2556783000u, -480, 0},
+	{"America/Los_Angeles", 2582787599u, -420, 1},
+	{"America/Los_Angeles", 2582787600u, -480, 0},
+	{"America/Los_Angeles", 2572507800u, -420, 1},
+	{"America/Los_Angeles", 2593677599u, -480, 0},
+	{"America/Los_Angeles", 2593677600u, -420, 1},
+	{"America/Los_Angeles", 2588232600u, -480, 0},
+	{"America/Los_Angeles", 2614237199u, -420, 1},
+	{"America/Los_Angeles", 2614237200u, -480, 0},
+	{"America/Los_Angeles", 2603957400u, -420, 1},
+	{"America/Los_Angeles", 2625127199u, -480, 0},
+	{"America/Los_Angeles", 2625127200u, -420, 1},
+	{"America/Los_Angeles", 2619682200u, -480, 0},
+	{"America/Los_Angeles", 2645686799u, -420, 1},
+	{"America/Los_Angeles", 2645686800u, -480, 0},
+	{"America/Los_Angeles", 2635407000u, -420, 1},
+	{"America/Los_Angeles", 2656576799u, -480, 0},
+	{"America/Los_Angeles", 2656576800u, -420, 1},
+	{"America/Los_Angeles", 2651131800u, -480, 0},
+	{"America/Los_Angeles", 2677136399u, -420, 1},
+	{"America/Los_Angeles", 2677136400u, -480, 0},
+	{"America/Los_Angeles", 2666856600u, -420, 1},
+	{"America/Los_Angeles", 2688631199u, -480, 0},
+	{"America/Los_Angeles", 2688631200u, -420, 1},
+	{"America/Los_Angeles", 2682883800u, -480, 0},
+	{"America/Los_Angeles", 2709190799u, -420, 1},
+	{"America/Los_Angeles", 2709190800u, -480, 0},
+	{"America/Los_Angeles", 2698911000u, -420, 1},
+	{"America/Los_Angeles", 2720080799u, -480, 0},
+	{"America/Los_Angeles", 2720080800u, -420, 1},
+	{"America/Los_Angeles", 2714635800u, -480, 0},
+	{"America/Los_Angeles", 2740640399u, -420, 1},
+	{"America/Los_Angeles", 2740640400u, -480, 0},
+	{"America/Los_Angeles", 2730360600u, -420, 1},
+	{"America/Los_Angeles", 2751530399u, -480, 0},
+	{"America/Los_Angeles", 2751530400u, -420, 1},
+	{"America/Los_Angeles", 2746085400u, -480, 0},
+	{"America/Los_Angeles", 2772089999u, -420, 1},
+	{"America/Los_Angeles", 2772090000u, -480, 0},
+	{"America/Los_Angeles", 2761810200u, -420, 1},
+	{"America/Los_Angeles", 2782979999u, -480, 0},
+	{"America/Los_Angeles", 2782980000u, -420, 1},
+	{"America/Los_Angeles", 2777535000u, -480, 0},
+	{"America/Los_Angeles", 2803539599u, -420, 1},
+	{"America/Los_Angeles", 2803539600u, -480, 0},
+	{"America/Los_Angeles", 2793259800u, -420, 1},
+	{"America/Los_Angeles", 2814429599u, -480, 0},
+	{"America/Los_Angeles", 2814429600u, -420, 1},
+	{"America/Los_Angeles", 2808984600u, -480, 0},
+	{"America/Los_Angeles", 2834989199u, -420, 1},
+	{"America/Los_Angeles", 2834989200u, -480, 0},
+	{"America/Los_Angeles", 2824709400u, -420, 1},
+	{"America/Los_Angeles", 2846483999u, -480, 0},
+	{"America/Los_Angeles", 2846484000u, -420, 1},
+	{"America/Los_Angeles", 2840736600u, -480, 0},
+	{"America/Los_Angeles", 2867043599u, -420, 1},
+	{"America/Los_Angeles", 2867043600u, -480, 0},
+	{"America/Los_Angeles", 2856763800u, -420, 1},
+	{"America/Los_Angeles", 2877933599u, -480, 0},
+	{"America/Los_Angeles", 2877933600u, -420, 1},
+	{"America/Los_Angeles", 2872488600u, -480, 0},
+	{"America/Los_Angeles", 2898493199u, -420, 1},
+	{"America/Los_Angeles", 2898493200u, -480, 0},
+	{"America/Los_Angeles", 2888213400u, -420, 1},
+	{"America/Los_Angeles", 2909383199u, -480, 0},
+	{"America/Los_Angeles", 2909383200u, -420, 1},
+	{"America/Los_Angeles", 2903938200u, -480, 0},
+	{"America/Los_Angeles", 2929942799u, -420, 1},
+	{"America/Los_Angeles", 2929942800u, -480, 0},
+	{"America/Los_Angeles", 2919663000u, -420, 1},
+	{"America/Los_Angeles", 2940832799u, -480, 0},
+	{"America/Los_Angeles", 2940832800u, -420, 1},
+	{"America/Los_Angeles", 2935387800u, -480, 0},
+	{"America/Los_Angeles", 2961392399u, -420, 1},
+	{"America/Los_Angeles", 2961392400u, -480, 0},
+	{"America/Los_Angeles", 2951112600u, -420, 1},
+	{"America/Los_Angeles", 2972282399u, -480, 0},
+	{"America/Los_Angeles", 2972282400u, -420, 1},
+	{"America/Los_Angeles", 2966837400u, -480, 0},
+	{"America/Los_Angeles", 2992841999u, -420, 1},
+	{"America/Los_Angeles", 2992842000u, -480, 0},
+	{"America/Los_Angeles", 2982562200u, -420, 1},
+	{"America/Los_Angeles", 3003731999u, -480, 0},
+	{"America/Los_Angeles", 3003732000u, -420, 1},
+	{"America/Los_Angeles", 2998287000u, -480, 0},
+	{"America/Los_Angeles", 3024291599u, -420, 1},
+	{"America/Los_Angeles", 3024291600u, -480, 0},
+	{"America/Los_Angeles", 3014011800u, -420, 1},
+	{"America/Los_Angeles", 3035786399u, -480, 0},
+	{"America/Los_Angeles", 3035786400u, -420, 1},
+	{"America/Los_Angeles", 3030039000u, -480, 0},
+	{"America/Los_Angeles", 3056345999u, -420, 1},
+	{"America/Los_Angeles", 3056346000u, -480, 0},
+	{"America/Los_Angeles", 3046066200u, -420, 1},
+	{"America/Los_Angeles", 3067235999u, -480, 0},
+	{"America/Los_Angeles", 3067236000u, -420, 1},
+	{"America/Los_Angeles", 3061791000u, -480, 0},
+	{"America/Los_Angeles", 3087795599u, -420, 1},
+	{"America/Los_Angeles", 3087795600u, -480, 0},
+	{"America/Los_Angeles", 3077515800u, -420, 1},
+	{"America/Los_Angeles", 3098685599u, -480, 0},
+	{"America/Los_Angeles", 3098685600u, -420, 1},
+	{"America/Los_Angeles", 3093240600u, -480, 0},
+	{"America/Los_Angeles", 3119245199u, -420, 1},
+	{"America/Los_Angeles", 3119245200u, -480, 0},
+	{"America/Los_Angeles", 3108965400u, -420, 1},
+	{"America/Los_Angeles", 3130135199u, -480, 0},
+	{"America/Los_Angeles", 3130135200u, -420, 1},
+	{"America/Los_Angeles", 3124690200u, -480, 0},
+	{"America/Los_Angeles", 3150694799u, -420, 1},
+	{"America/Los_Angeles", 3150694800u, -480, 0},
+	{"America/Los_Angeles", 3140415000u, -420, 1},
+	{"America/Los_Angeles", 3161584799u, -480, 0},
+	{"America/Los_Angeles", 3161584800u, -420, 1},
+	{"America/Los_Angeles", 3156139800u, -480, 0},
+	{"America/Los_Angeles", 3182144399u, -420, 1},
+	{"America/Los_Angeles", 3182144400u, -480, 0},
+	{"America/Los_Angeles", 3171864600u, -420, 1},
+	{"America/Los_Angeles", 3193034399u, -480, 0},
+	{"America/Los_Angeles", 3193034400u, -420, 1},
+	{"America/Los_Angeles", 3187589400u, -480, 0},
+	{"America/Los_Angeles", 3213593999u, -420, 1},
+	{"America/Los_Angeles", 3213594000u, -480, 0},
+	{"America/Los_Angeles", 3203314200u, -420, 1},
+	{"America/Los_Angeles", 3225088799u, -480, 0},
+	{"America/Los_Angeles", 3225088800u, -420, 1},
+	{"America/Los_Angeles", 3219341400u, -480, 0},
+	{"America/Los_Angeles", 3245648399u, -420, 1},
+	{"America/Los_Angeles", 3245648400u, -480, 0},
+	{"America/Los_Angeles", 3235368600u, -420, 1},
+	{"America/Los_Angeles", 3256538399u, -480, 0},
+	{"America/Los_Angeles", 3256538400u, -420, 1},
+	{"America/Los_Angeles", 3251093400u, -480, 0},
+	{"America/Los_Angeles", 3277097999u, -420, 1},
+	{"America/Los_Angeles", 3277098000u, -480, 0},
+	{"America/Los_Angeles", 3266818200u, -420, 1},
+	{"America/Los_Angeles", 3287987999u, -480, 0},
+	{"America/Los_Angeles", 3287988000u, -420, 1},
+	{"America/Los_Angeles", 3282543000u, -480, 0},
+	{"America/Los_Angeles", 3308547599u, -420, 1},
+	{"America/Los_Angeles", 3308547600u, -480, 0},
+	{"America/Los_Angeles", 3298267800u, -420, 1},
+	{"America/Los_Angeles", 3319437599u, -480, 0},
+	{"America/Los_Angeles", 3319437600u, -420, 1},
+	{"America/Los_Angeles", 3313992600u, -480, 0},
+	{"America/Los_Angeles", 3339997199u, -420, 1},
+	{"America/Los_Angeles", 3339997200u, -480, 0},
+	{"America/Los_Angeles", 3329717400u, -420, 1},
+	{"America/Los_Angeles", 3350887199u, -480, 0},
+	{"America/Los_Angeles", 3350887200u, -420, 1},
+	{"America/Los_Angeles", 3345442200u, -480, 0},
+	{"America/Los_Angeles", 3371446799u, -420, 1},
+	{"America/Los_Angeles", 3371446800u, -480, 0},
+	{"America/Los_Angeles", 3361167000u, -420, 1},
+	{"America/Los_Angeles", 3382941599u, -480, 0},
+	{"America/Los_Angeles", 3382941600u, -420, 1},
+	{"America/Los_Angeles", 3377194200u, -480, 0},
+	{"America/Los_Angeles", 3403501199u, -420, 1},
+	{"America/Los_Angeles", 3403501200u, -480, 0},
+	{"America/Los_Angeles", 3393221400u, -420, 1},
+	{"America/Los_Angeles", 3414391199u, -480, 0},
+	{"America/Los_Angeles", 3414391200u, -420, 1},
+	{"America/Los_Angeles", 3408946200u, -480, 0},
+	{"America/Los_Angeles", 3434950799u, -420, 1},
+	{"America/Los_Angeles", 3434950800u, -480, 0},
+	{"America/Los_Angeles", 3424671000u, -420, 1},
+	{"America/Los_Angeles", 3445840799u, -480, 0},
+	{"America/Los_Angeles", 3445840800u, -420, 1},
+	{"America/Los_Angeles", 3440395800u, -480, 0},
+	{"America/Los_Angeles", 3466400399u, -420, 1},
+	{"America/Los_Angeles", 3466400400u, -480, 0},
+	{"America/Los_Angeles", 3456120600u, -420, 1},
+	{"America/Los_Angeles", 3477290399u, -480, 0},
+	{"America/Los_Angeles", 3477290400u, -420, 1},
+	{"America/Los_Angeles", 3471845400u, -480, 0},
+	{"America/Los_Angeles", 3497849999u, -420, 1},
+	{"America/Los_Angeles", 3497850000u, -480, 0},
+	{"America/Los_Angeles", 3487570200u, -420, 1},
+	{"America/Los_Angeles", 3508739999u, -480, 0},
+	{"America/Los_Angeles", 3508740000u, -420, 1},
+	{"America/Los_Angeles", 3503295000u, -480, 0},
+	{"America/Los_Angeles", 3529299599u, -420, 1},
+	{"America/Los_Angeles", 3529299600u, -480, 0},
+	{"America/Los_Angeles", 3519019800u, -420, 1},
+	{"America/Los_Angeles", 3540189599u, -480, 0},
+	{"America/Los_Angeles", 3540189600u, -420, 1},
+	{"America/Los_Angeles", 3534744600u, -480, 0},
+	{"America/Los_Angeles", 3560749199u, -420, 1},
+	{"America/Los_Angeles", 3560749200u, -480, 0},
+	{"America/Los_Angeles", 3550469400u, -420, 1},
+	{"America/Los_Angeles", 3572243999u, -480, 0},
+	{"America/Los_Angeles", 3572244000u, -420, 1},
+	{"America/Los_Angeles", 3566496600u, -480, 0},
+	{"America/Los_Angeles", 3592803599u, -420, 1},
+	{"America/Los_Angeles", 3592803600u, -480, 0},
+	{"America/Los_Angeles", 3582523800u, -420, 1},
+	{"America/Los_Angeles", 3603693599u, -480, 0},
+	{"America/Los_Angeles", 3603693600u, -420, 1},
+	{"America/Los_Angeles", 3598248600u, -480, 0},
+	{"America/Los_Angeles", 3624253199u, -420, 1},
+	{"America/Los_Angeles", 3624253200u, -480, 0},
+	{"America/Los_Angeles", 3613973400u, -420, 1},
+	{"America/Los_Angeles", 3635143199u, -480, 0},
+	{"America/Los_Angeles", 3635143200u, -420, 1},
+	{"America/Los_Angeles", 3629698200u, -480, 0},
+	{"America/Los_Angeles", 3655702799u, -420, 1},
+	{"America/Los_Angeles", 3655702800u, -480, 0},
+	{"America/Los_Angeles", 3645423000u, -420, 1},
+	{"America/Los_Angeles", 3666592799u, -480, 0},
+	{"America/Los_Angeles", 3666592800u, -420, 1},
+	{"America/Los_Angeles", 3661147800u, -480, 0},
+	{"America/Los_Angeles", 3687152399u, -420, 1},
+	{"America/Los_Angeles", 3687152400u, -480, 0},
+	{"America/Los_Angeles", 3676872600u, -420, 1},
+	{"America/Los_Angeles", 3698042399u, -480, 0},
+	{"America/Los_Angeles", 3698042400u, -420, 1},
+	{"America/Los_Angeles", 3692597400u, -480, 0},
+	{"America/Los_Angeles", 3718601999u, -420, 1},
+	{"America/Los_Angeles", 3718602000u, -480, 0},
+	{"America/Los_Angeles", 3708322200u, -420, 1},
+	{"America/Los_Angeles", 3730096799u, -480, 0},
+	{"America/Los_Angeles", 3730096800u, -420, 1},
+	{"America/Los_Angeles", 3724349400u, -480, 0},
+	{"America/Los_Angeles", 3750656399u, -420, 1},
+	{"America/Los_Angeles", 3750656400u, -480, 0},
+	{"America/Los_Angeles", 3740376600u, -420, 1},
+	{"America/Los_Angeles", 3761546399u, -480, 0},
+	{"America/Los_Angeles", 3761546400u, -420, 1},
+	{"America/Los_Angeles", 3756101400u, -480, 0},
+	{"America/Los_Angeles", 3782105999u, -420, 1},
+	{"America/Los_Angeles", 3782106000u, -480, 0},
+	{"America/Los_Angeles", 3771826200u, -420, 1},
+	{"America/Los_Angeles", 3792995999u, -480, 0},
+	{"America/Los_Angeles", 3792996000u, -420, 1},
+	{"America/Los_Angeles", 3787551000u, -480, 0},
+	{"America/Los_Angeles", 3813555599u, -420, 1},
+	{"America/Los_Angeles", 3813555600u, -480, 0},
+	{"America/Los_Angeles", 3803275800u, -420, 1},
+	{"America/Los_Angeles", 3824445599u, -480, 0},
+	{"America/Los_Angeles", 3824445600u, -420, 1},
+	{"America/Los_Angeles", 3819000600u, -480, 0},
+	{"America/Los_Angeles", 3845005199u, -420, 1},
+	{"America/Los_Angeles", 3845005200u, -480, 0},
+	{"America/Los_Angeles", 3834725400u, -420, 1},
+	{"America/Los_Angeles", 3855895199u, -480, 0},
+	{"America/Los_Angeles", 3855895200u, -420, 1},
+	{"America/Los_Angeles", 3850450200u, -480, 0},
+	{"America/Los_Angeles", 3876454799u, -420, 1},
+	{"America/Los_Angeles", 3876454800u, -480, 0},
+	{"America/Los_Angeles", 3866175000u, -420, 1},
+	{"America/Los_Angeles", 3887344799u, -480, 0},
+	{"America/Los_Angeles", 3887344800u, -420, 1},
+	{"America/Los_Angeles", 3881899800u, -480, 0},
+	{"America/Los_Angeles", 3907904399u, -420, 1},
+	{"America/Los_Angeles", 3907904400u, -480, 0},
+	{"America/Los_Angeles", 3897624600u, -420, 1},
+	{"America/Los_Angeles", 3919399199u, -480, 0},
+	{"America/Los_Angeles", 3919399200u, -420, 1},
+	{"America/Los_Angeles", 3913651800u, -480, 0},
+	{"America/Los_Angeles", 3939958799u, -420, 1},
+	{"America/Los_Angeles", 3939958800u, -480, 0},
+	{"America/Los_Angeles", 3929679000u, -420, 1},
+	{"America/Los_Angeles", 3950848799u, -480, 0},
+	{"America/Los_Angeles", 3950848800u, -420, 1},
+	{"America/Los_Angeles", 3945403800u, -480, 0},
+	{"America/Los_Angeles", 3971408399u, -420, 1},
+	{"America/Los_Angeles", 3971408400u, -480, 0},
+	{"America/Los_Angeles", 3961128600u, -420, 1},
+	{"America/Los_Angeles", 3982298399u, -480, 0},
+	{"America/Los_Angeles", 3982298400u, -420, 1},
+	{"America/Los_Angeles", 3976853400u, -480, 0},
+	{"America/Los_Angeles", 4002857999u, -420, 1},
+	{"America/Los_Angeles", 4002858000u, -480, 0},
+	{"America/Los_Angeles", 3992578200u, -420, 1},
+	{"America/Los_Angeles", 4013747999u, -480, 0},
+	{"America/Los_Angeles", 4013748000u, -420, 1},
+	{"America/Los_Angeles", 4008303000u, -480, 0},
+	{"America/Los_Angeles", 4034307599u, -420, 1},
+	{"America/Los_Angeles", 4034307600u, -480, 0},
+	{"America/Los_Angeles", 4024027800u, -420, 1},
+	{"America/Los_Angeles", 4045197599u, -480, 0},
+	{"America/Los_Angeles", 4045197600u, -420, 1},
+	{"America/Los_Angeles", 4039752600u, -480, 0},
+	{"America/Los_Angeles", 4065757199u, -420, 1},
+	{"America/Los_Angeles", 4065757200u, -480, 0},
+	{"America/Los_Angeles", 4055477400u, -420, 1},
+	{"America/Los_Angeles", 4076647199u, -480, 0},
+	{"America/Los_Angeles", 4076647200u, -420, 1},
+	{"America/Los_Angeles", 4071202200u, -480, 0},
+	{"America/Los_Angeles", 4097206799u, -420, 1},
+	{"America/Los_Angeles", 4097206800u, -480, 0},
+	{"America/Los_Angeles", 4086927000u, -420, 1},
+	{"America/Los_Angeles", 4108701599u, -480, 0},
+	{"America/Los_Angeles", 4108701600u, -420, 1},
+	{"America/Los_Angeles", 4102954200u, -480, 0},
+	{"America/Los_Angeles", 4129261199u, -420, 1},
+	{"America/Los_Angeles", 4129261200u, -480, 0},
+	{"America/Los_Angeles", 4118981400u, -420, 1},
+	{"America/Los_Angeles", 4140151199u, -480, 0},
+	{"America/Los_Angeles", 4140151200u, -420, 1},
+	{"America/Los_Angeles", 4134706200u, -480, 0},
+	{"America/Los_Angeles", 4160710799u, -420, 1},
+	{"America/Los_Angeles", 4160710800u, -480, 0},
+	{"America/Los_Angeles", 4150431000u, -420, 1},
+	{"America/Los_Angeles", 4171600799u, -480, 0},
+	{"America/Los_Angeles", 4171600800u, -420, 1},
+	{"America/Los_Angeles", 4166155800u, -480, 0},
+	{"America/Los_Angeles", 4192160399u, -420, 1},
+	{"America/Los_Angeles", 4192160400u, -480, 0},
+	{"America/Los_Angeles", 4181880600u, -420, 1},
+	{"America/Los_Angeles", 4203050399u, -480, 0},
+	{"America/Los_Angeles", 4203050400u, -420, 1},
+	{"America/Los_Angeles", 4197605400u, -480, 0},
+	{"America/Los_Angeles", 4223609999u, -420, 1},
+	{"America/Los_Angeles", 4223610000u, -480, 0},
+	{"America/Los_Angeles", 4213330200u, -420, 1},
+	{"America/Los_Angeles", 4234499999u, -480, 0},
+	{"America/Los_Angeles", 4234500000u, -420, 1},
+	{"America/Los_Angeles", 4229055000u, -480, 0},
+	{"America/Los_Angeles", 4255059599u, -420, 1},
+	{"America/Los_Angeles", 4255059600u, -480, 0},
+	{"America/Los_Angeles", 4244779800u, -420, 1},
+	{"America/Los_Angeles", 4265949599u, -480, 0},
+	{"America/Los_Angeles", 4265949600u, -420, 1},
+	{"America/Los_Angeles", 4260504600u, -480, 0},
+	{"America/Los_Angeles", 4286509199u, -420, 1},
+	{"America/Los_Angeles", 4286509200u, -480, 0},
+	{"America/Los_Angeles", 4276229400u, -420, 1},
+	{"America/Los_Angeles", 4294967295u, -480, 0},
+	// America/New_York
+	{"America/New_York", 1262304000u, -300, 0},
+	{"America/New_York", 1268549999u, -300, 0},
+	{"America/New_York", 1268550000u, -240, 1},
+	{"America/New_York", 1265427000u, -300, 0},
+	{"America/New_York", 1289109599u, -240, 1},
+	{"America/New_York", 1289109600u, -300, 0},
+	{"America/New_York", 1278829800u, -240, 1},
+	{"America/New_York", 1299999599u, -300, 0},
+	{"America/New_York", 1299999600u, -240, 1},
+	{"America/New_York", 1294554600u, -300, 0},
+	{"America/New_York", 1320559199u, -240, 1},
+	{"America/New_York", 1320559200u, -300, 0},
+	{"America/New_York", 1310279400u, -240, 1},
+	{"America/New_York", 1331449199u, -300, 0},
+	{"America/New_York", 1331449200u, -240, 1},
+	{"America/New_York", 1326004200u, -300, 0},
+	{"America/New_York", 1352008799u, -240, 1},
+	{"America/New_York", 1352008800u, -300, 0},
+	{"America/New_York", 1341729000u, -240, 1},
+	{"America/New_York", 1362898799u, -300, 0},
+	{"America/New_York", 1362898800u, -240, 1},
+	{"America/New_York", 1357453800u, -300, 0},
+	{"America/New_York", 1383458399u, -240, 1},
+	{"America/New_York", 1383458400u, -300, 0},
+	{"America/New_York", 1373178600u, -240, 1},
+	{"America/New_York", 1394348399u, -300, 0},
+	{"America/New_York", 1394348400u, -240, 1},
+	{"America/New_York", 1388903400u, -300, 0},
+	{"America/New_York", 1414907999u, -240, 1},
+	{"America/New_York", 1414908000u, -300, 0},
+	{"America/New_York", 1404628200u, -240, 1},
+	{"America/New_York", 1425797999u, -300, 0},
+	{"America/New_York", 1425798000u, -240, 1},
+	{"America/New_York", 1420353000u, -300, 0},
+	{"America/New_York", 1446357599u, -240, 1},
+	{"America/New_York", 1446357600u, -300, 0},
+	{"America/New_York", 1436077800u, -240, 1},
+	{"America/New_York", 1457852399u, -300, 0},
+	{"America/New_York", 1457852400u, -240, 1},
+	{"America/New_York", 1452105000u, -300, 0},
+	{"America/New_York", 1478411999u, -240, 1},
+	{"America/New_York", 1478412000u, -300, 0},
+	{"America/New_York", 1468132200u, -240, 1},
+	{"America/New_York", 1489301999u, -300, 0},
+	{"America/New_York", 1489302000u, -240, 1},
+	{"America/New_York", 1483857000u, -300, 0},
+	{"America/New_York", 1509861599u, -240, 1},
+	{"America/New_York", 1509861600u, -300, 0},
+	{"America/New_York", 1499581800u, -240, 1},
+	{"America/New_York", 1520751599u, -300, 0},
+	{"America/New_York", 1520751600u, -240, 1},
+	{"America/New_York", 1515306600u, -300, 0},
+	{"America/New_York", 1541311199u, -240, 1},
+	{"America/New_York", 1541311200u, -300, 0},
+	{"America/New_York", 1531031400u, -240, 1},
+	{"America/New_York", 1552201199u, -300, 0},
+	{"America/New_York", 1552201200u, -240, 1},
+	{"America/New_York", 1546756200u, -300, 0},
+	{"America/New_York", 1572760799u, -240, 1},
+	{"America/New_York", 1572760800u, -300, 0},
+	{"America/New_York", 1562481000u, -240, 1},
+	{"America/New_York", 1583650799u, -300, 0},
+	{"America/New_York", 1583650800u, -240, 1},
+	{"America/New_York", 1578205800u, -300, 0},
+	{"America/New_York", 1604210399u, -240, 1},
+	{"America/New_York", 1604210400u, -300, 0},
+	{"America/New_York", 1593930600u, -240, 1},
+	{"America/New_York", 1615705199u, -300, 0},
+	{"America/New_York", 1615705200u, -240, 1},
+	{"America/New_York", 1609957800u, -300, 0},
+	{"America/New_York", 1636264799u, -240, 1},
+	{"America/New_York", 1636264800u, -300, 0},
+	{"America/New_York", 1625985000u, -240, 1},
+	{"America/New_York", 1647154799u, -300, 0},
+	{"America/New_York", 1647154800u, -240, 1},
+	{"America/New_York", 1641709800u, -300, 0},
+	{"America/New_York", 1667714399u, -240, 1},
+	{"America/New_York", 1667714400u, -300, 0},
+	{"America/New_York", 1657434600u, -240, 1},
+	{"America/New_York", 1678604399u, -300, 0},
+	{"America/New_York", 1678604400u, -240, 1},
+	{"America/New_York", 1673159400u, -300, 0},
+	{"America/New_York", 1699163999u, -240, 1},
+	{"America/New_York", 1699164000u, -300, 0},
+	{"America/New_York", 1688884200u, -240, 1},
+	{"America/New_York", 1710053999u, -300, 0},
+	{"America/New_York", 1710054000u, -240, 1},
+	{"America/New_York", 1704609000u, -300, 0},
+	{"America/New_York", 1730613599u, -240, 1},
+	{"America/New_York", 1730613600u, -300, 0},
+	{"America/New_York", 1720333800u, -240, 1},
+	{"America/New_York", 1741503599u, -300, 0},
+	{"America/New_York", 1741503600u, -240, 1},
+	{"America/New_York", 1736058600u, -300, 0},
+	{"America/New_York", 1762063199u, -240, 1},
+	{"America/New_York", 1762063200u, -300, 0},
+	{"America/New_York", 1751783400u, -240, 1},
+	{"America/New_York", 1772953199u, -300, 0},
+	{"America/New_York", 1772953200u, -240, 1},
+	{"America/New_York", 1767508200u, -300, 0},
+	{"America/New_York", 1793512799u, -240, 1},
+	{"America/New_York", 1793512800u, -300, 0},
+	{"America/New_York", 1783233000u, -240, 1},
+	{"America/New_York", 1805007599u, -300, 0},
+	{"America/New_York", 1805007600u, -240, 1},
+	{"America/New_York", 1799260200u, -300, 0},
+	{"America/New_York", 1825567199u, -240, 1},
+	{"America/New_York", 1825567200u, -300, 0},
+	{"America/New_York", 1815287400u, -240, 1},
+	{"America/New_York", 1836457199u, -300, 0},
+	{"America/New_York", 1836457200u, -240, 1},
+	{"America/New_York", 1831012200u, -300, 0},
+	{"America/New_York", 1857016799u, -240, 1},
+	{"America/New_York", 1857016800u, -300, 0},
+	{"America/New_York", 1846737000u, -240, 1},
+	{"America/New_York", 1867906799u, -300, 0},
+	{"America/New_York", 1867906800u, -240, 1},
+	{"America/New_York", 1862461800u, -300, 0},
+	{"America/New_York", 1888466399u, -240, 1},
+	{"America/New_York", 1888466400u, -300, 0},
+	{"America/New_York", 1878186600u, -240, 1},
+	{"America/New_York", 1899356399u, -300, 0},
+	{"America/New_York", 1899356400u, -240, 1},
+	{"America/New_York", 1893911400u, -300, 0},
+	{"America/New_York", 1919915999u, -240, 1},
+	{"America/New_York", 1919916000u, -300, 0},
+	{"America/New_York", 1909636200u, -240, 1},
+	{"America/New_York", 1930805999u, -300, 0},
+	{"America/New_York", 1930806000u, -240, 1},
+	{"America/New_York", 1925361000u, -300, 0},
+	{"America/New_York", 1951365599u, -240, 1},
+	{"America/New_York", 1951365600u, -300, 0},
+	{"America/New_York", 1941085800u, -240, 1},
+	{"America/New_York", 1962860399u, -300, 0},
+	{"America/New_York", 1962860400u, -240, 1},
+	{"America/New_York", 1957113000u, -300, 0},
+	{"America/New_York", 1983419999u, -240, 1},
+	{"America/New_York", 1983420000u, -300, 0},
+	{"America/New_York", 1973140200u, -240, 1},
+	{"America/New_York", 1994309999u, -300, 0},
+	{"America/New_York", 1994310000u, -240, 1},
+	{"America/New_York", 1988865000u, -300, 0},
+	{"America/New_York", 2014869599u, -240, 1},
+	{"America/New_York", 2014869600u, -300, 0},
+	{"America/New_York", 2004589800u, -240, 1},
+	{"America/New_York", 2025759599u, -300, 0},
+	{"America/New_York", 2025759600u, -240, 1},
+	{"America/New_York", 2020314600u, -300, 0},
+	{"America/New_York", 2046319199u, -240, 1},
+	{"America/New_York", 2046319200u, -300, 0},
+	{"America/New_York", 2036039400u, -240, 1},
+	{"America/New_York", 2057209199u, -300, 0},
+	{"America/New_York", 2057209200u, -240, 1},
+	{"America/New_York", 2051764200u, -300, 0},
+	{"America/New_York", 2077768799u, -240, 1},
+	{"America/New_York", 2077768800u, -300, 0},
+	{"America/New_York", 2067489000u, -240, 1},
+	{"America/New_York", 2088658799u, -300, 0},
+	{"America/New_York", 2088658800u, -240, 1},
+	{"America/New_York", 2083213800u, -300, 0},
+	{"America/New_York", 2109218399u, -240, 1},
+	{"America/New_York", 2109218400u, -300, 0},
+	{"America/New_York", 2098938600u, -240, 1},
+	{"America/New_York", 2120108399u, -300, 0},
+	{"America/New_York", 2120108400u, -240, 1},
+	{"America/New_York", 2114663400u, -300, 0},
+	{"America/New_York", 2140667999u, -240, 1},
+	{"America/New_York", 2140668000u, -300, 0},
+	{"America/New_York", 2130388200u, -240, 1},
+	{"America/New_York", 2152162799u, -300, 0},
+	{"America/New_York", 2152162800u, -240, 1},
+	{"America/New_York", 2146415400u, -300, 0},
+	{"America/New_York", 2172722399u, -240, 1},
+	{"America/New_York", 2172722400u, -300, 0},
+	{"America/New_York", 2162442600u, -240, 1},
+	{"America/New_York", 2183612399u, -300, 0},
+	{"America/New_York", 2183612400u, -240, 1},
+	{"America/New_York", 2178167400u, -300, 0},
+	{"America/New_York", 2204171999u, -240, 1},
+	{"America/New_York", 2204172000u, -300, 0},
+	{"America/New_York", 2193892200u, -240, 1},
+	{"America/New_York", 2215061999u, -300, 0},
+	{"America/New_York", 2215062000u, -240, 1},
+	{"America/New_York", 2209617000u, -300, 0},
+	{"America/New_York", 2235621599u, -240, 1},
+	{"America/New_York", 2235621600u, -300, 0},
+	{"America/New_York", 2225341800u, -240, 1},
+	{"America/New_York", 2246511599u, -300, 0},
+	{"America/New_York", 2246511600u, -240, 1},
+	{"America/New_York", 2241066600u, -300, 0},
+	{"America/New_York", 2267071199u, -240, 1},
+	{"America/New_York", 2267071200u, -300, 0},
+	{"America/New_York", 2256791400u, -240, 1},
+	{"America/New_York", 2277961199u, -300, 0},
+	{"America/New_York", 2277961200u, -240, 1},
+	{"America/New_York", 2272516200u, -300, 0},
+	{"America/New_York", 2298520799u, -240, 1},
+	{"America/New_York", 2298520800u, -300, 0},
+	{"America/New_York", 2288241000u, -240, 1},
+	{"America/New_York", 2309410799u, -300, 0},
+	{"America/New_York", 2309410800u, -240, 1},
+	{"America/New_York", 2303965800u, -300, 0},
+	{"America/New_York", 2329970399u, -240, 1},
+	{"America/New_York", 2329970400u, -300, 0},
+	{"America/New_York", 2319690600u, -240, 1},
+	{"America/New_York", 2341465199u, -300, 0},
+	{"America/New_York", 2341465200u, -240, 1},
+	{"America/New_York", 2335717800u, -300, 0},
+	{"America/New_York", 2362024799u, -240, 1},
+	{"America/New_York", 2362024800u, -300, 0},
+	{"America/New_York", 2351745000u, -240, 1},
+	{"America/New_York", 2372914799u, -300, 0},
+	{"America/New_York", 2372914800u, -240, 1},
+	{"America/New_York", 2367469800u, -300, 0},
+	{"America/New_York", 2393474399u, -240, 1},
+	{"America/New_York", 2393474400u, -300, 0},
+	{"America/New_York", 2383194600u, -240, 1},
+	{"America/New_York", 2404364399u, -300, 0},
+	{"America/New_York", 2404364400u, -240, 1},
+	{"America/New_York", 2398919400u, -300, 0},
+	{"America/New_York", 2424923999u, -240, 1},
+	{"America/New_York", 2424924000u, -300, 0},
+	{"America/New_York", 2414644200u, -240, 1},
+	{"America/New_York", 2435813999u, -300, 0},
+	{"America/New_York", 2435814000u, -240, 1},
+	{"America/New_York", 2430369000u, -300, 0},
+	{"America/New_York", 2456373599u, -240, 1},
+	{"America/New_York", 2456373600u, -300, 0},
+	{"America/New_York", 2446093800u, -240, 1},
+	{"America/New_York", 2467263599u, -300, 0},
+	{"America/New_York", 2467263600u, -240, 1},
+	{"America/New_York", 2461818600u, -300, 0},
+	{"America/New_York", 2487823199u, -240, 1},
+	{"America/New_York", 2487823200u, -300, 0},
+	{"America/New_York", 2477543400u, -240, 1},
+	{"America/New_York", 2499317999u, -300, 0},
+	{"America/New_York", 2499318000u, -240, 1},
+	{"America/New_York", 2493570600u, -300, 0},
+	{"America/New_York", 2519877599u, -240, 1},
+	{"America/New_York", 2519877600u, -300, 0},
+	{"America/New_York", 2509597800u, -240, 1},
+	{"America/New_York", 2530767599u, -300, 0},
+	{"America/New_York", 2530767600u, -240, 1},
+	{"America/New_York", 2525322600u, -300, 0},
+	{"America/New_York", 2551327199u, -240, 1},
+	{"America/New_York", 2551327200u, -300, 0},
+	{"America/New_York", 2541047400u, -240, 1},
+	{"America/New_York", 2562217199u, -300, 0},
+	{"America/New_York", 2562217200u, -240, 1},
+	{"America/New_York", 2556772200u, -300, 0},
+	{"America/New_York", 2582776799u, -240, 1},
+	{"America/New_York", 2582776800u, -300, 0},
+	{"America/New_York", 2572497000u, -240, 1},
+	{"America/New_York", 2593666799u, -300, 0},
+	{"America/New_York", 2593666800u, -240, 1},
+	{"America/New_York", 2588221800u, -300, 0},
+	{"America/New_York", 2614226399u, -240, 1},
+	{"America/New_York", 2614226400u, -300, 0},
+	{"America/New_York", 2603946600u, -240, 1},
+	{"America/New_York", 2625116399u, -300, 0},
+	{"America/New_York", 2625116400u, -240, 1},
+	{"America/New_York", 2619671400u, -300, 0},
+	{"America/New_York", 2645675999u, -240, 1},
+	{"America/New_York", 2645676000u, -300, 0},
+	{"America/New_York", 2635396200u, -240, 1},
+	{"America/New_York", 2656565999u, -300, 0},
+	{"America/New_York", 2656566000u, -240, 1},
+	{"America/New_York", 2651121000u, -300, 0},
+	{"America/New_York", 2677125599u, -240, 1},
+	{"America/New_York", 2677125600u, -300, 0},
+	{"America/New_York", 2666845800u, -240, 1},
+	{"America/New_York", 2688620399u, -300, 0},
+	{"America/New_York", 2688620400u, -240, 1},
+	{"America/New_York", 2682873000u, -300, 0},
+	{"America/New_York", 2709179999u, -240, 1},
+	{"America/New_York", 2709180000u, -300, 0},
+	{"America/New_York", 2698900200u, -240, 1},
+	{"America/New_York", 2720069999u, -300, 0},
+	{"America/New_York", 2720070000u, -240, 1},
+	{"America/New_York", 2714625000u, -300, 0},
+	{"America/New_York", 2740629599u, -240, 1},
+	{"America/New_York", 2740629600u, -300, 0},
+	{"America/New_York", 2730349800u, -240, 1},
+	{"America/New_York", 2751519599u, -300, 0},
+	{"America/New_York", 2751519600u, -240, 1},
+	{"America/New_York", 2746074600u, -300, 0},
+	{"America/New_York", 2772079199u, -240, 1},
+	{"America/New_York", 2772079200u, -300, 0},
+	{"America/New_York", 2761799400u, -240, 1},
+	{"America/New_York", 2782969199u, -300, 0},
+	{"America/New_York", 2782969200u, -240, 1},
+	{"America/New_York", 2777524200u, -300, 0},
+	{"America/New_York", 2803528799u, -240, 1},
+	{"America/New_York", 2803528800u, -300, 0},
+	{"America/New_York", 2793249000u, -240, 1},
+	{"America/New_York", 2814418799u, -300, 0},
+	{"America/New_York", 2814418800u, -240, 1},
+	{"America/New_York", 2808973800u, -300, 0},
+	{"America/New_York", 2834978399u, -240, 1},
+	{"America/New_York", 2834978400u, -300, 0},
+	{"America/New_York", 2824698600u, -240, 1},
+	{"America/New_York", 2846473199u, -300, 0},
+	{"America/New_York", 2846473200u, -240, 1},
+	{"America/New_York", 2840725800u, -300, 0},
+	{"America/New_York", 2867032799u, -240, 1},
+	{"America/New_York", 2867032800u, -300, 0},
+	{"America/New_York", 2856753000u, -240, 1},
+	{"America/New_York", 2877922799u, -300, 0},
+	{"America/New_York", 2877922800u, -240, 1},
+	{"America/New_York", 2872477800u, -300, 0},
+	{"America/New_York", 2898482399u, -240, 1},
+	{"America/New_York", 2898482400u, -300, 0},
+	{"America/New_York", 2888202600u, -240, 1},
+	{"America/New_York", 2909372399u, -300, 0},
+	{"America/New_York", 2909372400u, -240, 1},
+	{"America/New_York", 2903927400u, -300, 0},
+	{"America/New_York", 2929931999u, -240, 1},
+	{"America/New_York", 2929932000u, -300, 0},
+	{"America/New_York", 2919652200u, -240, 1},
+	{"America/New_York", 2940821999u, -300, 0},
+	{"America/New_York", 2940822000u, -240, 1},
+	{"America/New_York", 2935377000u, -300, 0},
+	{"America/New_York", 2961381599u, -240, 1},
+	{"America/New_York", 2961381600u, -300, 0},
+	{"America/New_York", 2951101800u, -240, 1},
+	{"America/New_York", 2972271599u, -300, 0},
+	{"America/New_York", 2972271600u, -240, 1},
+	{"America/New_York", 2966826600u, -300, 0},
+	{"America/New_York", 2992831199u, -240, 1},
+	{"America/New_York", 2992831200u, -300, 0},
+	{"America/New_York", 2982551400u, -240, 1},
+	{"America/New_York", 3003721199u, -300, 0},
+	{"America/New_York", 3003721200u, -240, 1},
+	{"America/New_York", 2998276200u, -300, 0},
+	{"America/New_York", 3024280799u, -240, 1},
+	{"America/New_York", 3024280800u, -300, 0},
+	{"America/New_York", 3014001000u, -240, 1},
+	{"America/New_York", 3035775599u, -300, 0},
+	{"America/New_York", 3035775600u, -240, 1},
+	{"America/New_York", 3030028200u, -300, 0},
+	{"America/New_York", 3056335199u, -240, 1},
+	{"America/New_York", 3056335200u, -300, 0},
+	{"America/New_York", 3046055400u, -240, 1},
+	{"America/New_York", 3067225199u, -300, 0},
+	{"America/New_York", 3067225200u, -240, 1},
+	{"America/New_York", 3061780200u, -300, 0},
+	{"America/New_York", 3087784799u, -240, 1},
+	{"America/New_York", 3087784800u, -300, 0},
+	{"America/New_York", 3077505000u, -240, 1},
+	{"America/New_York", 3098674799u, -300, 0},
+	{"America/New_York", 3098674800u, -240, 1},
+	{"America/New_York", 3093229800u, -300, 0},
+	{"America/New_York", 3119234399u, -240, 1},
+	{"America/New_York", 3119234400u, -300, 0},
+	{"America/New_York", 3108954600u, -240, 1},
+	{"America/New_York", 3130124399u, -300, 0},
+	{"America/New_York", 3130124400u, -240, 1},
+	{"America/New_York", 3124679400u, -300, 0},
+	{"America/New_York", 3150683999u, -240, 1},
+	{"America/New_York", 3150684000u, -300, 0},
+	{"America/New_York", 3140404200u, -240, 1},
+	{"America/New_York", 3161573999u, -300, 0},
+	{"America/New_York", 3161574000u, -240, 1},
+	{"America/New_York", 3156129000u, -300, 0},
+	{"America/New_York", 3182133599u, -240, 1},
+	{"America/New_York", 3182133600u, -300, 0},
+	{"America/New_York", 3171853800u, -240, 1},
+	{"America/New_York", 3193023599u, -300, 0},
+	{"America/New_York", 3193023600u, -240, 1},
+	{"America/New_York", 3187578600u, -300, 0},
+	{"America/New_York", 3213583199u, -240, 1},
+	{"America/New_York", 3213583200u, -300, 0},
+	{"America/New_York", 3203303400u, -240, 1},
+	{"America/New_York", 3225077999u, -300, 0},
+	{"America/New_York", 3225078000u, -240, 1},
+	{"America/New_York", 3219330600u, -300, 0},
+	{"America/New_York", 3245637599u, -240, 1},
+	{"America/New_York", 3245637600u, -300, 0},
+	{"America/New_York", 3235357800u, -240, 1},
+	{"America/New_York", 3256527599u, -300, 0},
+	{"America/New_York", 3256527600u, -240, 1},
+	{"America/New_York", 3251082600u, -300, 0},
+	{"America/New_York", 3277087199u, -240, 1},
+	{"America/New_York", 3277087200u, -300, 0},
+	{"America/New_York", 3266807400u, -240, 1},
+	{"America/New_York", 3287977199u, -300, 0},
+	{"America/New_York", 3287977200u, -240, 1},
+	{"America/New_York", 3282532200u, -300, 0},
+	{"America/New_York", 3308536799u, -240, 1},
+	{"America/New_York", 3308536800u, -300, 0},
+	{"America/New_York", 3298257000u, -240, 1},
+	{"America/New_York", 3319426799u, -300, 0},
+	{"America/New_York", 3319426800u, -240, 1},
+	{"America/New_York", 3313981800u, -300, 0},
+	{"America/New_York", 3339986399u, -240, 1},
+	{"America/New_York", 3339986400u, -300, 0},
+	{"America/New_York", 3329706600u, -240, 1},
+	{"America/New_York", 3350876399u, -300, 0},
+	{"America/New_York", 3350876400u, -240, 1},
+	{"America/New_York", 3345431400u, -300, 0},
+	{"America/New_York", 3371435999u, -240, 1},
+	{"America/New_York", 3371436000u, -300, 0},
+	{"America/New_York", 3361156200u, -240, 1},
+	{"America/New_York", 3382930799u, -300, 0},
+	{"America/New_York", 3382930800u, -240, 1},
+	{"America/New_York", 3377183400u, -300, 0},
+	{"America/New_York", 3403490399u, -240, 1},
+	{"America/New_York", 3403490400u, -300, 0},
+	{"America/New_York", 3393210600u, -240, 1},
+	{"America/New_York", 3414380399u, -300, 0},
+	{"America/New_York", 3414380400u, -240, 1},
+	{"America/New_York", 3408935400u, -300, 0},
+	{"America/New_York", 3434939999u, -240, 1},
+	{"America/New_York", 3434940000u, -300, 0},
+	{"America/New_York", 3424660200u, -240, 1},
+	{"America/New_York", 3445829999u, -300, 0},
+	{"America/New_York", 3445830000u, -240, 1},
+	{"America/New_York", 3440385000u, -300, 0},
+	{"America/New_York", 3466389599u, -240, 1},
+	{"America/New_York", 3466389600u, -300, 0},
+	{"America/New_York", 3456109800u, -240, 1},
+	{"America/New_York", 3477279599u, -300, 0},
+	{"America/New_York", 3477279600u, -240, 1},
+	{"America/New_York", 3471834600u, -300, 0},
+	{"America/New_York", 3497839199u, -240, 1},
+	{"America/New_York", 3497839200u, -300, 0},
+	{"America/New_York", 3487559400u, -240, 1},
+	{"America/New_York", 3508729199u, -300, 0},
+	{"America/New_York", 3508729200u, -240, 1},
+	{"America/New_York", 3503284200u, -300, 0},
+	{"America/New_York", 3529288799u, -240, 1},
+	{"America/New_York", 3529288800u, -300, 0},
+	{"America/New_York", 3519009000u, -240, 1},
+	{"America/New_York", 3540178799u, -300, 0},
+	{"America/New_York", 3540178800u, -240, 1},
+	{"America/New_York", 3534733800u, -300, 0},
+	{"America/New_York", 3560738399u, -240, 1},
+	{"America/New_York", 3560738400u, -300, 0},
+	{"America/New_York", 3550458600u, -240, 1},
+	{"America/New_York", 3572233199u, -300, 0},
+	{"America/New_York", 3572233200u, -240, 1},
+	{"America/New_York", 3566485800u, -300, 0},
+	{"America/New_York", 3592792799u, -240, 1},
+	{"America/New_York", 3592792800u, -300, 0},
+	{"America/New_York", 3582513000u, -240, 1},
+	{"America/New_York", 3603682799u, -300, 0},
+	{"America/New_York", 3603682800u, -240, 1},
+	{"America/New_York", 3598237800u, -300, 0},
+	{"America/New_York", 3624242399u, -240, 1},
+	{"America/New_York", 3624242400u, -300, 0},
+	{"America/New_York", 3613962600u, -240, 1},
+	{"America/New_York", 3635132399u, -300, 0},
+	{"America/New_York", 3635132400u, -240, 1},
+	{"America/New_York", 3629687400u, -300, 0},
+	{"America/New_York", 3655691999u, -240, 1},
+	{"America/New_York", 3655692000u, -300, 0},
+	{"America/New_York", 3645412200u, -240, 1},
+	{"America/New_York", 3666581999u, -300, 0},
+	{"America/New_York", 3666582000u, -240, 1},
+	{"America/New_York", 3661137000u, -300, 0},
+	{"America/New_York", 3687141599u, -240, 1},
+	{"America/New_York", 3687141600u, -300, 0},
+	{"America/New_York", 3676861800u, -240, 1},
+	{"America/New_York", 3698031599u, -300, 0},
+	{"America/New_York", 3698031600u, -240, 1},
+	{"America/New_York", 3692586600u, -300, 0},
+	{"America/New_York", 3718591199u, -240, 1},
+	{"America/New_York", 3718591200u, -300, 0},
+	{"America/New_York", 3708311400u, -240, 1},
+	{"America/New_York", 3730085999u, -300, 0},
+	{"America/New_York", 3730086000u, -240, 1},
+	{"America/New_York", 3724338600u, -300, 0},
+	{"America/New_York", 3750645599u, -240, 1},
+	{"America/New_York", 3750645600u, -300, 0},
+	{"America/New_York", 3740365800u, -240, 1},
+	{"America/New_York", 3761535599u, -300, 0},
+	{"America/New_York", 3761535600u, -240, 1},
+	{"America/New_York", 3756090600u, -300, 0},
+	{"America/New_York", 3782095199u, -240, 1},
+	{"America/New_York", 3782095200u, -300, 0},
+	{"America/New_York", 3771815400u, -240, 1},
+	{"America/New_York", 3792985199u, -300, 0},
+	{"America/New_York", 3792985200u, -240, 1},
+	{"America/New_York", 3787540200u, -300, 0},
+	{"America/New_York", 3813544799u, -240, 1},
+	{"America/New_York", 3813544800u, -300, 0},
+	{"America/New_York", 3803265000u, -240, 1},
+	{"America/New_York", 3824434799u, -300, 0},
+	{"America/New_York", 3824434800u, -240, 1},
+	{"America/New_York", 3818989800u, -300, 0},
+	{"America/New_York", 3844994399u, -240, 1},
+	{"America/New_York", 3844994400u, -300, 0},
+	{"America/New_York", 3834714600u, -240, 1},
+	{"America/New_York", 3855884399u, -300, 0},
+	{"America/New_York", 3855884400u, -240, 1},
+	{"America/New_York", 3850439400u, -300, 0},
+	{"America/New_York", 3876443999u, -240, 1},
+	{"America/New_York", 3876444000u, -300, 0},
+	{"America/New_York", 3866164200u, -240, 1},
+	{"America/New_York", 3887333999u, -300, 0},
+	{"America/New_York", 3887334000u, -240, 1},
+	{"America/New_York", 3881889000u, -300, 0},
+	{"America/New_York", 3907893599u, -240, 1},
+	{"America/New_York", 3907893600u, -300, 0},
+	{"America/New_York", 3897613800u, -240, 1},
+	{"America/New_York", 3919388399u, -300, 0},
+	{"America/New_York", 3919388400u, -240, 1},
+	{"America/New_York", 3913641000u, -300, 0},
+	{"America/New_York", 3939947999u, -240, 1},
+	{"America/New_York", 3939948000u, -300, 0},
+	{"America/New_York", 3929668200u, -240, 1},
+	{"America/New_York", 3950837999u, -300, 0},
+	{"America/New_York", 3950838000u, -240, 1},
+	{"America/New_York", 3945393000u, -300, 0},
+	{"America/New_York", 3971397599u, -240, 1},
+	{"America/New_York", 3971397600u, -300, 0},
+	{"America/New_York", 3961117800u, -240, 1},
+	{"America/New_York", 3982287599u, -300, 0},
+	{"America/New_York", 3982287600u, -240, 1},
+	{"America/New_York", 3976842600u, -300, 0},
+	{"America/New_York", 4002847199u, -240, 1},
+	{"America/New_York", 4002847200u, -300, 0},
+	{"America/New_York", 3992567400u, -240, 1},
+	{"America/New_York", 4013737199u, -300, 0},
+	{"America/New_York", 4013737200u, -240, 1},
+	{"America/New_York", 4008292200u, -300, 0},
+	{"America/New_York", 4034296799u, -240, 1},
+	{"America/New_York", 4034296800u, -300, 0},
+	{"America/New_York", 4024017000u, -240, 1},
+	{"America/New_York", 4045186799u, -300, 0},
+	{"America/New_York", 4045186800u, -240, 1},
+	{"America/New_York", 4039741800u, -300, 0},
+	{"America/New_York", 4065746399u, -240, 1},
+	{"America/New_York", 4065746400u, -300, 0},
+	{"America/New_York", 4055466600u, -240, 1},
+	{"America/New_York", 4076636399u, -300, 0},
+	{"America/New_York", 4076636400u, -240, 1},
+	{"America/New_York", 4071191400u, -300, 0},
+	{"America/New_York", 4097195999u, -240, 1},
+	{"America/New_York", 4097196000u, -300, 0},
+	{"America/New_York", 4086916200u, -240, 1},
+	{"America/New_York", 4108690799u, -300, 0},
+	{"America/New_York", 4108690800u, -240, 1},
+	{"America/New_York", 4102943400u, -300, 0},
+	{"America/New_York", 4129250399u, -240, 1},
+	{"America/New_York", 4129250400u, -300, 0},
+	{"America/New_York", 4118970600u, -240, 1},
+	{"America/New_York", 4140140399u, -300, 0},
+	{"America/New_York", 4140140400u, -240, 1},
+	{"America/New_York", 4134695400u, -300, 0},
+	{"America/New_York", 4160699999u, -240, 1},
+	{"America/New_York", 4160700000u, -300, 0},
+	{"America/New_York", 4150420200u, -240, 1},
+	{"America/New_York", 4171589999u, -300, 0},
+	{"America/New_York", 4171590000u, -240, 1},
+	{"America/New_York", 4166145000u, -300, 0},
+	{"America/New_York", 4192149599u, -240, 1},
+	{"America/New_York", 4192149600u, -300, 0},
+	{"America/New_York", 4181869800u, -240, 1},
+	{"America/New_York", 4203039599u, -300, 0},
+	{"America/New_York", 4203039600u, -240, 1},
+	{"America/New_York", 4197594600u, -300, 0},
+	{"America/New_York", 4223599199u, -240, 1},
+	{"America/New_York", 4223599200u, -300, 0},
+	{"America/New_York", 4213319400u, -240, 1},
+	{"America/New_York", 4234489199u, -300, 0},
+	{"America/New_York", 4234489200u, -240, 1},
+	{"America/New_York", 4229044200u, -300, 0},
+	{"America/New_York", 4255048799u, -240, 1},
+	{"America/New_York", 4255048800u, -300, 0},
+	{"America/New_York", 4244769000u, -240, 1},
+	{"America/New_York", 4265938799u, -300, 0},
+	{"America/New_York", 4265938800u, -240, 1},
+	{"America/New_York", 4260493800u, -300, 0},
+	{"America/New_York", 4286498399u, -240, 1},
+	{"America/New_York", 4286498400u, -300, 0},
+	{"America/New_York", 4276218600u, -240, 1},
+	{"America/New_York", 4294967295u, -300, 0},
+	// America/Phoenix
+	{"America/Phoenix", 1262304000u, -420, 0},
+	{"America/Phoenix", 4294967295u, -420, 0},
+	// America/Sao_Paulo
+	{"America/Sao_Paulo", 1262304000u, -120, 1},
+	{"America/Sao_Paulo", 1266717599u, -120, 1},
+	{"America/Sao_Paulo", 1266717600u, -180, 0},
+	{"America/Sao_Paulo", 1264510800u, -120, 1},
+	{"America/Sao_Paulo", 1287284399u, -180, 0},
+	{"America/Sao_Paulo", 1287284400u, -120, 1},
+	{"America/Sao_Paulo", 1277001000u, -180, 0},
+	{"America/Sao_Paulo", 1298167199u, -120, 1},
+	{"America/Sao_Paulo", 1298167200u, -180, 0},
+	{"America/Sao_Paulo", 1292725800u, -120, 1},
+	{"America/Sao_Paulo", 1318733999u, -180, 0},
+	{"America/Sao_Paulo", 1318734000u, -120, 1},
+	{"America/Sao_Paulo", 1308450600u, -180, 0},
+	{"America/Sao_Paulo", 1330221599u, -120, 1},
+	{"America/Sao_Paulo", 1330221600u, -180, 0},
+	{"America/Sao_Paulo", 1324477800u, -120, 1},
+	{"America/Sao_Paulo", 1350788399u, -180, 0},
+	{"America/Sao_Paulo", 1350788400u, -120, 1},
+	{"America/Sao_Paulo", 1340505000u, -180, 0},
+	{"America/Sao_Paulo", 1361066399u, -120, 1},
+	{"America/Sao_Paulo", 1361066400u, -180, 0},
+	{"America/Sao_Paulo", 1355927400u, -120, 1},
+	{"America/Sao_Paulo", 1382237999u, -180, 0},
+	{"America/Sao_Paulo", 1382238000u, -120, 1},
+	{"America/Sao_Paulo", 1371652200u, -180, 0},
+	{"America/Sao_Paulo", 1392515999u, -120, 1},
+	{"America/Sao_Paulo", 1392516000u, -180, 0},
+	{"America/Sao_Paulo", 1387377000u, -120, 1},
+	{"America/Sao_Paulo", 1413687599u, -180, 0},
+	{"America/Sao_Paulo", 1413687600u, -120, 1},
+	{"America/Sao_Paulo", 1403101800u, -180, 0},
+	{"America/Sao_Paulo", 1424570399u, -120, 1},
+	{"America/Sao_Paulo", 1424570400u, -180, 0},
+	{"America/Sao_Paulo", 1419129000u, -120, 1},
+	{"America/Sao_Paulo", 1445137199u, -180, 0},
+	{"America/Sao_Paulo", 1445137200u, -120, 1},
+	{"America/Sao_Paulo", 1434853800u, -180, 0},
+	{"America/Sao_Paulo", 1456019999u, -120, 1},
+	{"America/Sao_Paulo", 1456020000u, -180, 0},
+	{"America/Sao_Paulo", 1450578600u, -120, 1},
+	{"America/Sao_Paulo", 1476586799u, -180, 0},
+	{"America/Sao_Paulo", 1476586800u, -120, 1},
+	{"America/Sao_Paulo", 1466303400u, -180, 0},
+	{"America/Sao_Paulo", 1487469599u, -120, 1},
+	{"America/Sao_Paulo", 1487469600u, -180, 0},
+	{"America/Sao_Paulo", 1482028200u, -120, 1},
+	{"America/Sao_Paulo", 1508036399u, -180, 0},
+	{"America/Sao_Paulo", 1508036400u, -120, 1},
+	{"America/Sao_Paulo", 1497753000u, -180, 0},
+	{"America/Sao_Paulo", 1518919199u, -120, 1},
+	{"America/Sao_Paulo", 1518919200u, -180, 0},
+	{"America/Sao_Paulo", 1513477800u, -120, 1},
+	{"America/Sao_Paulo", 1541300399u, -180, 0},
+	{"America/Sao_Paulo", 1541300400u, -120, 1},
+	{"America/Sao_Paulo", 1530109800u, -180, 0},
+	{"America/Sao_Paulo", 1550368799u, -120, 1},
+	{"America/Sao_Paulo", 1550368800u, -180, 0},
+	{"America/Sao_Paulo", 1545834600u, -120, 1},
+	{"America/Sao_Paulo", 4294967295u, -180, 0},
+	// Asia/Kolkata
+	{"Asia/Kolkata", 1262304000u, 330, 0},
+	{"Asia/Kolkata", 4294967295u, 330, 0},
+	// Asia/Shanghai
+	{"Asia/Shanghai", 1262304000u, 480, 0},
+	{"Asia/Shanghai", 4294967295u, 480, 0},
+	// Asia/Tokyo
+	{"Asia/Tokyo", 1262304000u, 540, 0},
+	{"Asia/Tokyo", 4294967295u, 540, 0},
+	// Australia/Sydney
+	{"Australia/Sydney", 1262304000u, 660, 1},
+	{"Australia/Sydney", 1270310399u, 660, 1},
+	{"Australia/Sydney", 1270310400u, 600, 0},
+	{"Australia/Sydney", 1266307200u, 660, 1},
+	{"Australia/Sydney", 1286035199u, 600, 0},
+	{"Australia/Sydney", 1286035200u, 660, 1},
+	{"Australia/Sydney", 1278172800u, 600, 0},
+	{"Australia/Sydney", 1301759999u, 660, 1},
+	{"Australia/Sydney", 1301760000u, 600, 0},
+	{"Australia/Sydney", 1293897600u, 660, 1},
+	{"Australia/Sydney", 1317484799u, 600, 0},
+	{"Australia/Sydney", 1317484800u, 660, 1},
+	{"Australia/Sydney", 1309622400u, 600, 0},
+	{"Australia/Sydney", 1333209599u, 660, 1},
+	{"Australia/Sydney", 1333209600u, 600, 0},
+	{"Australia/Sydney", 1325347200u, 660, 1},
+	{"Australia/Sydney", 1349539199u, 600, 0},
+	{"Australia/Sydney", 1349539200u, 660, 1},
+	{"Australia/Sydney", 1341374400u, 600, 0},
+	{"Australia/Sydney", 1365263999u, 660, 1},
+	{"Australia/Sydney", 1365264000u, 600, 0},
+	{"Australia/Sydney", 1357401600u, 660, 1},
+	{"Australia/Sydney", 1380988799u, 600, 0},
+	{"Australia/Sydney", 1380988800u, 660, 1},
+	{"Australia/Sydney", 1373126400u, 600, 0},
+	{"Australia/Sydney", 1396713599u, 660, 1},
+	{"Australia/Sydney", 1396713600u, 600, 0},
+	{"Australia/Sydney", 1388851200u, 660, 1},
+	{"Australia/Sydney", 1412438399u, 600, 0},
+	{"Australia/Sydney", 1412438400u, 660, 1},
+	{"Australia/Sydney", 1404576000u, 600, 0},
+	{"Australia/Sydney", 1428163199u, 660, 1},
+	{"Australia/Sydney", 1428163200u, 600, 0},
+	{"Australia/Sydney", 1420300800u, 660, 1},
+	{"Australia/Sydney", 1443887999u, 600, 0},
+	{"Australia/Sydney", 1443888000u, 660, 1},
+	{"Australia/Sydney", 1436025600u, 600, 0},
+	{"Australia/Sydney", 1459612799u, 660, 1},
+	{"Australia/Sydney", 1459612800u, 600, 0},
+	{"Australia/Sydney", 1451750400u, 660, 1},
+	{"Australia/Sydney", 1475337599u, 600, 0},
+	{"Australia/Sydney", 1475337600u, 660, 1},
+	{"Australia/Sydney", 1467475200u, 600, 0},
+	{"Australia/Sydney", 1491062399u, 660, 1},
+	{"Australia/Sydney", 1491062400u, 600, 0},
+	{"Australia/Sydney", 1483200000u, 660, 1},
+	{"Australia/Sydney", 1506787199u, 600, 0},
+	{"Australia/Sydney", 1506787200u, 660, 1},
+	{"Australia/Sydney", 1498924800u, 600, 0},
+	{"Australia/Sydney", 1522511999u, 660, 1},
+	{"Australia/Sydney", 1522512000u, 600, 0},
+	{"Australia/Sydney", 1514649600u, 660, 1},
+	{"Australia/Sydney", 1538841599u, 600, 0},
+	{"Australia/Sydney", 1538841600u, 660, 1},
+	{"Australia/Sydney", 1530676800u, 600, 0},
+	{"Australia/Sydney", 1554566399u, 660, 1},
+	{"Australia/Sydney", 1554566400u, 600, 0},
+	{"Australia/Sydney", 1546704000u, 660, 1},
+	{"Australia/Sydney", 1570291199u, 600, 0},
+	{"Australia/Sydney", 1570291200u, 660, 1},
+	{"Australia/Sydney", 1562428800u, 600, 0},
+	{"Australia/Sydney", 1586015999u, 660, 1},
+	{"Australia/Sydney", 1586016000u, 600, 0},
+	{"Australia/Sydney", 1578153600u, 660, 1},
+	{"Australia/Sydney", 1601740799u, 600, 0},
+	{"Australia/Sydney", 1601740800u, 660, 1},
+	{"Australia/Sydney", 1593878400u, 600, 0},
+	{"Australia/Sydney", 1617465599u, 660, 1},
+	{"Australia/Sydney", 1617465600u, 600, 0},
+	{"Australia/Sydney", 1609603200u, 660, 1},
+	{"Australia/Sydney", 1633190399u, 600, 0},
+	{"Australia/Sydney", 1633190400u, 660, 1},
+	{"Australia/Sydney", 1625328000u, 600, 0},
+	{"Australia/Sydney", 1648915199u, 660, 1},
+	{"Australia/Sydney", 1648915200u, 600, 0},
+	{"Australia/Sydney", 1641052800u, 660, 1},
+	{"Australia/Sydney", 1664639999u, 600, 0},
+	{"Australia/Sydney", 1664640000u, 660, 1},
+	{"Australia/Sydney", 1656777600u, 600, 0},
+	{"Australia/Sydney", 1680364799u, 660, 1},
+	{"Australia/Sydney", 1680364800u, 600, 0},
+	{"Australia/Sydney", 1672502400u, 660, 1},
+	{"Australia/Sydney", 1696089599u, 600, 0},
+	{"Australia/Sydney", 1696089600u, 660, 1},
+	{"Australia/Sydney", 1688227200u, 600, 0},
+	{"Australia/Sydney", 1712419199u, 660, 1},
+	{"Australia/Sydney", 1712419200u, 600, 0},
+	{"Australia/Sydney", 1704254400u, 660, 1},
+	{"Australia/Sydney", 1728143999u, 600, 0},
+	{"Australia/Sydney", 1728144000u, 660, 1},
+	{"Australia/Sydney", 1720281600u, 600, 0},
+	{"Australia/Sydney", 1743868799u, 660, 1},
+	{"Australia/Sydney", 1743868800u, 600, 0},
+	{"Australia/Sydney", 1736006400u, 660, 1},
+	{"Australia/Sydney", 1759593599u, 600, 0},
+	{"Australia/Sydney", 1759593600u, 660, 1},
+	{"Australia/Sydney", 1751731200u, 600, 0},
+	{"Australia/Sydney", 1775318399u, 660, 1},
+	{"Australia/Sydney", 1775318400u, 600, 0},
+	{"Australia/Sydney", 1767456000u, 660, 1},
+	{"Australia/Sydney", 1791043199u, 600, 0},
+	{"Australia/Sydney", 1791043200u, 660, 1},
+	{"Australia/Sydney", 1783180800u, 600, 0},
+	{"Australia/Sydney", 1806767999u, 660, 1},
+	{"Australia/Sydney", 1806768000u, 600, 0},
+	{"Australia/Sydney", 1798905600u, 660, 1},
+	{"Australia/Sydney", 1822492799u, 600, 0},
+	{"Australia/Sydney", 1822492800u, 660, 1},
+	{"Australia/Sydney", 1814630400u, 600, 0},
+	{"Australia/Sydney", 1838217599u, 660, 1},
+	{"Australia/Sydney", 1838217600u, 600, 0},
+	{"Australia/Sydney", 1830355200u, 660, 1},
+	{"Australia/Sydney", 1853942399u, 600, 0},
+	{"Australia/Sydney", 1853942400u, 660, 1},
+	{"Australia/Sydney", 1846080000u, 600, 0},
+	{"Australia/Sydney", 1869667199u, 660, 1},
+	{"Australia/Sydney", 1869667200u, 600, 0},
+	{"Australia/Sydney", 1861804800u, 660, 1},
+	{"Australia/Sydney", 1885996799u, 600, 0},
+	{"Australia/Sydney", 1885996800u, 660, 1},
+	{"Australia/Sydney", 1877832000u, 600, 0},
+	{"Australia/Sydney", 1901721599u, 660, 1},
+	{"Australia/Sydney", 1901721600u, 600, 0},
+	{"Australia/Sydney", 1893859200u, 660, 1},
+	{"Australia/Sydney", 1917446399u, 600, 0},
+	{"Australia/Sydney", 1917446400u, 660, 1},
+	{"Australia/Sydney", 1909584000u, 600, 0},
+	{"Australia/Sydney", 1933171199u, 660, 1},
+	{"Australia/Sydney", 1933171200u, 600, 0},
+	{"Australia/Sydney", 1925308800u, 660, 1},
+	{"Australia/Sydney", 1948895999u, 600, 0},
+	{"Australia/Sydney", 1948896000u, 660, 1},
+	{"Australia/Sydney", 1941033600u, 600, 0},
+	{"Australia/Sydney", 1964620799u, 660, 1},
+	{"Australia/Sydney", 1964620800u, 600, 0},
+	{"Australia/Sydney", 1956758400u, 660, 1},
+	{"Australia/Sydney", 1980345599u, 600, 0},
+	{"Australia/Sydney", 1980345600u, 660, 1},
+	{"Australia/Sydney", 1972483200u, 600, 0},
+	{"Australia/Sydney", 1996070399u, 660, 1},
+	{"Australia/Sydney", 1996070400u, 600, 0},
+	{"Australia/Sydney", 1988208000u, 660, 1},
+	{"Australia/Sydney", 2011795199u, 600, 0},
+	{"Australia/Sydney", 2011795200u, 660, 1},
+	{"Australia/Sydney", 2003932800u, 600, 0},
+	{"Australia/Sydney", 2027519999u, 660, 1},
+	{"Australia/Sydney", 2027520000u, 600, 0},
+	{"Australia/Sydney", 2019657600u, 660, 1},
+	{"Australia/Sydney", 2043244799u, 600, 0},
+	{"Australia/Sydney", 2043244800u, 660, 1},
+	{"Australia/Sydney", 2035382400u, 600, 0},
+	{"Australia/Sydney", 2058969599u, 660, 1},
+	{"Australia/Sydney", 2058969600u, 600, 0},
+	{"Australia/Sydney", 2051107200u, 660, 1},
+	{"Australia/Sydney", 2075299199u, 600, 0},
+	{"Australia/Sydney", 2075299200u, 660, 1},
+	{"Australia/Sydney", 2067134400u, 600, 0},
+	{"Australia/Sydney", 2091023999u, 660, 1},
+	{"Australia/Sydney", 2091024000u, 600, 0},
+	{"Australia/Sydney", 2083161600u, 660, 1},
+	{"Australia/Sydney", 2106748799u, 600, 0},
+	{"Australia/Sydney", 2106748800u, 660, 1},
+	{"Australia/Sydney", 2098886400u, 600, 0},
+	{"Australia/Sydney", 2122473599u, 660, 1},
+	{"Australia/Sydney", 2122473600u, 600, 0},
+	{"Australia/Sydney", 2114611200u, 660, 1},
+	{"Australia/Sydney", 2138198399u, 600, 0},
+	{"Australia/Sydney", 2138198400u, 660, 1},
+	{"Australia/Sydney", 2130336000u, 600, 0},
+	{"Australia/Sydney", 2153923199u, 660, 1},
+	{"Australia/Sydney", 2153923200u, 600, 0},
+	{"Australia/Sydney", 2146060800u, 660, 1},
+	{"Australia/Sydney", 2169647999u, 600, 0},
+	{"Australia/Sydney", 2169648000u, 660, 1},
+	{"Australia/Sydney", 2161785600u, 600, 0},
+	{"Australia/Sydney", 2185372799u, 660, 1},
+	{"Australia/Sydney", 2185372800u, 600, 0},
+	{"Australia/Sydney", 2177510400u, 660, 1},
+	{"Australia/Sydney", 2201097599u, 600, 0},
+	{"Australia/Sydney", 2201097600u, 660, 1},
+	{"Australia/Sydney", 2193235200u, 600, 0},
+	{"Australia/Sydney", 2216822399u, 660, 1},
+	{"Australia/Sydney", 2216822400u, 600, 0},
+	{"Australia/Sydney", 2208960000u, 660, 1},
+	{"Australia/Sydney", 2233151999u, 600, 0},
+	{"Australia/Sydney", 2233152000u, 660, 1},
+	{"Australia/Sydney", 2224987200u, 600, 0},
+	{"Australia/Sydney", 2248876799u, 660, 1},
+	{"Australia/Sydney", 2248876800u, 600, 0},
+	{"Australia/Sydney", 2241014400u, 660, 1},
+	{"Australia/Sydney", 2264601599u, 600, 0},
+	{"Australia/Sydney", 2264601600u, 660, 1},
+	{"Australia/Sydney", 2256739200u, 600, 0},
+	{"Australia/Sydney", 2280326399u, 660, 1},
+	{"Australia/Sydney", 2280326400u, 600, 0},
+	{"Australia/Sydney", 2272464000u, 660, 1},
+	{"Australia/Sydney", 2296051199u, 600, 0},
+	{"Australia/Sydney", 2296051200u, 660, 1},
+	{"Australia/Sydney", 2288188800u, 600, 0},
+	{"Australia/Sydney", 2311775999u, 660, 1},
+	{"Australia/Sydney", 2311776000u, 600, 0},
+	{"Australia/Sydney", 2303913600u, 660, 1},
+	{"Australia/Sydney", 2327500799u, 600, 0},
+	{"Australia/Sydney", 2327500800u, 660, 1},
+	{"Australia/Sydney", 2319638400u, 600, 0},
+	{"Australia/Sydney", 2343225599u, 660, 1},
+	{"Australia/Sydney", 2343225600u, 600, 0},
+	{"Australia/Sydney", 2335363200u, 660, 1},
+	{"Australia/Sydney", 2358950399u, 600, 0},
+	{"Australia/Sydney", 2358950400u, 660, 1},
+	{"Australia/Sydney", 2351088000u, 600, 0},
+	{"Australia/Sydney", 2374675199u, 660, 1},
+	{"Australia/Sydney", 2374675200u, 600, 0},
+	{"Australia/Sydney", 2366812800u, 660, 1},
+	{"Australia/Sydney", 2390399999u, 600, 0},
+	{"Australia/Sydney", 2390400000u, 660, 1},
+	{"Australia/Sydney", 2382537600u, 600, 0},
+	{"Australia/Sydney", 2406124799u, 660, 1},
+	{"Australia/Sydney", 2406124800u, 600, 0},
+	{"Australia/Sydney", 2398262400u, 660, 1},
+	{"Australia/Sydney", 2422454399u, 600, 0},
+	{"Australia/Sydney", 2422454400u, 660, 1},
+	{"Australia/Sydney", 2414289600u, 600, 0},
+	{"Australia/Sydney", 2438179199u, 660, 1},
+	{"Australia/Sydney", 2438179200u, 600, 0},
+	{"Australia/Sydney", 2430316800u, 660, 1},
+	{"Australia/Sydney", 2453903999u, 600, 0},
+	{"Australia/Sydney", 2453904000u, 660, 1},
+	{"Australia/Sydney", 2446041600u, 600, 0},
+	{"Australia/Sydney", 2469628799u, 660, 1},
+	{"Australia/Sydney", 2469628800u, 600, 0},
+	{"Australia/Sydney", 2461766400u, 660, 1},
+	{"Australia/Sydney", 2485353599u, 600, 0},
+	{"Australia/Sydney", 2485353600u, 660, 1},
+	{"Australia/Sydney", 2477491200u, 600, 0},
+	{"Australia/Sydney", 2501078399u, 660, 1},
+	{"Australia/Sydney", 2501078400u, 600, 0},
+	{"Australia/Sydney", 2493216000u, 660, 1},
+	{"Australia/Sydney", 2516803199u, 600, 0},
+	{"Australia/Sydney", 2516803200u, 660, 1},
+	{"Australia/Sydney", 2508940800u, 600, 0},
+	{"Australia/Sydney", 2532527999u, 660, 1},
+	{"Australia/Sydney", 2532528000u, 600, 0},
+	{"Australia/Sydney", 2524665600u, 660, 1},
+	{"Australia/Sydney", 2548252799u, 600, 0},
+	{"Australia/Sydney", 2548252800u, 660, 1},
+	{"Australia/Sydney", 2540390400u, 600, 0},
+	{"Australia/Sydney", 2563977599u, 660, 1},
+	{"Australia/Sydney", 2563977600u, 600, 0},
+	{"Australia/Sydney", 2556115200u, 660, 1},
+	{"Australia/Sydney", 2579702399u, 600, 0},
+	{"Australia/Sydney", 2579702400u, 660, 1},
+	{"Australia/Sydney", 2571840000u, 600, 0},
+	{"Australia/Sydney", 2596031999u, 660, 1},
+	{"Australia/Sydney", 2596032000u, 600, 0},
+	{"Australia/Sydney", 2587867200u, 660, 1},
+	{"Australia/Sydney", 2611756799u, 600, 0},
+	{"Australia/Sydney", 2611756800u, 660, 1},
+	{"Australia/Sydney", 2603894400u, 600, 0},
+	{"Australia/Sydney", 2627481599u, 660, 1},
+	{"Australia/Sydney", 2627481600u, 600, 0},
+	{"Australia/Sydney", 2619619200u, 660, 1},
+	{"Australia/Sydney", 2643206399u, 600, 0},
+	{"Australia/Sydney", 2643206400u, 660, 1},
+	{"Australia/Sydney", 2635344000u, 600, 0},
+	{"Australia/Sydney", 2658931199u, 660, 1},
+	{"Australia/Sydney", 2658931200u, 600, 0},
+	{"Australia/Sydney", 2651068800u, 660, 1},
+	{"Australia/Sydney", 2674655999u, 600, 0},
+	{"Australia/Sydney", 2674656000u, 660, 1},
+	{"Australia/Sydney", 2666793600u, 600, 0},
+	{"Australia/Sydney", 2690380799u, 660, 1},
+	{"Australia/Sydney", 2690380800u, 600, 0},
+	{"Australia/Sydney", 2682518400u, 660, 1},
+	{"Australia/Sydney", 2706105599u, 600, 0},
+	{"Australia/Sydney", 2706105600u, 660, 1},
+	{"Australia/Sydney", 2698243200u, 600, 0},
+	{"Australia/Sydney", 2721830399u, 660, 1},
+	{"Australia/Sydney", 2721830400u, 600, 0},
+	{"Australia/Sydney", 2713968000u, 660, 1},
+	{"Australia/Sydney", 2737555199u, 600, 0},
+	{"Australia/Sydney", 2737555200u, 660, 1},
+	{"Australia/Sydney", 2729692800u, 600, 0},
+	{"Australia/Sydney", 2753279999u, 660, 1},
+	{"Australia/Sydney", 2753280000u, 600, 0},
+	{"Australia/Sydney", 2745417600u, 660, 1},
+	{"Australia/Sydney", 2769609599u, 600, 0},
+	{"Australia/Sydney", 2769609600u, 660, 1},
+	{"Australia/Sydney", 2761444800u, 600, 0},
+	{"Australia/Sydney", 2785334399u, 660, 1},
+	{"Australia/Sydney", 2785334400u, 600, 0},
+	{"Australia/Sydney", 2777472000u, 660, 1},
+	{"Australia/Sydney", 2801059199u, 600, 0},
+	{"Australia/Sydney", 2801059200u, 660, 1},
+	{"Australia/Sydney", 2793196800u, 600, 0},
+	{"Australia/Sydney", 2816783999u, 660, 1},
+	{"Australia/Sydney", 2816784000u, 600, 0},
+	{"Australia/Sydney", 2808921600u, 660, 1},
+	{"Australia/Sydney", 2832508799u, 600, 0},
+	{"Australia/Sydney", 2832508800u, 660, 1},
+	{"Australia/Sydney", 2824646400u, 600, 0},
+	{"Australia/Sydney", 2848233599u, 660, 1},
+	{"Australia/Sydney", 2848233600u, 600, 0},
+	{"Australia/Sydney", 2840371200u, 660, 1},
+	{"Australia/Sydney", 2863958399u, 600, 0},
+	{"Australia/Sydney", 2863958400u, 660, 1},
+	{"Australia/Sydney", 2856096000u, 600, 0},
+	{"Australia/Sydney", 2879683199u, 660, 1},
+	{"Australia/Sydney", 2879683200u, 600, 0},
+	{"Australia/Sydney", 2871820800u, 660, 1},
+	{"Australia/Sydney", 2895407999u, 600, 0},
+	{"Australia/Sydney", 2895408000u, 660, 1},
+	{"Australia/Sydney", 2887545600u, 600, 0},
+	{"Australia/Sydney", 2911132799u, 660, 1},
+	{"Australia/Sydney", 2911132800u, 600, 0},
+	{"Australia/Sydney", 2903270400u, 660, 1},
+	{"Australia/Sydney", 2926857599u, 600, 0},
+	{"Australia/Sydney", 2926857600u, 660, 1},
+	{"Australia/Sydney", 2918995200u, 600, 0},
+	{"Australia/Sydney", 2942582399u, 660, 1},
+	{"Australia/Sydney", 2942582400u, 600, 0},
+	{"Australia/Sydney", 2934720000u, 660, 1},
+	{"Australia/Sydney", 2958911999u, 600, 0},
+	{"Australia/Sydney", 2958912000u, 660, 1},
+	{"Australia/Sydney", 2950747200u, 600, 0},
+	{"Australia/Sydney", 2974636799u, 660, 1},
+	{"Australia/Sydney", 2974636800u, 600, 0},
+	{"Australia/Sydney", 2966774400u, 660, 1},
+	{"Australia/Sydney", 2990361599u, 600, 0},
+	{"Australia/Sydney", 2990361600u, 660, 1},
+	{"Australia/Sydney", 2982499200u, 600, 0},
+	{"Australia/Sydney", 3006086399u, 660, 1},
+	{"Australia/Sydney", 3006086400u, 600, 0},
+	{"Australia/Sydney", 2998224000u, 660, 1},
+	{"Australia/Sydney", 3021811199u, 600, 0},
+	{"Australia/Sydney", 3021811200u, 660, 1},
+	{"Australia/Sydney", 3013948800u, 600, 0},
+	{"Australia/Sydney", 3037535999u, 660, 1},
+	{"Australia/Sydney", 3037536000u, 600, 0},
+	{"Australia/Sydney", 3029673600u, 660, 1},
+	{"Australia/Sydney", 3053260799u, 600, 0},
+	{"Australia/Sydney", 3053260800u, 660, 1},
+	{"Australia/Sydney", 3045398400u, 600, 0},
+	{"Australia/Sydney", 3068985599u, 660, 1},
+	{"Australia/Sydney", 3068985600u, 600, 0},
+	{"Australia/Sydney", 3061123200u, 660, 1},
+	{"Australia/Sydney", 3084710399u, 600, 0},
+	{"Australia/Sydney", 3084710400u, 660, 1},
+	{"Australia/Sydney", 3076848000u, 600, 0},
+	{"Australia/Sydney", 3100435199u, 660, 1},
+	{"Australia/Sydney", 3100435200u, 600, 0},
+	{"Australia/Sydney", 3092572800u, 660, 1},
+	{"Australia/Sydney", 3116764799u, 600, 0},
+	{"Australia/Sydney", 3116764800u, 660, 1},
+	{"Australia/Sydney", 3108600000u, 600, 0},
+	{"Australia/Sydney", 3132489599u, 660, 1},
+	{"Australia/Sydney", 3132489600u, 600, 0},
+	{"Australia/Sydney", 3124627200u, 660, 1},
+	{"Australia/Sydney", 3148214399u, 600, 0},
+	{"Australia/Sydney", 3148214400u, 660, 1},
+	{"Australia/Sydney", 3140352000u, 600, 0},
+	{"Australia/Sydney", 3163939199u, 660, 1},
+	{"Australia/Sydney", 3163939200u, 600, 0},
+	{"Australia/Sydney", 3156076800u, 660, 1},
+	{"Australia/Sydney", 3179663999u, 600, 0},
+	{"Australia/Sydney", 3179664000u, 660, 1},
+	{"Australia/Sydney", 3171801600u, 600, 0},
+	{"Australia/Sydney", 3195388799u, 660, 1},
+	{"Australia/Sydney", 3195388800u, 600, 0},
+	{"Australia/Sydney", 3187526400u, 660, 1},
+	{"Australia/Sydney", 3211113599u, 600, 0},
+	{"Australia/Sydney", 3211113600u, 660, 1},
+	{"Australia/Sydney", 3203251200u, 600, 0},
+	{"Australia/Sydney", 3226838399u, 660, 1},
+	{"Australia/Sydney", 3226838400u, 600, 0},
+	{"Australia/Sydney", 3218976000u, 660, 1},
+	{"Australia/Sydney", 3242563199u, 600, 0},
+	{"Australia/Sydney", 3242563200u, 660, 1},
+	{"Australia/Sydney", 3234700800u, 600, 0},
+	{"Australia/Sydney", 3258287999u, 660, 1},
+	{"Australia/Sydney", 3258288000u, 600, 0},
+	{"Australia/Sydney", 3250425600u, 660, 1},
+	{"Australia/Sydney", 3274012799u, 600, 0},
+	{"Australia/Sydney", 3274012800u, 660, 1},
+	{"Australia/Sydney", 3266150400u, 600, 0},
+	{"Australia/Sydney", 3289737599u, 660, 1},
+	{"Australia/Sydney", 3289737600u, 600, 0},
+	{"Australia/Sydney", 3281875200u, 660, 1},
+	{"Australia/Sydney", 3306067199u, 600, 0},
+	{"Australia/Sydney", 3306067200u, 660, 1},
+	{"Australia/Sydney", 3297902400u, 600, 0},
+	{"Australia/Sydney", 3321791999u, 660, 1},
+	{"Australia/Sydney", 3321792000u, 600, 0},
+	{"Australia/Sydney", 3313929600u, 660, 1},
+	{"Australia/Sydney", 3337516799u, 600, 0},
+	{"Australia/Sydney", 3337516800u, 660, 1},
+	{"Australia/Sydney", 3329654400u, 600, 0},
+	{"Australia/Sydney", 3353241599u, 660, 1},
+	{"Australia/Sydney", 3353241600u, 600, 0},
+	{"Australia/Sydney", 3345379200u, 660, 1},
+	{"Australia/Sydney", 3368966399u, 600, 0},
+	{"Australia/Sydney", 3368966400u, 660, 1},
+	{"Australia/Sydney", 3361104000u, 600, 0},
+	{"Australia/Sydney", 3384691199u, 660, 1},
+	{"Australia/Sydney", 3384691200u, 600, 0},
+	{"Australia/Sydney", 3376828800u, 660, 1},
+	{"Australia/Sydney", 3400415999u, 600, 0},
+	{"Australia/Sydney", 3400416000u, 660, 1},
+	{"Australia/Sydney", 3392553600u, 600, 0},
+	{"Australia/Sydney", 3416140799u, 660, 1},
+	{"Australia/Sydney", 3416140800u, 600, 0},
+	{"Australia/Sydney", 3408278400u, 660, 1},
+	{"Australia/Sydney", 3431865599u, 600, 0},
+	{"Australia/Sydney", 3431865600u, 660, 1},
+	{"Australia/Sydney", 3424003200u, 600, 0},
+	{"Australia/Sydney", 3447590399u, 660, 1},
+	{"Australia/Sydney", 3447590400u, 600, 0},
+	{"Australia/Sydney", 3439728000u, 660, 1},
+	{"Australia/Sydney", 3463315199u, 600, 0},
+	{"Australia/Sydney", 3463315200u, 660, 1},
+	{"Australia/Sydney", 3455452800u, 600, 0},
+	{"Australia/Sydney", 3479644799u, 660, 1},
+	{"Australia/Sydney", 3479644800u, 600, 0},
+	{"Australia/Sydney", 3471480000u, 660, 1},
+	{"Australia/Sydney", 3495369599u, 600, 0},
+	{"Australia/Sydney", 3495369600u, 660, 1},
+	{"Australia/Sydney", 3487507200u, 600, 0},
+	{"Australia/Sydney", 3511094399u, 660, 1},
+	{"Australia/Sydney", 3511094400u, 600, 0},
+	{"Australia/Sydney", 3503232000u, 660, 1},
+	{"Australia/Sydney", 3526819199u, 600, 0},
+	{"Australia/Sydney", 3526819200u, 660, 1},
+	{"Australia/Sydney", 3518956800u, 600, 0},
+	{"Australia/Sydney", 3542543999u, 660, 1},
+	{"Australia/Sydney", 3542544000u, 600, 0},
+	{"Australia/Sydney", 3534681600u, 660, 1},
+	{"Australia/Sydney", 3558268799u, 600, 0},
+	{"Australia/Sydney", 3558268800u, 660, 1},
+	{"Australia/Sydney", 3550406400u, 600, 0},
+	{"Australia/Sydney", 3573993599u, 660, 1},
+	{"Australia/Sydney", 3573993600u, 600, 0},
+	{"Australia/Sydney", 3566131200u, 660, 1},
+	{"Australia/Sydney", 3589718399u, 600, 0},
+	{"Australia/Sydney", 3589718400u, 660, 1},
+	{"Australia/Sydney", 3581856000u, 600, 0},
+	{"Australia/Sydney", 3605443199u, 660, 1},
+	{"Australia/Sydney", 3605443200u, 600, 0},
+	{"Australia/Sydney", 3597580800u, 660, 1},
+	{"Australia/Sydney", 3621167999u, 600, 0},
+	{"Australia/Sydney", 3621168000u, 660, 1},
+	{"Australia/Sydney", 3613305600u, 600, 0},
+	{"Australia/Sydney", 3636892799u, 660, 1},
+	{"Australia/Sydney", 3636892800u, 600, 0},
+	{"Australia/Sydney", 3629030400u, 660, 1},
+	{"Australia/Sydney", 3653222399u, 600, 0},
+	{"Australia/Sydney", 3653222400u, 660, 1},
+	{"Australia/Sydney", 3645057600u, 600, 0},
+	{"Australia/Sydney", 3668947199u, 660, 1},
+	{"Australia/Sydney", 3668947200u, 600, 0},
+	{"Australia/Sydney", 3661084800u, 660, 1},
+	{"Australia/Sydney", 3684671999u, 600, 0},
+	{"Australia/Sydney", 3684672000u, 660, 1},
+	{"Australia/Sydney", 3676809600u, 600, 0},
+	{"Australia/Sydney", 3700396799u, 660, 1},
+	{"Australia/Sydney", 3700396800u, 600, 0},
+	{"Australia/Sydney", 3692534400u, 660, 1},
+	{"Australia/Sydney", 3716121599u, 600, 0},
+	{"Australia/Sydney", 3716121600u, 660, 1},
+	{"Australia/Sydney", 3708259200u, 600, 0},
+	{"Australia/Sydney", 3731846399u, 660, 1},
+	{"Australia/Sydney", 3731846400u, 600, 0},
+	{"Australia/Sydney", 3723984000u, 660, 1},
+	{"Australia/Sydney", 3747571199u, 600, 0},
+	{"Australia/Sydney", 3747571200u, 660, 1},
+	{"Australia/Sydney", 3739708800u, 600, 0},
+	{"Australia/Sydney", 3763295999u, 660, 1},
+	{"Australia/Sydney", 3763296000u, 600, 0},
+	{"Australia/Sydney", 3755433600u, 660, 1},
+	{"Australia/Sydney", 3779020799u, 600, 0},
+	{"Australia/Sydney", 3779020800u, 660, 1},
+	{"Australia/Sydney", 3771158400u, 600, 0},
+	{"Australia/Sydney", 3794745599u, 660, 1},
+	{"Australia/Sydney", 3794745600u, 600, 0},
+	{"Australia/Sydney", 3786883200u, 660, 1},
+	{"Australia/Sydney", 3810470399u, 600, 0},
+	{"Australia/Sydney", 3810470400u, 660, 1},
+	{"Australia/Sydney", 3802608000u, 600, 0},
+	{"Australia/Sydney", 3826195199u, 660, 1},
+	{"Australia/Sydney", 3826195200u, 600, 0},
+	{"Australia/Sydney", 3818332800u, 660, 1},
+	{"Australia/Sydney", 3842524799u, 600, 0},
+	{"Australia/Sydney", 3842524800u, 660, 1},
+	{"Australia/Sydney", 3834360000u, 600, 0},
+	{"Australia/Sydney", 3858249599u, 660, 1},
+	{"Australia/Sydney", 3858249600u, 600, 0},
+	{"Australia/Sydney", 3850387200u, 660, 1},
+	{"Australia/Sydney", 3873974399u, 600, 0},
+	{"Australia/Sydney", 3873974400u, 660, 1},
+	{"Australia/Sydney", 3866112000u, 600, 0},
+	{"Australia/Sydney", 3889699199u, 660, 1},
+	{"Australia/Sydney", 3889699200u, 600, 0},
+	{"Australia/Sydney", 3881836800u, 660, 1},
+	{"Australia/Sydney", 3905423999u, 600, 0},
+	{"Australia/Sydney", 3905424000u, 660, 1},
+	{"Australia/Sydney", 3897561600u, 600, 0},
+	{"Australia/Sydney", 3921148799u, 660, 1},
+	{"Australia/Sydney", 3921148800u, 600, 0},
+	{"Australia/Sydney", 3913286400u, 660, 1},
+	{"Australia/Sydney", 3936873599u, 600, 0},
+	{"Australia/Sydney", 3936873600u, 660, 1},
+	{"Australia/Sydney", 3929011200u, 600, 0},
+	{"Australia/Sydney", 3952598399u, 660, 1},
+	{"Australia/Sydney", 3952598400u, 600, 0},
+	{"Australia/Sydney", 3944736000u, 660, 1},
+	{"Australia/Sydney", 3968323199u, 600, 0},
+	{"Australia/Sydney", 3968323200u, 660, 1},
+	{"Australia/Sydney", 3960460800u, 600, 0},
+	{"Australia/Sydney", 3984047999u, 660, 1},
+	{"Australia/Sydney", 3984048000u, 600, 0},
+	{"Australia/Sydney", 3976185600u, 660, 1},
+	{"Australia/Sydney", 4000377599u, 600, 0},
+	{"Australia/Sydney", 4000377600u, 660, 1},
+	{"Australia/Sydney", 3992212800u, 600, 0},
+	{"Australia/Sydney", 4016102399u, 660, 1},
+	{"Australia/Sydney", 4016102400u, 600, 0},
+	{"Australia/Sydney", 4008240000u, 660, 1},
+	{"Australia/Sydney", 4031827199u, 600, 0},
+	{"Australia/Sydney", 4031827200u, 660, 1},
+	{"Australia/Sydney", 4023964800u, 600, 0},
+	{"Australia/Sydney", 4047551999u, 660, 1},
+	{"Australia/Sydney", 4047552000u, 600, 0},
+	{"Australia/Sydney", 4039689600u, 660, 1},
+	{"Australia/Sydney", 4063276799u, 600, 0},
+	{"Australia/Sydney", 4063276800u, 660, 1},
+	{"Australia/Sydney", 4055414400u, 600, 0},
+	{"Australia/Sydney", 4079001599u, 660, 1},
+	{"Australia/Sydney", 4079001600u, 600, 0},
+	{"Australia/Sydney", 4071139200u, 660, 1},
+	{"Australia/Sydney", 4094726399u, 600, 0},
+	{"Australia/Sydney", 4094726400u, 660, 1},
+	{"Australia/Sydney", 4086864000u, 600, 0},
+	{"Australia/Sydney", 4110451199u, 660, 1},
+	{"Australia/Sydney", 4110451200u, 600, 0},
+	{"Australia/Sydney", 4102588800u, 660, 1},
+	{"Australia/Sydney", 4126175999u, 600, 0},
+	{"Australia/Sydney", 4126176000u, 660, 1},
+	{"Australia/Sydney", 4118313600u, 600, 0},
+	{"Australia/Sydney", 4141900799u, 660, 1},
+	{"Australia/Sydney", 4141900800u, 600, 0},
+	{"Australia/Sydney", 4134038400u, 660, 1},
+	{"Australia/Sydney", 4157625599u, 600, 0},
+	{"Australia/Sydney", 4157625600u, 660, 1},
+	{"Australia/Sydney", 4149763200u, 600, 0},
+	{"Australia/Sydney", 4173350399u, 660, 1},
+	{"Australia/Sydney", 4173350400u, 600, 0},
+	{"Australia/Sydney", 4165488000u, 660, 1},
+	{"Australia/Sydney", 4189075199u, 600, 0},
+	{"Australia/Sydney", 4189075200u, 660, 1},
+	{"Australia/Sydney", 4181212800u, 600, 0},
+	{"Australia/Sydney", 4204799999u, 660, 1},
+	{"Australia/Sydney", 4204800000u, 600, 0},
+	{"Australia/Sydney", 4196937600u, 660, 1},
+	{"Australia/Sydney", 4221129599u, 600, 0},
+	{"Australia/Sydney", 4221129600u, 660, 1},
+	{"Australia/Sydney", 4212964800u, 600, 0},
+	{"Australia/Sydney", 4236854399u, 660, 1},
+	{"Australia/Sydney", 4236854400u, 600, 0},
+	{"Australia/Sydney", 4228992000u, 660, 1},
+	{"Australia/Sydney", 4252579199u, 600, 0},
+	{"Australia/Sydney", 4252579200u, 660, 1},
+	{"Australia/Sydney", 4244716800u, 600, 0},
+	{"Australia/Sydney", 4268303999u, 660, 1},
+	{"Australia/Sydney", 4268304000u, 600, 0},
+	{"Australia/Sydney", 4260441600u, 660, 1},
+	{"Australia/Sydney", 4284028799u, 600, 0},
+	{"Australia/Sydney", 4284028800u, 660, 1},
+	{"Australia/Sydney", 4276166400u, 600, 0},
+	{"Australia/Sydney", 4294967295u, 660, 1},
+	// Europe/Berlin
+	{"Europe/Berlin", 1262304000u, 60, 0},
+	{"Europe/Berlin", 1269737999u, 60, 0},
+	{"Europe/Berlin", 1269738000u, 120, 1},
+	{"Europe/Berlin", 1266021000u, 60, 0},
+	{"Europe/Berlin", 1288486799u, 120, 1},
+	{"Europe/Berlin", 1288486800u, 60, 0},
+	{"Europe/Berlin", 1279112400u, 120, 1},
+	{"Europe/Berlin", 1301187599u, 60, 0},
+	{"Europe/Berlin", 1301187600u, 120, 1},
+	{"Europe/Berlin", 1294837200u, 60, 0},
+	{"Europe/Berlin", 1319936399u, 120, 1},
+	{"Europe/Berlin", 1319936400u, 60, 0},
+	{"Europe/Berlin", 1310562000u, 120, 1},
+	{"Europe/Berlin", 1332637199u, 60, 0},
+	{"Europe/Berlin", 1332637200u, 120, 1},
+	{"Europe/Berlin", 1326286800u, 60, 0},
+	{"Europe/Berlin", 1351385999u, 120, 1},
+	{"Europe/Berlin", 1351386000u, 60, 0},
+	{"Europe/Berlin", 1342011600u, 120, 1},
+	{"Europe/Berlin", 1364691599u, 60, 0},
+	{"Europe/Berlin", 1364691600u, 120, 1},
+	{"Europe/Berlin", 1358038800u, 60, 0},
+	{"Europe/Berlin", 1382835599u, 120, 1},
+	{"Europe/Berlin", 1382835600u, 60, 0},
+	{"Europe/Berlin", 1373763600u, 120, 1},
+	{"Europe/Berlin", 1396141199u, 60, 0},
+	{"Europe/Berlin", 1396141200u, 120, 1},
+	{"Europe/Berlin", 1389488400u, 60, 0},
+	{"Europe/Berlin", 1414285199u, 120, 1},
+	{"Europe/Berlin", 1414285200u, 60, 0},
+	{"Europe/Berlin", 1405213200u, 120, 1},
+	{"Europe/Berlin", 1427590799u, 60, 0},
+	{"Europe/Berlin", 1427590800u, 120, 1},
+	{"Europe/Berlin", 1420938000u, 60, 0},
+	{"Europe/Berlin", 1445734799u, 120, 1},
+	{"Europe/Berlin", 1445734800u, 60, 0},
+	{"Europe/Berlin", 1436662800u, 120, 1},
+	{"Europe/Berlin", 1459040399u, 60, 0},
+	{"Europe/Berlin", 1459040400u, 120, 1},
+	{"Europe/Berlin", 1452387600u, 60, 0},
+	{"Europe/Berlin", 1477789199u, 120, 1},
+	{"Europe/Berlin", 1477789200u, 60, 0},
+	{"Europe/Berlin", 1468414800u, 120, 1},
+	{"Europe/Berlin", 1490489999u, 60, 0},
+	{"Europe/Berlin", 1490490000u, 120, 1},
+	{"Europe/Berlin", 1484139600u, 60, 0},
+	{"Europe/Berlin", 1509238799u, 120, 1},
+	{"Europe/Berlin", 1509238800u, 60, 0},
+	{"Europe/Berlin", 1499864400u, 120, 1},
+	{"Europe/Berlin", 1521939599u, 60, 0},
+	{"Europe/Berlin", 1521939600u, 120, 1},
+	{"Europe/Berlin", 1515589200u, 60, 0},
+	{"Europe/Berlin", 1540688399u, 120, 1},
+	{"Europe/Berlin", 1540688400u, 60, 0},
+	{"Europe/Berlin", 1531314000u, 120, 1},
+	{"Europe/Berlin", 1553993999u, 60, 0},
+	{"Europe/Berlin", 1553994000u, 120, 1},
+	{"Europe/Berlin", 1547341200u, 60, 0},
+	{"Europe/Berlin", 1572137999u, 120, 1},
+	{"Europe/Berlin", 1572138000u, 60, 0},
+	{"Europe/Berlin", 1563066000u, 120, 1},
+	{"Europe/Berlin", 1585443599u, 60, 0},
+	{"Europe/Berlin", 1585443600u, 120, 1},
+	{"Europe/Berlin", 1578790800u, 60, 0},
+	{"Europe/Berlin", 1603587599u, 120, 1},
+	{"Europe/Berlin", 1603587600u, 60, 0},
+	{"Europe/Berlin", 1594515600u, 120, 1},
+	{"Europe/Berlin", 1616893199u, 60, 0},
+	{"Europe/Berlin", 1616893200u, 120, 1},
+	{"Europe/Berlin", 1610240400u, 60, 0},
+	{"Europe/Berlin", 1635641999u, 120, 1},
+	{"Europe/Berlin", 1635642000u, 60, 0},
+	{"Europe/Berlin", 1626267600u, 120, 1},
+	{"Europe/Berlin", 1648342799u, 60, 0},
+	{"Europe/Berlin", 1648342800u, 120, 1},
+	{"Europe/Berlin", 1641992400u, 60, 0},
+	{"Europe/Berlin", 1667091599u, 120, 1},
+	{"Europe/Berlin", 1667091600u, 60, 0},
+	{"Europe/Berlin", 1657717200u, 120, 1},
+	{"Europe/Berlin", 1679792399u, 60, 0},
+	{"Europe/Berlin", 1679792400u, 120, 1},
+	{"Europe/Berlin", 1673442000u, 60, 0},
+	{"Europe/Berlin", 1698541199u, 120, 1},
+	{"Europe/Berlin", 1698541200u, 60, 0},
+	{"Europe/Berlin", 1689166800u, 120, 1},
+	{"Europe/Berlin", 1711846799u, 60, 0},
+	{"Europe/Berlin", 1711846800u, 120, 1},
+	{"Europe/Berlin", 1705194000u, 60, 0},
+	{"Europe/Berlin", 1729990799u, 120, 1},
+	{"Europe/Berlin", 1729990800u, 60, 0},
+	{"Europe/Berlin", 1720918800u, 120, 1},
+	{"Europe/Berlin", 1743296399u, 60, 0},
+	{"Europe/Berlin", 1743296400u, 120, 1},
+	{"Europe/Berlin", 1736643600u, 60, 0},
+	{"Europe/Berlin", 1761440399u, 120, 1},
+	{"Europe/Berlin", 1761440400u, 60, 0},
+	{"Europe/Berlin", 1752368400u, 120, 1},
+	{"Europe/Berlin", 1774745999u, 60, 0},
+	{"Europe/Berlin", 1774746000u, 120, 1},
+	{"Europe/Berlin", 1768093200u, 60, 0},
+	{"Europe/Berlin", 1792889999u, 120, 1},
+	{"Europe/Berlin", 1792890000u, 60, 0},
+	{"Europe/Berlin", 1783818000u, 120, 1},
+	{"Europe/Berlin", 1806195599u, 60, 0},
+	{"Europe/Berlin", 1806195600u, 120, 1},
+	{"Europe/Berlin", 1799542800u, 60, 0},
+	{"Europe/Berlin", 1824944399u, 120, 1},
+	{"Europe/Berlin", 1824944400u, 60, 0},
+	{"Europe/Berlin", 1815570000u, 120, 1},
+	{"Europe/Berlin", 1837645199u, 60, 0},
+	{"Europe/Berlin", 1837645200u, 120, 1},
+	{"Europe/Berlin", 1831294800u, 60, 0},
+	{"Europe/Berlin", 1856393999u, 120, 1},
+	{"Europe/Berlin", 1856394000u, 60, 0},
+	{"Europe/Berlin", 1847019600u, 120, 1},
+	{"Europe/Berlin", 1869094799u, 60, 0},
+	{"Europe/Berlin", 1869094800u, 120, 1},
+	{"Europe/Berlin", 1862744400u, 60, 0},
+	{"Europe/Berlin", 1887843599u, 120, 1},
+	{"Europe/Berlin", 1887843600u, 60, 0},
+	{"Europe/Berlin", 1878469200u, 120, 1},
+	{"Europe/Berlin", 1901149199u, 60, 0},
+	{"Europe/Berlin", 1901149200u, 120, 1},
+	{"Europe/Berlin", 1894496400u, 60, 0},
+	{"Europe/Berlin", 1919293199u, 120, 1},
+	{"Europe/Berlin", 1919293200u, 60, 0},
+	{"Europe/Berlin", 1910221200u, 120, 1},
+	{"Europe/Berlin", 1932598799u, 60, 0},
+	{"Europe/Berlin", 1932598800u, 120, 1},
+	{"Europe/Berlin", 1925946000u, 60, 0},
+	{"Europe/Berlin", 1950742799u, 120, 1},
+	{"Europe/Berlin", 1950742800u, 60, 0},
+	{"Europe/Berlin", 1941670800u, 120, 1},
+	{"Europe/Berlin", 1964048399u, 60, 0},
+	{"Europe/Berlin", 1964048400u, 120, 1},
+	{"Europe/Berlin", 1957395600u, 60, 0},
+	{"Europe/Berlin", 1982797199u, 120, 1},
+	{"Europe/Berlin", 1982797200u, 60, 0},
+	{"Europe/Berlin", 1973422800u, 120, 1},
+	{"Europe/Berlin", 1995497999u, 60, 0},
+	{"Europe/Berlin", 1995498000u, 120, 1},
+	{"Europe/Berlin", 1989147600u, 60, 0},
+	{"Europe/Berlin", 2014246799u, 120, 1},
+	{"Europe/Berlin", 2014246800u, 60, 0},
+	{"Europe/Berlin", 2004872400u, 120, 1},
+	{"Europe/Berlin", 2026947599u, 60, 0},
+	{"Europe/Berlin", 2026947600u, 120, 1},
+	{"Europe/Berlin", 2020597200u, 60, 0},
+	{"Europe/Berlin", 2045696399u, 120, 1},
+	{"Europe/Berlin", 2045696400u, 60, 0},
+	{"Europe/Berlin", 2036322000u, 120, 1},
+	{"Europe/Berlin", 2058397199u, 60, 0},
+	{"Europe/Berlin", 2058397200u, 120, 1},
+	{"Europe/Berlin", 2052046800u, 60, 0},
+	{"Europe/Berlin", 2077145999u, 120, 1},
+	{"Europe/Berlin", 2077146000u, 60, 0},
+	{"Europe/Berlin", 2067771600u, 120, 1},
+	{"Europe/Berlin", 2090451599u, 60, 0},
+	{"Europe/Berlin", 2090451600u, 120, 1},
+	{"Europe/Berlin", 2083798800u, 60, 0},
+	{"Europe/Berlin", 2108595599u, 120, 1},
+	{"Europe/Berlin", 2108595600u, 60, 0},
+	{"Europe/Berlin", 2099523600u, 120, 1},
+	{"Europe/Berlin", 2121901199u, 60, 0},
+	{"Europe/Berlin", 2121901200u, 120, 1},
+	{"Europe/Berlin", 2115248400u, 60, 0},
+	{"Europe/Berlin", 2140045199u, 120, 1},
+	{"Europe/Berlin", 2140045200u, 60, 0},
+	{"Europe/Berlin", 2130973200u, 120, 1},
+	{"Europe/Berlin", 2153350799u, 60, 0},
+	{"Europe/Berlin", 2153350800u, 120, 1},
+	{"Europe/Berlin", 2146698000u, 60, 0},
+	{"Europe/Berlin", 2172099599u, 120, 1},
+	{"Europe/Berlin", 2172099600u, 60, 0},
+	{"Europe/Berlin", 2162725200u, 120, 1},
+	{"Europe/Berlin", 2184800399u, 60, 0},
+	{"Europe/Berlin", 2184800400u, 120, 1},
+	{"Europe/Berlin", 2178450000u, 60, 0},
+	{"Europe/Berlin", 2203549199u, 120, 1},
+	{"Europe/Berlin", 2203549200u, 60, 0},
+	{"Europe/Berlin", 2194174800u, 120, 1},
+	{"Europe/Berlin", 2216249999u, 60, 0},
+	{"Europe/Berlin", 2216250000u, 120, 1},
+	{"Europe/Berlin", 2209899600u, 60, 0},
+	{"Europe/Berlin", 2234998799u, 120, 1},
+	{"Europe/Berlin", 2234998800u, 60, 0},
+	{"Europe/Berlin", 2225624400u, 120, 1},
+	{"Europe/Berlin", 2248304399u, 60, 0},
+	{"Europe/Berlin", 2248304400u, 120, 1},
+	{"Europe/Berlin", 2241651600u, 60, 0},
+	{"Europe/Berlin", 2266448399u, 120, 1},
+	{"Europe/Berlin", 2266448400u, 60, 0},
+	{"Europe/Berlin", 2257376400u, 120, 1},
+	{"Europe/Berlin", 2279753999u, 60, 0},
+	{"Europe/Berlin", 2279754000u, 120, 1},
+	{"Europe/Berlin", 2273101200u, 60, 0},
+	{"Europe/Berlin", 2297897999u, 120, 1},
+	{"Europe/Berlin", 2297898000u, 60, 0},
+	{"Europe/Berlin", 2288826000u, 120, 1},
+	{"Europe/Berlin", 2311203599u, 60, 0},
+	{"Europe/Berlin", 2311203600u, 120, 1},
+	{"Europe/Berlin", 2304550800u, 60, 0},
+	{"Europe/Berlin", 2329347599u, 120, 1},
+	{"Europe/Berlin", 2329347600u, 60, 0},
+	{"Europe/Berlin", 2320275600u, 120, 1},
+	{"Europe/Berlin", 2342653199u, 60, 0},
+	{"Europe/Berlin", 2342653200u, 120, 1},
+	{"Europe/Berlin", 2336000400u, 60, 0},
+	{"Europe/Berlin", 2361401999u, 120, 1},
+	{"Europe/Berlin", 2361402000u, 60, 0},
+	{"Europe/Berlin", 2352027600u, 120, 1},
+	{"Europe/Berlin", 2374102799u, 60, 0},
+	{"Europe/Berlin", 2374102800u, 120, 1},
+	{"Europe/Berlin", 2367752400u, 60, 0},
+	{"Europe/Berlin", 2392851599u, 120, 1},
+	{"Europe/Berlin", 2392851600u, 60, 0},
+	{"Europe/Berlin", 2383477200u, 120, 1},
+	{"Europe/Berlin", 2405552399u, 60, 0},
+	{"Europe/Berlin", 2405552400u, 120, 1},
+	{"Europe/Berlin", 2399202000u, 60, 0},
+	{"Europe/Berlin", 2424301199u, 120, 1},
+	{"Europe/Berlin", 2424301200u, 60, 0},
+	{"Europe/Berlin", 2414926800u, 120, 1},
+	{"Europe/Berlin", 2437606799u, 60, 0},
+	{"Europe/Berlin", 2437606800u, 120, 1},
+	{"Europe/Berlin", 2430954000u, 60, 0},
+	{"Europe/Berlin", 2455750799u, 120, 1},
+	{"Europe/Berlin", 2455750800u, 60, 0},
+	{"Europe/Berlin", 2446678800u, 120, 1},
+	{"Europe/Berlin", 2469056399u, 60, 0},
+	{"Europe/Berlin", 2469056400u, 120, 1},
+	{"Europe/Berlin", 2462403600u, 60, 0},
+	{"Europe/Berlin", 2487200399u, 120, 1},
+	{"Europe/Berlin", 2487200400u, 60, 0},
+	{"Europe/Berlin", 2478128400u, 120, 1},
+	{"Europe/Berlin", 2500505999u, 60, 0},
+	{"Europe/Berlin", 2500506000u, 120, 1},
+	{"Europe/Berlin", 2493853200u, 60, 0},
+	{"Europe/Berlin", 2519254799u, 120, 1},
+	{"Europe/Berlin", 2519254800u, 60, 0},
+	{"Europe/Berlin", 2509880400u, 120, 1},
+	{"Europe/Berlin", 2531955599u, 60, 0},
+	{"Europe/Berlin", 2531955600u, 120, 1},
+	{"Europe/Berlin", 2525605200u, 60, 0},
+	{"Europe/Berlin", 2550704399u, 120, 1},
+	{"Europe/Berlin", 2550704400u, 60, 0},
+	{"Europe/Berlin", 2541330000u, 120, 1},
+	{"Europe/Berlin", 2563405199u, 60, 0},
+	{"Europe/Berlin", 2563405200u, 120, 1},
+	{"Europe/Berlin", 2557054800u, 60, 0},
+	{"Europe/Berlin", 2582153999u, 120, 1},
+	{"Europe/Berlin", 2582154000u, 60, 0},
+	{"Europe/Berlin", 2572779600u, 120, 1},
+	{"Europe/Berlin", 2595459599u, 60, 0},
+	{"Europe/Berlin", 2595459600u, 120, 1},
+	{"Europe/Berlin", 2588806800u, 60, 0},
+	{"Europe/Berlin", 2613603599u, 120, 1},
+	{"Europe/Berlin", 2613603600u, 60, 0},
+	{"Europe/Berlin", 2604531600u, 120, 1},
+	{"Europe/Berlin", 2626909199u, 60, 0},
+	{"Europe/Berlin", 2626909200u, 120, 1},
+	{"Europe/Berlin", 2620256400u, 60, 0},
+	{"Europe/Berlin", 2645053199u, 120, 1},
+	{"Europe/Berlin", 2645053200u, 60, 0},
+	{"Europe/Berlin", 2635981200u, 120, 1},
+	{"Europe/Berlin", 2658358799u, 60, 0},
+	{"Europe/Berlin", 2658358800u, 120, 1},
+	{"Europe/Berlin", 2651706000u, 60, 0},
+	{"Europe/Berlin", 2676502799u, 120, 1},
+	{"Europe/Berlin", 2676502800u, 60, 0},
+	{"Europe/Berlin", 2667430800u, 120, 1},
+	{"Europe/Berlin", 2689808399u, 60, 0},
+	{"Europe/Berlin", 2689808400u, 120, 1},
+	{"Europe/Berlin", 2683155600u, 60, 0},
+	{"Europe/Berlin", 2708557199u, 120, 1},
+	{"Europe/Berlin", 2708557200u, 60, 0},
+	{"Europe/Berlin", 2699182800u, 120, 1},
+	{"Europe/Berlin", 2721257999u, 60, 0},
+	{"Europe/Berlin", 2721258000u, 120, 1},
+	{"Europe/Berlin", 2714907600u, 60, 0},
+	{"Europe/Berlin", 2740006799u, 120, 1},
+	{"Europe/Berlin", 2740006800u, 60, 0},
+	{"Europe/Berlin", 2730632400u, 120, 1},
+	{"Europe/Berlin", 2752707599u, 60, 0},
+	{"Europe/Berlin", 2752707600u, 120, 1},
+	{"Europe/Berlin", 2746357200u, 60, 0},
+	{"Europe/Berlin", 2771456399u, 120, 1},
+	{"Europe/Berlin", 2771456400u, 60, 0},
+	{"Europe/Berlin", 2762082000u, 120, 1},
+	{"Europe/Berlin", 2784761999u, 60, 0},
+	{"Europe/Berlin", 2784762000u, 120, 1},
+	{"Europe/Berlin", 2778109200u, 60, 0},
+	{"Europe/Berlin", 2802905999u, 120, 1},
+	{"Europe/Berlin", 2802906000u, 60, 0},
+	{"Europe/Berlin", 2793834000u, 120, 1},
+	{"Europe/Berlin", 2816211599u, 60, 0},
+	{"Europe/Berlin", 2816211600u, 120, 1},
+	{"Europe/Berlin", 2809558800u, 60, 0},
+	{"Europe/Berlin", 2834355599u, 120, 1},
+	{"Europe/Berlin", 2834355600u, 60, 0},
+	{"Europe/Berlin", 2825283600u, 120, 1},
+	{"Europe/Berlin", 2847661199u, 60, 0},
+	{"Europe/Berlin", 2847661200u, 120, 1},
+	{"Europe/Berlin", 2841008400u, 60, 0},
+	{"Europe/Berlin", 2866409999u, 120, 1},
+	{"Europe/Berlin", 2866410000u, 60, 0},
+	{"Europe/Berlin", 2857035600u, 120, 1},
+	{"Europe/Berlin", 2879110799u, 60, 0},
+	{"Europe/Berlin", 2879110800u, 120, 1},
+	{"Europe/Berlin", 2872760400u, 60, 0},
+	{"Europe/Berlin", 2897859599u, 120, 1},
+	{"Europe/Berlin", 2897859600u, 60, 0},
+	{"Europe/Berlin", 2888485200u, 120, 1},
+	{"Europe/Berlin", 2910560399u, 60, 0},
+	{"Europe/Berlin", 2910560400u, 120, 1},
+	{"Europe/Berlin", 2904210000u, 60, 0},
+	{"Europe/Berlin", 2929309199u, 120, 1},
+	{"Europe/Berlin", 2929309200u, 60, 0},
+	{"Europe/Berlin", 2919934800u, 120, 1},
+	{"Europe/Berlin", 2942009999u, 60, 0},
+	{"Europe/Berlin", 2942010000u, 120, 1},
+	{"Europe/Berlin", 2935659600u, 60, 0},
+	{"Europe/Berlin", 2960758799u, 120, 1},
+	{"Europe/Berlin", 2960758800u, 60, 0},
+	{"Europe/Berlin", 2951384400u, 120, 1},
+	{"Europe/Berlin", 2974064399u, 60, 0},
+	{"Europe/Berlin", 2974064400u, 120, 1},
+	{"Europe/Berlin", 2967411600u, 60, 0},
+	{"Europe/Berlin", 2992208399u, 120, 1},
+	{"Europe/Berlin", 2992208400u, 60, 0},
+	{"Europe/Berlin", 2983136400u, 120, 1},
+	{"Europe/Berlin", 3005513999u, 60, 0},
+	{"Europe/Berlin", 3005514000u, 120, 1},
+	{"Europe/Berlin", 2998861200u, 60, 0},
+	{"Europe/Berlin", 3023657999u, 120, 1},
+	{"Europe/Berlin", 3023658000u, 60, 0},
+	{"Europe/Berlin", 3014586000u, 120, 1},
+	{"Europe/Berlin", 3036963599u, 60, 0},
+	{"Europe/Berlin", 3036963600u, 120, 1},
+	{"Europe/Berlin", 3030310800u, 60, 0},
+	{"Europe/Berlin", 3055712399u, 120, 1},
+	{"Europe/Berlin", 3055712400u, 60, 0},
+	{"Europe/Berlin", 3046338000u, 120, 1},
+	{"Europe/Berlin", 3068413199u, 60, 0},
+	{"Europe/Berlin", 3068413200u, 120, 1},
+	{"Europe/Berlin", 3062062800u, 60, 0},
+	{"Europe/Berlin", 3087161999u, 120, 1},
+	{"Europe/Berlin", 3087162000u, 60, 0},
+	{"Europe/Berlin", 3077787600u, 120, 1},
+	{"Europe/Berlin", 3099862799u, 60, 0},
+	{"Europe/Berlin", 3099862800u, 120, 1},
+	{"Europe/Berlin", 3093512400u, 60, 0},
+	{"Europe/Berlin", 3118611599u, 120, 1},
+	{"Europe/Berlin", 3118611600u, 60, 0},
+	{"Europe/Berlin", 3109237200u, 120, 1},
+	{"Europe/Berlin", 3131917199u, 60, 0},
+	{"Europe/Berlin", 3131917200u, 120, 1},
+	{"Europe/Berlin", 3125264400u, 60, 0},
+	{"Europe/Berlin", 3150061199u, 120, 1},
+	{"Europe/Berlin", 3150061200u, 60, 0},
+	{"Europe/Berlin", 3140989200u, 120, 1},
+	{"Europe/Berlin", 3163366799u, 60, 0},
+	{"Europe/Berlin", 3163366800u, 120, 1},
+	{"Europe/Berlin", 3156714000u, 60, 0},
+	{"Europe/Berlin", 3181510799u, 120, 1},
+	{"Europe/Berlin", 3181510800u, 60, 0},
+	{"Europe/Berlin", 3172438800u, 120, 1},
+	{"Europe/Berlin", 3194816399u, 60, 0},
+	{"Europe/Berlin", 3194816400u, 120, 1},
+	{"Europe/Berlin", 3188163600u, 60, 0},
+	{"Europe/Berlin", 3212960399u, 120, 1},
+	{"Europe/Berlin", 3212960400u, 60, 0},
+	{"Europe/Berlin", 3203888400u, 120, 1},
+	{"Europe/Berlin", 3226265999u, 60, 0},
+	{"Europe/Berlin", 3226266000u, 120, 1},
+	{"Europe/Berlin", 3219613200u, 60, 0},
+	{"Europe/Berlin", 3245014799u, 120, 1},
+	{"Europe/Berlin", 3245014800u, 60, 0},
+	{"Europe/Berlin", 3235640400u, 120, 1},
+	{"Europe/Berlin", 3257715599u, 60, 0},
+	{"Europe/Berlin", 3257715600u, 120, 1},
+	{"Europe/Berlin", 3251365200u, 60, 0},
+	{"Europe/Berlin", 3276464399u, 120, 1},
+	{"Europe/Berlin", 3276464400u, 60, 0},
+	{"Europe/Berlin", 3267090000u, 120, 1},
+	{"Europe/Berlin", 3289165199u, 60, 0},
+	{"Europe/Berlin", 3289165200u, 120, 1},
+	{"Europe/Berlin", 3282814800u, 60, 0},
+	{"Europe/Berlin", 3307913999u, 120, 1},
+	{"Europe/Berlin", 3307914000u, 60, 0},
+	{"Europe/Berlin", 3298539600u, 120, 1},
+	{"Europe/Berlin", 3321219599u, 60, 0},
+	{"Europe/Berlin", 3321219600u, 120, 1},
+	{"Europe/Berlin", 3314566800u, 60, 0},
+	{"Europe/Berlin", 3339363599u, 120, 1},
+	{"Europe/Berlin", 3339363600u, 60, 0},
+	{"Europe/Berlin", 3330291600u, 120, 1},
+	{"Europe/Berlin", 3352669199u, 60, 0},
+	{"Europe/Berlin", 3352669200u, 120, 1},
+	{"Europe/Berlin", 3346016400u, 60, 0},
+	{"Europe/Berlin", 3370813199u, 120, 1},
+	{"Europe/Berlin", 3370813200u, 60, 0},
+	{"Europe/Berlin", 3361741200u, 120, 1},
+	{"Europe/Berlin", 3384118799u, 60, 0},
+	{"Europe/Berlin", 3384118800u, 120, 1},
+	{"Europe/Berlin", 3377466000u, 60, 0},
+	{"Europe/Berlin", 3402867599u, 120, 1},
+	{"Europe/Berlin", 3402867600u, 60, 0},
+	{"Europe/Berlin", 3393493200u, 120, 1},
+	{"Europe/Berlin", 3415568399u, 60, 0},
+	{"Europe/Berlin", 3415568400u, 120, 1},
+	{"Europe/Berlin", 3409218000u, 60, 0},
+	{"Europe/Berlin", 3434317199u, 120, 1},
+	{"Europe/Berlin", 3434317200u, 60, 0},
+	{"Europe/Berlin", 3424942800u, 120, 1},
+	{"Europe/Berlin", 3447017999u, 60, 0},
+	{"Europe/Berlin", 3447018000u, 120, 1},
+	{"Europe/Berlin", 3440667600u, 60, 0},
+	{"Europe/Berlin", 3465766799u, 120, 1},
+	{"Europe/Berlin", 3465766800u, 60, 0},
+	{"Europe/Berlin", 3456392400u, 120, 1},
+	{"Europe/Berlin", 3479072399u, 60, 0},
+	{"Europe/Berlin", 3479072400u, 120, 1},
+	{"Europe/Berlin", 3472419600u, 60, 0},
+	{"Europe/Berlin", 3497216399u, 120, 1},
+	{"Europe/Berlin", 3497216400u, 60, 0},
+	{"Europe/Berlin", 3488144400u, 120, 1},
+	{"Europe/Berlin", 3510521999u, 60, 0},
+	{"Europe/Berlin", 3510522000u, 120, 1},
+	{"Europe/Berlin", 3503869200u, 60, 0},
+	{"Europe/Berlin", 3528665999u, 120, 1},
+	{"Europe/Berlin", 3528666000u, 60, 0},
+	{"Europe/Berlin", 3519594000u, 120, 1},
+	{"Europe/Berlin", 3541971599u, 60, 0},
+	{"Europe/Berlin", 3541971600u, 120, 1},
+	{"Europe/Berlin", 3535318800u, 60, 0},
+	{"Europe/Berlin", 3560115599u, 120, 1},
+	{"Europe/Berlin", 3560115600u, 60, 0},
+	{"Europe/Berlin", 3551043600u, 120, 1},
+	{"Europe/Berlin", 3573421199u, 60, 0},
+	{"Europe/Berlin", 3573421200u, 120, 1},
+	{"Europe/Berlin", 3566768400u, 60, 0},
+	{"Europe/Berlin", 3592169999u, 120, 1},
+	{"Europe/Berlin", 3592170000u, 60, 0},
+	{"Europe/Berlin", 3582795600u, 120, 1},
+	{"Europe/Berlin", 3604870799u, 60, 0},
+	{"Europe/Berlin", 3604870800u, 120, 1},
+	{"Europe/Berlin", 3598520400u, 60, 0},
+	{"Europe/Berlin", 3623619599u, 120, 1},
+	{"Europe/Berlin", 3623619600u, 60, 0},
+	{"Europe/Berlin", 3614245200u, 120, 1},
+	{"Europe/Berlin", 3636320399u, 60, 0},
+	{"Europe/Berlin", 3636320400u, 120, 1},
+	{"Europe/Berlin", 3629970000u, 60, 0},
+	{"Europe/Berlin", 3655069199u, 120, 1},
+	{"Europe/Berlin", 3655069200u, 60, 0},
+	{"Europe/Berlin", 3645694800u, 120, 1},
+	{"Europe/Berlin", 3668374799u, 60, 0},
+	{"Europe/Berlin", 3668374800u, 120, 1},
+	{"Europe/Berlin", 3661722000u, 60, 0},
+	{"Europe/Berlin", 3686518799u, 120, 1},
+	{"Europe/Berlin", 3686518800u, 60, 0},
+	{"Europe/Berlin", 3677446800u, 120, 1},
+	{"Europe/Berlin", 3699824399u, 60, 0},
+	{"Europe/Berlin", 3699824400u, 120, 1},
+	{"Europe/Berlin", 3693171600u, 60, 0},
+	{"Europe/Berlin", 3717968399u, 120, 1},
+	{"Europe/Berlin", 3717968400u, 60, 0},
+	{"Europe/Berlin", 3708896400u, 120, 1},
+	{"Europe/Berlin", 3731273999u, 60, 0},
+	{"Europe/Berlin", 3731274000u, 120, 1},
+	{"Europe/Berlin", 3724621200u, 60, 0},
+	{"Europe/Berlin", 3750022799u, 120, 1},
+	{"Europe/Berlin", 3750022800u, 60, 0},
+	{"Europe/Berlin", 3740648400u, 120, 1},
+	{"Europe/Berlin", 3762723599u, 60, 0},
+	{"Europe/Berlin", 3762723600u, 120, 1},
+	{"Europe/Berlin", 3756373200u, 60, 0},
+	{"Europe/Berlin", 3781472399u, 120, 1},
+	{"Europe/Berlin", 3781472400u, 60, 0},
+	{"Europe/Berlin", 3772098000u, 120, 1},
+	{"Europe/Berlin", 3794173199u, 60, 0},
+	{"Europe/Berlin", 3794173200u, 120, 1},
+	{"Europe/Berlin", 3787822800u, 60, 0},
+	{"Europe/Berlin", 3812921999u, 120, 1},
+	{"Europe/Berlin", 3812922000u, 60, 0},
+	{"Europe/Berlin", 3803547600u, 120, 1},
+	{"Europe/Berlin", 3825622799u, 60, 0},
+	{"Europe/Berlin", 3825622800u, 120, 1},
+	{"Europe/Berlin", 3819272400u, 60, 0},
+	{"Europe/Berlin", 3844371599u, 120, 1},
+	{"Europe/Berlin", 3844371600u, 60, 0},
+	{"Europe/Berlin", 3834997200u, 120, 1},
+	{"Europe/Berlin", 3857677199u, 60, 0},
+	{"Europe/Berlin", 3857677200u, 120, 1},
+	{"Europe/Berlin", 3851024400u, 60, 0},
+	{"Europe/Berlin", 3875821199u, 120, 1},
+	{"Europe/Berlin", 3875821200u, 60, 0},
+	{"Europe/Berlin", 3866749200u, 120, 1},
+	{"Europe/Berlin", 3889126799u, 60, 0},
+	{"Europe/Berlin", 3889126800u, 120, 1},
+	{"Europe/Berlin", 3882474000u, 60, 0},
+	{"Europe/Berlin", 3907270799u, 120, 1},
+	{"Europe/Berlin", 3907270800u, 60, 0},
+	{"Europe/Berlin", 3898198800u, 120, 1},
+	{"Europe/Berlin", 3920576399u, 60, 0},
+	{"Europe/Berlin", 3920576400u, 120, 1},
+	{"Europe/Berlin", 3913923600u, 60, 0},
+	{"Europe/Berlin", 3939325199u, 120, 1},
+	{"Europe/Berlin", 3939325200u, 60, 0},
+	{"Europe/Berlin", 3929950800u, 120, 1},
+	{"Europe/Berlin", 3952025999u, 60, 0},
+	{"Europe/Berlin", 3952026000u, 120, 1},
+	{"Europe/Berlin", 3945675600u, 60, 0},
+	{"Europe/Berlin", 3970774799u, 120, 1},
+	{"Europe/Berlin", 3970774800u, 60, 0},
+	{"Europe/Berlin", 3961400400u, 120, 1},
+	{"Europe/Berlin", 3983475599u, 60, 0},
+	{"Europe/Berlin", 3983475600u, 120, 1},
+	{"Europe/Berlin", 3977125200u, 60, 0},
+	{"Europe/Berlin", 4002224399u, 120, 1},
+	{"Europe/Berlin", 4002224400u, 60, 0},
+	{"Europe/Berlin", 3992850000u, 120, 1},
+	{"Europe/Berlin", 4015529999u, 60, 0},
+	{"Europe/Berlin", 4015530000u, 120, 1},
+	{"Europe/Berlin", 4008877200u, 60, 0},
+	{"Europe/Berlin", 4033673999u, 120, 1},
+	{"Europe/Berlin", 4033674000u, 60, 0},
+	{"Europe/Berlin", 4024602000u, 120, 1},
+	{"Europe/Berlin", 4046979599u, 60, 0},
+	{"Europe/Berlin", 4046979600u, 120, 1},
+	{"Europe/Berlin", 4040326800u, 60, 0},
+	{"Europe/Berlin", 4065123599u, 120, 1},
+	{"Europe/Berlin", 4065123600u, 60, 0},
+	{"Europe/Berlin", 4056051600u, 120, 1},
+	{"Europe/Berlin", 4078429199u, 60, 0},
+	{"Europe/Berlin", 4078429200u, 120, 1},
+	{"Europe/Berlin", 4071776400u, 60, 0},
+	{"Europe/Berlin", 4096573199u, 120, 1},
+	{"Europe/Berlin", 4096573200u, 60, 0},
+	{"Europe/Berlin", 4087501200u, 120, 1},
+	{"Europe/Berlin", 4109878799u, 60, 0},
+	{"Europe/Berlin", 4109878800u, 120, 1},
+	{"Europe/Berlin", 4103226000u, 60, 0},
+	{"Europe/Berlin", 4128627599u, 120, 1},
+	{"Europe/Berlin", 4128627600u, 60, 0},
+	{"Europe/Berlin", 4119253200u, 120, 1},
+	{"Europe/Berlin", 4141328399u, 60, 0},
+	{"Europe/Berlin", 4141328400u, 120, 1},
+	{"Europe/Berlin", 4134978000u, 60, 0},
+	{"Europe/Berlin", 4160077199u, 120, 1},
+	{"Europe/Berlin", 4160077200u, 60, 0},
+	{"Europe/Berlin", 4150702800u, 120, 1},
+	{"Europe/Berlin", 4172777999u, 60, 0},
+	{"Europe/Berlin", 4172778000u, 120, 1},
+	{"Europe/Berlin", 4166427600u, 60, 0},
+	{"Europe/Berlin", 4191526799u, 120, 1},
+	{"Europe/Berlin", 4191526800u, 60, 0},
+	{"Europe/Berlin", 4182152400u, 120, 1},
+	{"Europe/Berlin", 4204227599u, 60, 0},
+	{"Europe/Berlin", 4204227600u, 120, 1},
+	{"Europe/Berlin", 4197877200u, 60, 0},
+	{"Europe/Berlin", 4222976399u, 120, 1},
+	{"Europe/Berlin", 4222976400u, 60, 0},
+	{"Europe/Berlin", 4213602000u, 120, 1},
+	{"Europe/Berlin", 4236281999u, 60, 0},
+	{"Europe/Berlin", 4236282000u, 120, 1},
+	{"Europe/Berlin", 4229629200u, 60, 0},
+	{"Europe/Berlin", 4254425999u, 120, 1},
+	{"Europe/Berlin", 4254426000u, 60, 0},
+	{"Europe/Berlin", 4245354000u, 120, 1},
+	{"Europe/Berlin", 4267731599u, 60, 0},
+	{"Europe/Berlin", 4267731600u, 120, 1},
+	{"Europe/Berlin", 4261078800u, 60, 0},
+	{"Europe/Berlin", 4285875599u, 120, 1},
+	{"Europe/Berlin", 4285875600u, 60, 0},
+	{"Europe/Berlin", 4276803600u, 120, 1},
+	{"Europe/Berlin", 4294967295u, 60, 0},
+	// Europe/Istanbul
+	{"Europe/Istanbul", 1262304000u, 120, 0},
+	{"Europe/Istanbul", 1269737999u, 120, 0},
+	{"Europe/Istanbul", 1269738000u, 180, 1},
+	{"Europe/Istanbul", 1266021000u, 120, 0},
+	{"Europe/Istanbul", 1288486799u, 180, 1},
+	{"Europe/Istanbul", 1288486800u, 120, 0},
+	{"Europe/Istanbul", 1279112400u, 180, 1},
+	{"Europe/Istanbul", 1301273999u, 120, 0},
+	{"Europe/Istanbul", 1301274000u, 180, 1},
+	{"Europe/Istanbul", 1294880400u, 120, 0},
+	{"Europe/Istanbul", 1319936399u, 180, 1},
+	{"Europe/Istanbul", 1319936400u, 120, 0},
+	{"Europe/Istanbul", 1310605200u, 180, 1},
+	{"Europe/Istanbul", 1332637199u, 120, 0},
+	{"Europe/Istanbul", 1332637200u, 180, 1},
+	{"Europe/Istanbul", 1326286800u, 120, 0},
+	{"Europe/Istanbul", 1351385999u, 180, 1},
+	{"Europe/Istanbul", 1351386000u, 120, 0},
+	{"Europe/Istanbul", 1342011600u, 180, 1},
+	{"Europe/Istanbul", 1364691599u, 120, 0},
+	{"Europe/Istanbul", 1364691600u, 180, 1},
+	{"Europe/Istanbul", 1358038800u, 120, 0},
+	{"Europe/Istanbul", 1382835599u, 180, 1},
+	{"Europe/Istanbul", 1382835600u, 120, 0},
+	{"Europe/Istanbul", 1373763600u, 180, 1},
+	{"Europe/Istanbul", 1396227599u, 120, 0},
+	{"Europe/Istanbul", 1396227600u, 180, 1},
+	{"Europe/Istanbul", 1389531600u, 120, 0},
+	{"Europe/Istanbul", 1414285199u, 180, 1},
+	{"Europe/Istanbul", 1414285200u, 120, 0},
+	{"Europe/Istanbul", 1405256400u, 180, 1},
+	{"Europe/Istanbul", 1427590799u, 120, 0},
+	{"Europe/Istanbul", 1427590800u, 180, 1},
+	{"Europe/Istanbul", 1420938000u, 120, 0},
+	{"Europe/Istanbul", 1446944399u, 180, 1},
+	{"Europe/Istanbul", 1446944400u, 120, 0},
+	{"Europe/Istanbul", 1437267600u, 180, 1},
+	{"Europe/Istanbul", 1459040399u, 120, 0},
+	{"Europe/Istanbul", 1459040400u, 180, 1},
+	{"Europe/Istanbul", 1452992400u, 120, 0},
+	{"Europe/Istanbul", 1473195599u, 180, 1},
+	{"Europe/Istanbul", 1473195600u, 180, 0},
+	{"Europe/Istanbul", 1466118000u, 180, 1},
+	{"Europe/Istanbul", 4294967295u, 180, 0},
+	// Europe/London
+	{"Europe/London", 1262304000u, 0, 0},
+	{"Europe/London", 1269737999u, 0, 0},
+	{"Europe/London", 1269738000u, 60, 1},
+	{"Europe/London", 1266021000u, 0, 0},
+	{"Europe/London", 1288486799u, 60, 1},
+	{"Europe/London", 1288486800u, 0, 0},
+	{"Europe/London", 1279112400u, 60, 1},
+	{"Europe/London", 1301187599u, 0, 0},
+	{"Europe/London", 1301187600u, 60, 1},
+	{"Europe/London", 1294837200u, 0, 0},
+	{"Europe/London", 1319936399u, 60, 1},
+	{"Europe/London", 1319936400u, 0, 0},
+	{"Europe/London", 1310562000u, 60, 1},
+	{"Europe/London", 1332637199u, 0, 0},
+	{"Europe/London", 1332637200u, 60, 1},
+	{"Europe/London", 1326286800u, 0, 0},
+	{"Europe/London", 1351385999u, 60, 1},
+	{"Europe/London", 1351386000u, 0, 0},
+	{"Europe/London", 1342011600u, 60, 1},
+	{"Europe/London", 1364691599u, 0, 0},
+	{"Europe/London", 1364691600u, 60, 1},
+	{"Europe/London", 1358038800u, 0, 0},
+	{"Europe/London", 1382835599u, 60, 1},
+	{"Europe/London", 1382835600u, 0, 0},
+	{"Europe/London", 1373763600u, 60, 1},
+	{"Europe/London", 1396141199u, 0, 0},
+	{"Europe/London", 1396141200u, 60, 1},
+	{"Europe/London", 1389488400u, 0, 0},
+	{"Europe/London", 1414285199u, 60, 1},
+	{"Europe/London", 1414285200u, 0, 0},
+	{"Europe/London", 1405213200u, 60, 1},
+	{"Europe/London", 1427590799u, 0, 0},
+	{"Europe/London", 1427590800u, 60, 1},
+	{"Europe/London", 1420938000u, 0, 0},
+	{"Europe/London", 1445734799u, 60, 1},
+	{"Europe/London", 1445734800u, 0, 0},
+	{"Europe/London", 1436662800u, 60, 1},
+	{"Europe/London", 1459040399u, 0, 0},
+	{"Europe/London", 1459040400u, 60, 1},
+	{"Europe/London", 1452387600u, 0, 0},
+	{"Europe/London", 1477789199u, 60, 1},
+	{"Europe/London", 1477789200u, 0, 0},
+	{"Europe/London", 1468414800u, 60, 1},
+	{"Europe/London", 1490489999u, 0, 0},
+	{"Europe/London", 1490490000u, 60, 1},
+	{"Europe/London", 1484139600u, 0, 0},
+	{"Europe/London", 1509238799u, 60, 1},
+	{"Europe/London", 1509238800u, 0, 0},
+	{"Europe/London", 1499864400u, 60, 1},
+	{"Europe/London", 1521939599u, 0, 0},
+	{"Europe/London", 1521939600u, 60, 1},
+	{"Europe/London", 1515589200u, 0, 0},
+	{"Europe/London", 1540688399u, 60, 1},
+	{"Europe/London", 1540688400u, 0, 0},
+	{"Europe/London", 1531314000u, 60, 1},
+	{"Europe/London", 1553993999u, 0, 0},
+	{"Europe/London", 1553994000u, 60, 1},
+	{"Europe/London", 1547341200u, 0, 0},
+	{"Europe/London", 1572137999u, 60, 1},
+	{"Europe/London", 1572138000u, 0, 0},
+	{"Europe/London", 1563066000u, 60, 1},
+	{"Europe/London", 1585443599u, 0, 0},
+	{"Europe/London", 1585443600u, 60, 1},
+	{"Europe/London", 1578790800u, 0, 0},
+	{"Europe/London", 1603587599u, 60, 1},
+	{"Europe/London", 1603587600u, 0, 0},
+	{"Europe/London", 1594515600u, 60, 1},
+	{"Europe/London", 1616893199u, 0, 0},
+	{"Europe/London", 1616893200u, 60, 1},
+	{"Europe/London", 1610240400u, 0, 0},
+	{"Europe/London", 1635641999u, 60, 1},
+	{"Europe/London", 1635642000u, 0, 0},
+	{"Europe/London", 1626267600u, 60, 1},
+	{"Europe/London", 1648342799u, 0, 0},
+	{"Europe/London", 1648342800u, 60, 1},
+	{"Europe/London", 1641992400u, 0, 0},
+	{"Europe/London", 1667091599u, 60, 1},
+	{"Europe/London", 1667091600u, 0, 0},
+	{"Europe/London", 1657717200u, 60, 1},
+	{"Europe/London", 1679792399u, 0, 0},
+	{"Europe/London", 1679792400u, 60, 1},
+	{"Europe/London", 1673442000u, 0, 0},
+	{"Europe/London", 1698541199u, 60, 1},
+	{"Europe/London", 1698541200u, 0, 0},
+	{"Europe/London", 1689166800u, 60, 1},
+	{"Europe/London", 1711846799u, 0, 0},
+	{"Europe/London", 1711846800u, 60, 1},
+	{"Europe/London", 1705194000u, 0, 0},
+	{"Europe/London", 1729990799u, 60, 1},
+	{"Europe/London", 1729990800u, 0, 0},
+	{"Europe/London", 1720918800u, 60, 1},
+	{"Europe/London", 1743296399u, 0, 0},
+	{"Europe/London", 1743296400u, 60, 1},
+	{"Europe/London", 1736643600u, 0, 0},
+	{"Europe/London", 1761440399u, 60, 1},
+	{"Europe/London", 1761440400u, 0, 0},
+	{"Europe/London", 1752368400u, 60, 1},
+	{"Europe/London", 1774745999u, 0, 0},
+	{"Europe/London", 1774746000u, 60, 1},
+	{"Europe/London", 1768093200u, 0, 0},
+	{"Europe/London", 1792889999u, 60, 1},
+	{"Europe/London", 1792890000u, 0, 0},
+	{"Europe/London", 1783818000u, 60, 1},
+	{"Europe/London", 1806195599u, 0, 0},
+	{"Europe/London", 1806195600u, 60, 1},
+	{"Europe/London", 1799542800u, 0, 0},
+	{"Europe/London", 1824944399u, 60, 1},
+	{"Europe/London", 1824944400u, 0, 0},
+	{"Europe/London", 1815570000u, 60, 1},
+	{"Europe/London", 1837645199u, 0, 0},
+	{"Europe/London", 1837645200u, 60, 1},
+	{"Europe/London", 1831294800u, 0, 0},
+	{"Europe/London", 1856393999u, 60, 1},
+	{"Europe/London", 1856394000u, 0, 0},
+	{"Europe/London", 1847019600u, 60, 1},
+	{"Europe/London", 1869094799u, 0, 0},
+	{"Europe/London", 1869094800u, 60, 1},
+	{"Europe/London", 1862744400u, 0, 0},
+	{"Europe/London", 1887843599u, 60, 1},
+	{"Europe/London", 1887843600u, 0, 0},
+	{"Europe/London", 1878469200u, 60, 1},
+	{"Europe/London", 1901149199u, 0, 0},
+	{"Europe/London", 1901149200u, 60, 1},
+	{"Europe/London", 1894496400u, 0, 0},
+	{"Europe/London", 1919293199u, 60, 1},
+	{"Europe/London", 1919293200u, 0, 0},
+	{"Europe/London", 1910221200u, 60, 1},
+	{"Europe/London", 1932598799u, 0, 0},
+	{"Europe/London", 1932598800u, 60, 1},
+	{"Europe/London", 1925946000u, 0, 0},
+	{"Europe/London", 1950742799u, 60, 1},
+	{"Europe/London", 1950742800u, 0, 0},
+	{"Europe/London", 1941670800u, 60, 1},
+	{"Europe/London", 1964048399u, 0, 0},
+	{"Europe/London", 1964048400u, 60, 1},
+	{"Europe/London", 1957395600u, 0, 0},
+	{"Europe/London", 1982797199u, 60, 1},
+	{"Europe/London", 1982797200u, 0, 0},
+	{"Europe/London", 1973422800u, 60, 1},
+	{"Europe/London", 1995497999u, 0, 0},
+	{"Europe/London", 1995498000u, 60, 1},
+	{"Europe/London", 1989147600u, 0, 0},
+	{"Europe/London", 2014246799u, 60, 1},
+	{"Europe/London", 2014246800u, 0, 0},
+	{"Europe/London", 2004872400u, 60, 1},
+	{"Europe/London", 2026947599u, 0, 0},
+	{"Europe/London", 2026947600u, 60, 1},
+	{"Europe/London", 2020597200u, 0, 0},
+	{"Europe/London", 2045696399u, 60, 1},
+	{"Europe/London", 2045696400u, 0, 0},
+	{"Europe/London", 2036322000u, 60, 1},
+	{"Europe/London", 2058397199u, 0, 0},
+	{"Europe/London", 2058397200u, 60, 1},
+	{"Europe/London", 2052046800u, 0, 0},
+	{"Europe/London", 2077145999u, 60, 1},
+	{"Europe/London", 2077146000u, 0, 0},
+	{"Europe/London", 2067771600u, 60, 1},
+	{"Europe/London", 2090451599u, 0, 0},
+	{"Europe/London", 2090451600u, 60, 1},
+	{"Europe/London", 2083798800u, 0, 0},
+	{"Europe/London", 2108595599u, 60, 1},
+	{"Europe/London", 2108595600u, 0, 0},
+	{"Europe/London", 2099523600u, 60, 1},
+	{"Europe/London", 2121901199u, 0, 0},
+	{"Europe/London", 2121901200u, 60, 1},
+	{"Europe/London", 2115248400u, 0, 0},
+	{"Europe/London", 2140045199u, 60, 1},
+	{"Europe/London", 2140045200u, 0, 0},
+	{"Europe/London", 2130973200u, 60, 1},
+	{"Europe/London", 2153350799u, 0, 0},
+	{"Europe/London", 2153350800u, 60, 1},
+	{"Europe/London", 2146698000u, 0, 0},
+	{"Europe/London", 2172099599u, 60, 1},
+	{"Europe/London", 2172099600u, 0, 0},
+	{"Europe/London", 2162725200u, 60, 1},
+	{"Europe/London", 2184800399u, 0, 0},
+	{"Europe/London", 2184800400u, 60, 1},
+	{"Europe/London", 2178450000u, 0, 0},
+	{"Europe/London", 2203549199u, 60, 1},
+	{"Europe/London", 2203549200u, 0, 0},
+	{"Europe/London", 2194174800u, 60, 1},
+	{"Europe/London", 2216249999u, 0, 0},
+	{"Europe/London", 2216250000u, 60, 1},
+	{"Europe/London", 2209899600u, 0, 0},
+	{"Europe/London", 2234998799u, 60, 1},
+	{"Europe/London", 2234998800u, 0, 0},
+	{"Europe/London", 2225624400u, 60, 1},
+	{"Europe/London", 2248304399u, 0, 0},
+	{"Europe/London", 2248304400u, 60, 1},
+	{"Europe/London", 2241651600u, 0, 0},
+	{"Europe/London", 2266448399u, 60, 1},
+	{"Europe/London", 2266448400u, 0, 0},
+	{"Europe/London", 2257376400u, 60, 1},
+	{"Europe/London", 2279753999u, 0, 0},
+	{"Europe/London", 2279754000u, 60, 1},
+	{"Europe/London", 2273101200u, 0, 0},
+	{"Europe/London", 2297897999u, 60, 1},
+	{"Europe/London", 2297898000u, 0, 0},
+	{"Europe/London", 2288826000u, 60, 1},
+	{"Europe/London", 2311203599u, 0, 0},
+	{"Europe/London", 2311203600u, 60, 1},
+	{"Europe/London", 2304550800u, 0, 0},
+	{"Europe/London", 2329347599u, 60, 1},
+	{"Europe/London", 2329347600u, 0, 0},
+	{"Europe/London", 2320275600u, 60, 1},
+	{"Europe/London", 2342653199u, 0, 0},
+	{"Europe/London", 2342653200u, 60, 1},
+	{"Europe/London", 2336000400u, 0, 0},
+	{"Europe/London", 2361401999u, 60, 1},
+	{"Europe/London", 2361402000u, 0, 0},
+	{"Europe/London", 2352027600u, 60, 1},
+	{"Europe/London", 2374102799u, 0, 0},
+	{"Europe/London", 2374102800u, 60, 1},
+	{"Europe/London", 2367752400u, 0, 0},
+	{"Europe/London", 2392851599u, 60, 1},
+	{"Europe/London", 2392851600u, 0, 0},
+	{"Europe/London", 2383477200u, 60, 1},
+	{"Europe/London", 2405552399u, 0, 0},
+	{"Europe/London", 2405552400u, 60, 1},
+	{"Europe/London", 2399202000u, 0, 0},
+	{"Europe/London", 2424301199u, 60, 1},
+	{"Europe/London", 2424301200u, 0, 0},
+	{"Europe/London", 2414926800u, 60, 1},
+	{"Europe/London", 2437606799u, 0, 0},
+	{"Europe/London", 2437606800u, 60, 1},
+	{"Europe/London", 2430954000u, 0, 0},
+	{"Europe/London", 2455750799u, 60, 1},
+	{"Europe/London", 2455750800u, 0, 0},
+	{"Europe/London", 2446678800u, 60, 1},
+	{"Europe/London", 2469056399u, 0, 0},
+	{"Europe/London", 2469056400u, 60, 1},
+	{"Europe/London", 2462403600u, 0, 0},
+	{"Europe/London", 2487200399u, 60, 1},
+	{"Europe/London", 2487200400u, 0, 0},
+	{"Europe/London", 2478128400u, 60, 1},
+	{"Europe/London", 2500505999u, 0, 0},
+	{"Europe/London", 2500506000u, 60, 1},
+	{"Europe/London", 2493853200u, 0, 0},
+	{"Europe/London", 2519254799u, 60, 1},
+	{"Europe/London", 2519254800u, 0, 0},
+	{"Europe/London", 2509880400u, 60, 1},
+	{"Europe/London", 2531955599u, 0, 0},
+	{"Europe/London", 2531955600u, 60, 1},
+	{"Europe/London", 2525605200u, 0, 0},
+	{"Europe/London", 2550704399u, 60, 1},
+	{"Europe/London", 2550704400u, 0, 0},
+	{"Europe/London", 2541330000u, 60, 1},
+	{"Europe/London", 2563405199u, 0, 0},
+	{"Europe/London", 2563405200u, 60, 1},
+	{"Europe/London", 2557054800u, 0, 0},
+	{"Europe/London", 2582153999u, 60, 1},
+	{"Europe/London", 2582154000u, 0, 0},
+	{"Europe/London", 2572779600u, 60, 1},
+	{"Europe/London", 2595459599u, 0, 0},
+	{"Europe/London", 2595459600u, 60, 1},
+	{"Europe/London", 2588806800u, 0, 0},
+	{"Europe/London", 2613603599u, 60, 1},
+	{"Europe/London", 2613603600u, 0, 0},
+	{"Europe/London", 2604531600u, 60, 1},
+	{"Europe/London", 2626909199u, 0, 0},
+	{"Europe/London", 2626909200u, 60, 1},
+	{"Europe/London", 2620256400u, 0, 0},
+	{"Europe/London", 2645053199u, 60, 1},
+	{"Europe/London", 2645053200u, 0, 0},
+	{"Europe/London", 2635981200u, 60, 1},
+	{"Europe/London", 2658358799u, 0, 0},
+	{"Europe/London", 2658358800u, 60, 1},
+	{"Europe/London", 2651706000u, 0, 0},
+	{"Europe/London", 2676502799u, 60, 1},
+	{"Europe/London", 2676502800u, 0, 0},
+	{"Europe/London", 2667430800u, 60, 1},
+	{"Europe/London", 2689808399u, 0, 0},
+	{"Europe/London", 2689808400u, 60, 1},
+	{"Europe/London", 2683155600u, 0, 0},
+	{"Europe/London", 2708557199u, 60, 1},
+	{"Europe/London", 2708557200u, 0, 0},
+	{"Europe/London", 2699182800u, 60, 1},
+	{"Europe/London", 2721257999u, 0, 0},
+	{"Europe/London", 2721258000u, 60, 1},
+	{"Europe/London", 2714907600u, 0, 0},
+	{"Europe/London", 2740006799u, 60, 1},
+	{"Europe/London", 2740006800u, 0, 0},
+	{"Europe/London", 2730632400u, 60, 1},
+	{"Europe/London", 2752707599u, 0, 0},
+	{"Europe/London", 2752707600u, 60, 1},
+	{"Europe/London", 2746357200u, 0, 0},
+	{"Europe/London", 2771456399u, 60, 1},
+	{"Europe/London", 2771456400u, 0, 0},
+	{"Europe/London", 2762082000u, 60, 1},
+	{"Europe/London", 2784761999u, 0, 0},
+	{"Europe/London", 2784762000u, 60, 1},
+	{"Europe/London", 2778109200u, 0, 0},
+	{"Europe/London", 2802905999u, 60, 1},
+	{"Europe/London", 2802906000u, 0, 0},
+	{"Europe/London", 2793834000u, 60, 1},
+	{"Europe/London", 2816211599u, 0, 0},
+	{"Europe/London", 2816211600u, 60, 1},
+	{"Europe/London", 2809558800u, 0, 0},
+	{"Europe/London", 2834355599u, 60, 1},
+	{"Europe/London", 2834355600u, 0, 0},
+	{"Europe/London", 2825283600u, 60, 1},
+	{"Europe/London", 2847661199u, 0, 0},
+	{"Europe/London", 2847661200u, 60, 1},
+	{"Europe/London", 2841008400u, 0, 0},
+	{"Europe/London", 2866409999u, 60, 1},
+	{"Europe/London", 2866410000u, 0, 0},
+	{"Europe/London", 2857035600u, 60, 1},
+	{"Europe/London", 2879110799u, 0, 0},
+	{"Europe/London", 2879110800u, 60, 1},
+	{"Europe/London", 2872760400u, 0, 0},
+	{"Europe/London", 2897859599u, 60, 1},
+	{"Europe/London", 2897859600u, 0, 0},
+	{"Europe/London", 2888485200u, 60, 1},
+	{"Europe/London", 2910560399u, 0, 0},
+	{"Europe/London", 2910560400u, 60, 1},
+	{"Europe/London", 2904210000u, 0, 0},
+	{"Europe/London", 2929309199u, 60, 1},
+	{"Europe/London", 2929309200u, 0, 0},
+	{"Europe/London", 2919934800u, 60, 1},
+	{"Europe/London", 2942009999u, 0, 0},
+	{"Europe/London", 2942010000u, 60, 1},
+	{"Europe/London", 2935659600u, 0, 0},
+	{"Europe/London", 2960758799u, 60, 1},
+	{"Europe/London", 2960758800u, 0, 0},
+	{"Europe/London", 2951384400u, 60, 1},
+	{"Europe/London", 2974064399u, 0, 0},
+	{"Europe/London", 2974064400u, 60, 1},
+	{"Europe/London", 2967411600u, 0, 0},
+	{"Europe/London", 2992208399u, 60, 1},
+	{"Europe/London", 2992208400u, 0, 0},
+	{"Europe/London", 2983136400u, 60, 1},
+	{"Europe/London", 3005513999u, 0, 0},
+	{"Europe/London", 3005514000u, 60, 1},
+	{"Europe/London", 2998861200u, 0, 0},
+	{"Europe/London", 3023657999u, 60, 1},
+	{"Europe/London", 3023658000u, 0, 0},
+	{"Europe/London", 3014586000u, 60, 1},
+	{"Europe/London", 3036963599u, 0, 0},
+	{"Europe/London", 3036963600u, 60, 1},
+	{"Europe/London", 3030310800u, 0, 0},
+	{"Europe/London", 3055712399u, 60, 1},
+	{"Europe/London", 3055712400u, 0, 0},
+	{"Europe/London", 3046338000u, 60, 1},
+	{"Europe/London", 3068413199u, 0, 0},
+	{"Europe/London", 3068413200u, 60, 1},
+	{"Europe/London", 3062062800u, 0, 0},
+	{"Europe/London", 3087161999u, 60, 1},
+	{"Europe/London", 3087162000u, 0, 0},
+	{"Europe/London", 3077787600u, 60, 1},
+	{"Europe/London", 3099862799u, 0, 0},
+	{"Europe/London", 3099862800u, 60, 1},
+	{"Europe/London", 3093512400u, 0, 0},
+	{"Europe/London", 3118611599u, 60, 1},
+	{"Europe/London", 3118611600u, 0, 0},
+	{"Europe/London", 3109237200u, 60, 1},
+	{"Europe/London", 3131917199u, 0, 0},
+	{"Europe/London", 3131917200u, 60, 1},
+	{"Europe/London", 3125264400u, 0, 0},
+	{"Europe/London", 3150061199u, 60, 1},
+	{"Europe/London", 3150061200u, 0, 0},
+	{"Europe/London", 3140989200u, 60, 1},
+	{"Europe/London", 3163366799u, 0, 0},
+	{"Europe/London", 3163366800u, 60, 1},
+	{"Europe/London", 3156714000u, 0, 0},
+	{"Europe/London", 3181510799u, 60, 1},
+	{"Europe/London", 3181510800u, 0, 0},
+	{"Europe/London", 3172438800u, 60, 1},
+	{"Europe/London", 3194816399u, 0, 0},
+	{"Europe/London", 3194816400u, 60, 1},
+	{"Europe/London", 3188163600u, 0, 0},
+	{"Europe/London", 3212960399u, 60, 1},
+	{"Europe/London", 3212960400u, 0, 0},
+	{"Europe/London", 3203888400u, 60, 1},
+	{"Europe/London", 3226265999u, 0, 0},
+	{"Europe/London", 3226266000u, 60, 1},
+	{"Europe/London", 3219613200u, 0, 0},
+	{"Europe/London", 3245014799u, 60, 1},
+	{"Europe/London", 3245014800u, 0, 0},
+	{"Europe/London", 3235640400u, 60, 1},
+	{"Europe/London", 3257715599u, 0, 0},
+	{"Europe/London", 3257715600u, 60, 1},
+	{"Europe/London", 3251365200u, 0, 0},
+	{"Europe/London", 3276464399u, 60, 1},
+	{"Europe/London", 3276464400u, 0, 0},
+	{"Europe/London", 3267090000u, 60, 1},
+	{"Europe/London", 3289165199u, 0, 0},
+	{"Europe/London", 3289165200u, 60, 1},
+	{"Europe/London", 3282814800u, 0, 0},
+	{"Europe/London", 3307913999u, 60, 1},
+	{"Europe/London", 3307914000u, 0, 0},
+	{"Europe/London", 3298539600u, 60, 1},
+	{"Europe/London", 3321219599u, 0, 0},
+	{"Europe/London", 3321219600u, 60, 1},
+	{"Europe/London", 3314566800u, 0, 0},
+	{"Europe/London", 3339363599u, 60, 1},
+	{"Europe/London", 3339363600u, 0, 0},
+	{"Europe/London", 3330291600u, 60, 1},
+	{"Europe/London", 3352669199u, 0, 0},
+	{"Europe/London", 3352669200u, 60, 1},
+	{"Europe/London", 3346016400u, 0, 0},
+	{"Europe/London", 3370813199u, 60, 1},
+	{"Europe/London", 3370813200u, 0, 0},
+	{"Europe/London", 3361741200u, 60, 1},
+	{"Europe/London", 3384118799u, 0, 0},
+	{"Europe/London", 3384118800u, 60, 1},
+	{"Europe/London", 3377466000u, 0, 0},
+	{"Europe/London", 3402867599u, 60, 1},
+	{"Europe/London", 3402867600u, 0, 0},
+	{"Europe/London", 3393493200u, 60, 1},
+	{"Europe/London", 3415568399u, 0, 0},
+	{"Europe/London", 3415568400u, 60, 1},
+	{"Europe/London", 3409218000u, 0, 0},
+	{"Europe/London", 3434317199u, 60, 1},
+	{"Europe/London", 3434317200u, 0, 0},
+	{"Europe/London", 3424942800u, 60, 1},
+	{"Europe/London", 3447017999u, 0, 0},
+	{"Europe/London", 3447018000u, 60, 1},
+	{"Europe/London", 3440667600u, 0, 0},
+	{"Europe/London", 3465766799u, 60, 1},
+	{"Europe/London", 3465766800u, 0, 0},
+	{"Europe/London", 3456392400u, 60, 1},
+	{"Europe/London", 3479072399u, 0, 0},
+	{"Europe/London", 3479072400u, 60, 1},
+	{"Europe/London", 3472419600u, 0, 0},
+	{"Europe/London", 3497216399u, 60, 1},
+	{"Europe/London", 3497216400u, 0, 0},
+	{"Europe/London", 3488144400u, 60, 1},
+	{"Europe/London", 3510521999u, 0, 0},
+	{"Europe/London", 3510522000u, 60, 1},
+	{"Europe/London", 3503869200u, 0, 0},
+	{"Europe/London", 3528665999u, 60, 1},
+	{"Europe/London", 3528666000u, 0, 0},
+	{"Europe/London", 3519594000u, 60, 1},
+	{"Europe/London", 3541971599u, 0, 0},
+	{"Europe/London", 3541971600u, 60, 1},
+	{"Europe/London", 3535318800u, 0, 0},
+	{"Europe/London", 3560115599u, 60, 1},
+	{"Europe/London", 3560115600u, 0, 0},
+	{"Europe/London", 3551043600u, 60, 1},
+	{"Europe/London", 3573421199u, 0, 0},
+	{"Europe/London", 3573421200u, 60, 1},
+	{"Europe/London", 3566768400u, 0, 0},
+	{"Europe/London", 3592169999u, 60, 1},
+	{"Europe/London", 3592170000u, 0, 0},
+	{"Europe/London", 3582795600u, 60, 1},
+	{"Europe/London", 3604870799u, 0, 0},
+	{"Europe/London", 3604870800u, 60, 1},
+	{"Europe/London", 3598520400u, 0, 0},
+	{"Europe/London", 3623619599u, 60, 1},
+	{"Europe/London", 3623619600u, 0, 0},
+	{"Europe/London", 3614245200u, 60, 1},
+	{"Europe/London", 3636320399u, 0, 0},
+	{"Europe/London", 3636320400u, 60, 1},
+	{"Europe/London", 3629970000u, 0, 0},
+	{"Europe/London", 3655069199u, 60, 1},
+	{"Europe/London", 3655069200u, 0, 0},
+	{"Europe/London", 3645694800u, 60, 1},
+	{"Europe/London", 3668374799u, 0, 0},
+	{"Europe/London", 3668374800u, 60, 1},
+	{"Europe/London", 3661722000u, 0, 0},
+	{"Europe/London", 3686518799u, 60, 1},
+	{"Europe/London", 3686518800u, 0, 0},
+	{"Europe/London", 3677446800u, 60, 1},
+	{"Europe/London", 3699824399u, 0, 0},
+	{"Europe/London", 3699824400u, 60, 1},
+	{"Europe/London", 3693171600u, 0, 0},
+	{"Europe/London", 3717968399u, 60, 1},
+	{"Europe/London", 3717968400u, 0, 0},
+	{"Europe/London", 3708896400u, 60, 1},
+	{"Europe/London", 3731273999u, 0, 0},
+	{"Europe/London", 3731274000u, 60, 1},
+	{"Europe/London", 3724621200u, 0, 0},
+	{"Europe/London", 3750022799u, 60, 1},
+	{"Europe/London", 3750022800u, 0, 0},
+	{"Europe/London", 3740648400u, 60, 1},
+	{"Europe/London", 3762723599u, 0, 0},
+	{"Europe/London", 3762723600u, 60, 1},
+	{"Europe/London", 3756373200u, 0, 0},
+	{"Europe/London", 3781472399u, 60, 1},
+	{"Europe/London", 3781472400u, 0, 0},
+	{"Europe/London", 3772098000u, 60, 1},
+	{"Europe/London", 3794173199u, 0, 0},
+	{"Europe/London", 3794173200u, 60, 1},
+	{"Europe/London", 3787822800u, 0, 0},
+	{"Europe/London", 3812921999u, 60, 1},
+	{"Europe/London", 3812922000u, 0, 0},
+	{"Europe/London", 3803547600u, 60, 1},
+	{"Europe/London", 3825622799u, 0, 0},
+	{"Europe/London", 3825622800u, 60, 1},
+	{"Europe/London", 3819272400u, 0, 0},
+	{"Europe/London", 3844371599u, 60, 1},
+	{"Europe/London", 3844371600u, 0, 0},
+	{"Europe/London", 3834997200u, 60, 1},
+	{"Europe/London", 3857677199u, 0, 0},
+	{"Europe/London", 3857677200u, 60, 1},
+	{"Europe/London", 3851024400u, 0, 0},
+	{"Europe/London", 3875821199u, 60, 1},
+	{"Europe/London", 3875821200u, 0, 0},
+	{"Europe/London", 3866749200u, 60, 1},
+	{"Europe/London", 3889126799u, 0, 0},
+	{"Europe/London", 3889126800u, 60, 1},
+	{"Europe/London", 3882474000u, 0, 0},
+	{"Europe/London", 3907270799u, 60, 1},
+	{"Europe/London", 3907270800u, 0, 0},
+	{"Europe/London", 3898198800u, 60, 1},
+	{"Europe/London", 3920576399u, 0, 0},
+	{"Europe/London", 3920576400u, 60, 1},
+	{"Europe/London", 3913923600u, 0, 0},
+	{"Europe/London", 3939325199u, 60, 1},
+	{"Europe/London", 3939325200u, 0, 0},
+	{"Europe/London", 3929950800u, 60, 1},
+	{"Europe/London", 3952025999u, 0, 0},
+	{"Europe/London", 3952026000u, 60, 1},
+	{"Europe/London", 3945675600u, 0, 0},
+	{"Europe/London", 3970774799u, 60, 1},
+	{"Europe/London", 3970774800u, 0, 0},
+	{"Europe/London", 3961400400u, 60, 1},
+	{"Europe/London", 3983475599u, 0, 0},
+	{"Europe/London", 3983475600u, 60, 1},
+	{"Europe/London", 3977125200u, 0, 0},
+	{"Europe/London", 4002224399u, 60, 1},
+	{"Europe/London", 4002224400u, 0, 0},
+	{"Europe/London", 3992850000u, 60, 1},
+	{"Europe/London", 4015529999u, 0, 0},
+	{"Europe/London", 4015530000u, 60, 1},
+	{"Europe/London", 4008877200u, 0, 0},
+	{"Europe/London", 4033673999u, 60, 1},
+	{"Europe/London", 4033674000u, 0, 0},
+	{"Europe/London", 4024602000u, 60, 1},
+	{"Europe/London", 4046979599u, 0, 0},
+	{"Europe/London", 4046979600u, 60, 1},
+	{"Europe/London", 4040326800u, 0, 0},
+	{"Europe/London", 4065123599u, 60, 1},
+	{"Europe/London", 4065123600u, 0, 0},
+	{"Europe/London", 4056051600u, 60, 1},
+	{"Europe/London", 4078429199u, 0, 0},
+	{"Europe/London", 4078429200u, 60, 1},
+	{"Europe/London", 4071776400u, 0, 0},
+	{"Europe/London", 4096573199u, 60, 1},
+	{"Europe/London", 4096573200u, 0, 0},
+	{"Europe/London", 4087501200u, 60, 1},
+	{"Europe/London", 4109878799u, 0, 0},
+	{"Europe/London", 4109878800u, 60, 1},
+	{"Europe/London", 4103226000u, 0, 0},
+	{"Europe/London", 4128627599u, 60, 1},
+	{"Europe/London", 4128627600u, 0, 0},
+	{"Europe/London", 4119253200u, 60, 1},
+	{"Europe/London", 4141328399u, 0, 0},
+	{"Europe/London", 4141328400u, 60, 1},
+	{"Europe/London", 4134978000u, 0, 0},
+	{"Europe/London", 4160077199u, 60, 1},
+	{"Europe/London", 4160077200u, 0, 0},
+	{"Europe/London", 4150702800u, 60, 1},
+	{"Europe/London", 4172777999u, 0, 0},
+	{"Europe/London", 4172778000u, 60, 1},
+	{"Europe/London", 4166427600u, 0, 0},
+	{"Europe/London", 4191526799u, 60, 1},
+	{"Europe/London", 4191526800u, 0, 0},
+	{"Europe/London", 4182152400u, 60, 1},
+	{"Europe/London", 4204227599u, 0, 0},
+	{"Europe/London", 4204227600u, 60, 1},
+	{"Europe/London", 4197877200u, 0, 0},
+	{"Europe/London", 4222976399u, 60, 1},
+	{"Europe/London", 4222976400u, 0, 0},
+	{"Europe/London", 4213602000u, 60, 1},
+	{"Europe/London", 4236281999u, 0, 0},
+	{"Europe/London", 4236282000u, 60, 1},
+	{"Europe/London", 4229629200u, 0, 0},
+	{"Europe/London", 4254425999u, 60, 1},
+	{"Europe/London", 4254426000u, 0, 0},
+	{"Europe/London", 4245354000u, 60, 1},
+	{"Europe/London", 4267731599u, 0, 0},
+	{"Europe/London", 4267731600u, 60, 1},
+	{"Europe/London", 4261078800u, 0, 0},
+	{"Europe/London", 4285875599u, 60, 1},
+	{"Europe/London", 4285875600u, 0, 0},
+	{"Europe/London", 4276803600u, 60, 1},
+	{"Europe/London", 4294967295u, 0, 0},
+	// Europe/Moscow
+	{"Europe/Moscow", 1262304000u, 180, 0},
+	{"Europe/Moscow", 1269730799u, 180, 0},
+	{"Europe/Moscow", 1269730800u, 240, 1},
+	{"Europe/Moscow", 1266017400u, 180, 0},
+	{"Europe/Moscow", 1288479599u, 240, 1},
+	{"Europe/Moscow", 1288479600u, 180, 0},
+	{"Europe/Moscow", 1279105200u, 240, 1},
+	{"Europe/Moscow", 1301180399u, 180, 0},
+	{"Europe/Moscow", 1301180400u, 240, 0},
+	{"Europe/Moscow", 1294830000u, 180, 0},
+	{"Europe/Moscow", 1414274399u, 240, 0},
+	{"Europe/Moscow", 1414274400u, 180, 0},
+	{"Europe/Moscow", 1357727400u, 240, 0},
+	{"Europe/Moscow", 4294967295u, 180, 0},
+	// Pacific/Auckland
+	{"Pacific/Auckland", 1262304000u, 780, 1},
+	{"Pacific/Auckland", 1270303199u, 780, 1},
+	{"Pacific/Auckland", 1270303200u, 720, 0},
+	{"Pacific/Auckland", 1266303600u, 780, 1},
+	{"Pacific/Auckland", 1285423199u, 720, 0},
+	{"Pacific/Auckland", 1285423200u, 780, 1},
+	{"Pacific/Auckland", 1277863200u, 720, 0},
+	{"Pacific/Auckland", 1301752799u, 780, 1},
+	{"Pacific/Auckland", 1301752800u, 720, 0},
+	{"Pacific/Auckland", 1293588000u, 780, 1},
+	{"Pacific/Auckland", 1316872799u, 720, 0},
+	{"Pacific/Auckland", 1316872800u, 780, 1},
+	{"Pacific/Auckland", 1309312800u, 720, 0},
+	{"Pacific/Auckland", 1333202399u, 780, 1},
+	{"Pacific/Auckland", 1333202400u, 720, 0},
+	{"Pacific/Auckland", 1325037600u, 780, 1},
+	{"Pacific/Auckland", 1348927199u, 720, 0},
+	{"Pacific/Auckland", 1348927200u, 780, 1},
+	{"Pacific/Auckland", 1341064800u, 720, 0},
+	{"Pacific/Auckland", 1365256799u, 780, 1},
+	{"Pacific/Auckland", 1365256800u, 720, 0},
+	{"Pacific/Auckland", 1357092000u, 780, 1},
+	{"Pacific/Auckland", 1380376799u, 720, 0},
+	{"Pacific/Auckland", 1380376800u, 780, 1},
+	{"Pacific/Auckland", 1372816800u, 720, 0},
+	{"Pacific/Auckland", 1396706399u, 780, 1},
+	{"Pacific/Auckland", 1396706400u, 720, 0},
+	{"Pacific/Auckland", 1388541600u, 780, 1},
+	{"Pacific/Auckland", 1411826399u, 720, 0},
+	{"Pacific/Auckland", 1411826400u, 780, 1},
+	{"Pacific/Auckland", 1404266400u, 720, 0},
+	{"Pacific/Auckland", 1428155999u, 780, 1},
+	{"Pacific/Auckland", 1428156000u, 720, 0},
+	{"Pacific/Auckland", 1419991200u, 780, 1},
+	{"Pacific/Auckland", 1443275999u, 720, 0},
+	{"Pacific/Auckland", 1443276000u, 780, 1},
+	{"Pacific/Auckland", 1435716000u, 720, 0},
+	{"Pacific/Auckland", 1459605599u, 780, 1},
+	{"Pacific/Auckland", 1459605600u, 720, 0},
+	{"Pacific/Auckland", 1451440800u, 780, 1},
+	{"Pacific/Auckland", 1474725599u, 720, 0},
+	{"Pacific/Auckland", 1474725600u, 780, 1},
+	{"Pacific/Auckland", 1467165600u, 720, 0},
+	{"Pacific/Auckland", 1491055199u, 780, 1},
+	{"Pacific/Auckland", 1491055200u, 720, 0},
+	{"Pacific/Auckland", 1482890400u, 780, 1},
+	{"Pacific/Auckland", 1506175199u, 720, 0},
+	{"Pacific/Auckland", 1506175200u, 780, 1},
+	{"Pacific/Auckland", 1498615200u, 720, 0},
+	{"Pacific/Auckland", 1522504799u, 780, 1},
+	{"Pacific/Auckland", 1522504800u, 720, 0},
+	{"Pacific/Auckland", 1514340000u, 780, 1},
+	{"Pacific/Auckland", 1538229599u, 720, 0},
+	{"Pacific/Auckland", 1538229600u, 780, 1},
+	{"Pacific/Auckland", 1530367200u, 720, 0},
+	{"Pacific/Auckland", 1554559199u, 780, 1},
+	{"Pacific/Auckland", 1554559200u, 720, 0},
+	{"Pacific/Auckland", 1546394400u, 780, 1},
+	{"Pacific/Auckland", 1569679199u, 720, 0},
+	{"Pacific/Auckland", 1569679200u, 780, 1},
+	{"Pacific/Auckland", 1562119200u, 720, 0},
+	{"Pacific/Auckland", 1586008799u, 780, 1},
+	{"Pacific/Auckland", 1586008800u, 720, 0},
+	{"Pacific/Auckland", 1577844000u, 780, 1},
+	{"Pacific/Auckland", 1601128799u, 720, 0},
+	{"Pacific/Auckland", 1601128800u, 780, 1},
+	{"Pacific/Auckland", 1593568800u, 720, 0},
+	{"Pacific/Auckland", 1617458399u, 780, 1},
+	{"Pacific/Auckland", 1617458400u, 720, 0},
+	{"Pacific/Auckland", 1609293600u, 780, 1},
+	{"Pacific/Auckland", 1632578399u, 720, 0},
+	{"Pacific/Auckland", 1632578400u, 780, 1},
+	{"Pacific/Auckland", 1625018400u, 720, 0},
+	{"Pacific/Auckland", 1648907999u, 780, 1},
+	{"Pacific/Auckland", 1648908000u, 720, 0},
+	{"Pacific/Auckland", 1640743200u, 780, 1},
+	{"Pacific/Auckland", 1664027999u, 720, 0},
+	{"Pacific/Auckland", 1664028000u, 780, 1},
+	{"Pacific/Auckland", 1656468000u, 720, 0},
+	{"Pacific/Auckland", 1680357599u, 780, 1},
+	{"Pacific/Auckland", 1680357600u, 720, 0},
+	{"Pacific/Auckland", 1672192800u, 780, 1},
+	{"Pacific/Auckland", 1695477599u, 720, 0},
+	{"Pacific/Auckland", 1695477600u, 780, 1},
+	{"Pacific/Auckland", 1687917600u, 720, 0},
+	{"Pacific/Auckland", 1712411999u, 780, 1},
+	{"Pacific/Auckland", 1712412000u, 720, 0},
+	{"Pacific/Auckland", 1703944800u, 780, 1},
+	{"Pacific/Auckland", 1727531999u, 720, 0},
+	{"Pacific/Auckland", 1727532000u, 780, 1},
+	{"Pacific/Auckland", 1719972000u, 720, 0},
+	{"Pacific/Auckland", 1743861599u, 780, 1},
+	{"Pacific/Auckland", 1743861600u, 720, 0},
+	{"Pacific/Auckland", 1735696800u, 780, 1},
+	{"Pacific/Auckland", 1758981599u, 720, 0},
+	{"Pacific/Auckland", 1758981600u, 780, 1},
+	{"Pacific/Auckland", 1751421600u, 720, 0},
+	{"Pacific/Auckland", 1775311199u, 780, 1},
+	{"Pacific/Auckland", 1775311200u, 720, 0},
+	{"Pacific/Auckland", 1767146400u, 780, 1},
+	{"Pacific/Auckland", 1790431199u, 720, 0},
+	{"Pacific/Auckland", 1790431200u, 780, 1},
+	{"Pacific/Auckland", 1782871200u, 720, 0},
+	{"Pacific/Auckland", 1806760799u, 780, 1},
+	{"Pacific/Auckland", 1806760800u, 720, 0},
+	{"Pacific/Auckland", 1798596000u, 780, 1},
+	{"Pacific/Auckland", 1821880799u, 720, 0},
+	{"Pacific/Auckland", 1821880800u, 780, 1},
+	{"Pacific/Auckland", 1814320800u, 720, 0},
+	{"Pacific/Auckland", 1838210399u, 780, 1},
+	{"Pacific/Auckland", 1838210400u, 720, 0},
+	{"Pacific/Auckland", 1830045600u, 780, 1},
+	{"Pacific/Auckland", 1853330399u, 720, 0},
+	{"Pacific/Auckland", 1853330400u, 780, 1},
+	{"Pacific/Auckland", 1845770400u, 720, 0},
+	{"Pacific/Auckland", 1869659999u, 780, 1},
+	{"Pacific/Auckland", 1869660000u, 720, 0},
+	{"Pacific/Auckland", 1861495200u, 780, 1},
+	{"Pacific/Auckland", 1885384799u, 720, 0},
+	{"Pacific/Auckland", 1885384800u, 780, 1},
+	{"Pacific/Auckland", 1877522400u, 720, 0},
+	{"Pacific/Auckland", 1901714399u, 780, 1},
+	{"Pacific/Auckland", 1901714400u, 720, 0},
+	{"Pacific/Auckland", 1893549600u, 780, 1},
+	{"Pacific/Auckland", 1916834399u, 720, 0},
+	{"Pacific/Auckland", 1916834400u, 780, 1},
+	{"Pacific/Auckland", 1909274400u, 720, 0},
+	{"Pacific/Auckland", 1933163999u, 780, 1},
+	{"Pacific/Auckland", 1933164000u, 720, 0},
+	{"Pacific/Auckland", 1924999200u, 780, 1},
+	{"Pacific/Auckland", 1948283999u, 720, 0},
+	{"Pacific/Auckland", 1948284000u, 780, 1},
+	{"Pacific/Auckland", 1940724000u, 720, 0},
+	{"Pacific/Auckland", 1964613599u, 780, 1},
+	{"Pacific/Auckland", 1964613600u, 720, 0},
+	{"Pacific/Auckland", 1956448800u, 780, 1},
+	{"Pacific/Auckland", 1979733599u, 720, 0},
+	{"Pacific/Auckland", 1979733600u, 780, 1},
+	{"Pacific/Auckland", 1972173600u, 720, 0},
+	{"Pacific/Auckland", 1996063199u, 780, 1},
+	{"Pacific/Auckland", 1996063200u, 720, 0},
+	{"Pacific/Auckland", 1987898400u, 780, 1},
+	{"Pacific/Auckland", 2011183199u, 720, 0},
+	{"Pacific/Auckland", 2011183200u, 780, 1},
+	{"Pacific/Auckland", 2003623200u, 720, 0},
+	{"Pacific/Auckland", 2027512799u, 780, 1},
+	{"Pacific/Auckland", 2027512800u, 720, 0},
+	{"Pacific/Auckland", 2019348000u, 780, 1},
+	{"Pacific/Auckland", 2042632799u, 720, 0},
+	{"Pacific/Auckland", 2042632800u, 780, 1},
+	{"Pacific/Auckland", 2035072800u, 720, 0},
+	{"Pacific/Auckland", 2058962399u, 780, 1},
+	{"Pacific/Auckland", 2058962400u, 720, 0},
+	{"Pacific/Auckland", 2050797600u, 780, 1},
+	{"Pacific/Auckland", 2074687199u, 720, 0},
+	{"Pacific/Auckland", 2074687200u, 780, 1},
+	{"Pacific/Auckland", 2066824800u, 720, 0},
+	{"Pacific/Auckland", 2091016799u, 780, 1},
+	{"Pacific/Auckland", 2091016800u, 720, 0},
+	{"Pacific/Auckland", 2082852000u, 780, 1},
+	{"Pacific/Auckland", 2106136799u, 720, 0},
+	{"Pacific/Auckland", 2106136800u, 780, 1},
+	{"Pacific/Auckland", 2098576800u, 720, 0},
+	{"Pacific/Auckland", 2122466399u, 780, 1},
+	{"Pacific/Auckland", 2122466400u, 720, 0},
+	{"Pacific/Auckland", 2114301600u, 780, 1},
+	{"Pacific/Auckland", 2137586399u, 720, 0},
+	{"Pacific/Auckland", 2137586400u, 780, 1},
+	{"Pacific/Auckland", 2130026400u, 720, 0},
+	{"Pacific/Auckland", 2153915999u, 780, 1},
+	{"Pacific/Auckland", 2153916000u, 720, 0},
+	{"Pacific/Auckland", 2145751200u, 780, 1},
+	{"Pacific/Auckland", 2169035999u, 720, 0},
+	{"Pacific/Auckland", 2169036000u, 780, 1},
+	{"Pacific/Auckland", 2161476000u, 720, 0},
+	{"Pacific/Auckland", 2185365599u, 780, 1},
+	{"Pacific/Auckland", 2185365600u, 720, 0},
+	{"Pacific/Auckland", 2177200800u, 780, 1},
+	{"Pacific/Auckland", 2200485599u, 720, 0},
+	{"Pacific/Auckland", 2200485600u, 780, 1},
+	{"Pacific/Auckland", 2192925600u, 720, 0},
+	{"Pacific/Auckland", 2216815199u, 780, 1},
+	{"Pacific/Auckland", 2216815200u, 720, 0},
+	{"Pacific/Auckland", 2208650400u, 780, 1},
+	{"Pacific/Auckland", 2232539999u, 720, 0},
+	{"Pacific/Auckland", 2232540000u, 780, 1},
+	{"Pacific/Auckland", 2224677600u, 720, 0},
+	{"Pacific/Auckland", 2248869599u, 780, 1},
+	{"Pacific/Auckland", 2248869600u, 720, 0},
+	{"Pacific/Auckland", 2240704800u, 780, 1},
+	{"Pacific/Auckland", 2263989599u, 720, 0},
+	{"Pacific/Auckland", 2263989600u, 780, 1},
+	{"Pacific/Auckland", 2256429600u, 720, 0},
+	{"Pacific/Auckland", 2280319199u, 780, 1},
+	{"Pacific/Auckland", 2280319200u, 720, 0},
+	{"Pacific/Auckland", 2272154400u, 780, 1},
+	{"Pacific/Auckland", 2295439199u, 720, 0},
+	{"Pacific/Auckland", 2295439200u, 780, 1},
+	{"Pacific/Auckland", 2287879200u, 720, 0},
+	{"Pacific/Auckland", 2311768799u, 780, 1},
+	{"Pacific/Auckland", 2311768800u, 720, 0},
+	{"Pacific/Auckland", 2303604000u, 780, 1},
+	{"Pacific/Auckland", 2326888799u, 720, 0},
+	{"Pacific/Auckland", 2326888800u, 780, 1},
+	{"Pacific/Auckland", 2319328800u, 720, 0},
+	{"Pacific/Auckland", 2343218399u, 780, 1},
+	{"Pacific/Auckland", 2343218400u, 720, 0},
+	{"Pacific/Auckland", 2335053600u, 780, 1},
+	{"Pacific/Auckland", 2358338399u, 720, 0},
+	{"Pacific/Auckland", 2358338400u, 780, 1},
+	{"Pacific/Auckland", 2350778400u, 720, 0},
+	{"Pacific/Auckland", 2374667999u, 780, 1},
+	{"Pacific/Auckland", 2374668000u, 720, 0},
+	{"Pacific/Auckland", 2366503200u, 780, 1},
+	{"Pacific/Auckland", 2389787999u, 720, 0},
+	{"Pacific/Auckland", 2389788000u, 780, 1},
+	{"Pacific/Auckland", 2382228000u, 720, 0},
+	{"Pacific/Auckland", 2406117599u, 780, 1},
+	{"Pacific/Auckland", 2406117600u, 720, 0},
+	{"Pacific/Auckland", 2397952800u, 780, 1},
+	{"Pacific/Auckland", 2421842399u, 720, 0},
+	{"Pacific/Auckland", 2421842400u, 780, 1},
+	{"Pacific/Auckland", 2413980000u, 720, 0},
+	{"Pacific/Auckland", 2438171999u, 780, 1},
+	{"Pacific/Auckland", 2438172000u, 720, 0},
+	{"Pacific/Auckland", 2430007200u, 780, 1},
+	{"Pacific/Auckland", 2453291999u, 720, 0},
+	{"Pacific/Auckland", 2453292000u, 780, 1},
+	{"Pacific/Auckland", 2445732000u, 720, 0},
+	{"Pacific/Auckland", 2469621599u, 780, 1},
+	{"Pacific/Auckland", 2469621600u, 720, 0},
+	{"Pacific/Auckland", 2461456800u, 780, 1},
+	{"Pacific/Auckland", 2484741599u, 720, 0},
+	{"Pacific/Auckland", 2484741600u, 780, 1},
+	{"Pacific/Auckland", 2477181600u, 720, 0},
+	{"Pacific/Auckland", 2501071199u, 780, 1},
+	{"Pacific/Auckland", 2501071200u, 720, 0},
+	{"Pacific/Auckland", 2492906400u, 780, 1},
+	{"Pacific/Auckland", 2516191199u, 720, 0},
+	{"Pacific/Auckland", 2516191200u, 780, 1},
+	{"Pacific/Auckland", 2508631200u, 720, 0},
+	{"Pacific/Auckland", 2532520799u, 780, 1},
+	{"Pacific/Auckland", 2532520800u, 720, 0},
+	{"Pacific/Auckland", 2524356000u, 780, 1},
+	{"Pacific/Auckland", 2547640799u, 720, 0},
+	{"Pacific/Auckland", 2547640800u, 780, 1},
+	{"Pacific/Auckland", 2540080800u, 720, 0},
+	{"Pacific/Auckland", 2563970399u, 780, 1},
+	{"Pacific/Auckland", 2563970400u, 720, 0},
+	{"Pacific/Auckland", 2555805600u, 780, 1},
+	{"Pacific/Auckland", 2579090399u, 720, 0},
+	{"Pacific/Auckland", 2579090400u, 780, 1},
+	{"Pacific/Auckland", 2571530400u, 720, 0},
+	{"Pacific/Auckland", 2596024799u, 780, 1},
+	{"Pacific/Auckland", 2596024800u, 720, 0},
+	{"Pacific/Auckland", 2587557600u, 780, 1},
+	{"Pacific/Auckland", 2611144799u, 720, 0},
+	{"Pacific/Auckland", 2611144800u, 780, 1},
+	{"Pacific/Auckland", 2603584800u, 720, 0},
+	{"Pacific/Auckland", 2627474399u, 780, 1},
+	{"Pacific/Auckland", 2627474400u, 720, 0},
+	{"Pacific/Auckland", 2619309600u, 780, 1},
+	{"Pacific/Auckland", 2642594399u, 720, 0},
+	{"Pacific/Auckland", 2642594400u, 780, 1},
+	{"Pacific/Auckland", 2635034400u, 720, 0},
+	{"Pacific/Auckland", 2658923999u, 780, 1},
+	{"Pacific/Auckland", 2658924000u, 720, 0},
+	{"Pacific/Auckland", 2650759200u, 780, 1},
+	{"Pacific/Auckland", 2674043999u, 720, 0},
+	{"Pacific/Auckland", 2674044000u, 780, 1},
+	{"Pacific/Auckland", 2666484000u, 720, 0},
+	{"Pacific/Auckland", 2690373599u, 780, 1},
+	{"Pacific/Auckland", 2690373600u, 720, 0},
+	{"Pacific/Auckland", 2682208800u, 780, 1},
+	{"Pacific/Auckland", 2705493599u, 720, 0},
+	{"Pacific/Auckland", 2705493600u, 780, 1},
+	{"Pacific/Auckland", 2697933600u, 720, 0},
+	{"Pacific/Auckland", 2721823199u, 780, 1},
+	{"Pacific/Auckland", 2721823200u, 720, 0},
+	{"Pacific/Auckland", 2713658400u, 780, 1},
+	{"Pacific/Auckland", 2736943199u, 720, 0},
+	{"Pacific/Auckland", 2736943200u, 780, 1},
+	{"Pacific/Auckland", 2729383200u, 720, 0},
+	{"Pacific/Auckland", 2753272799u, 780, 1},
+	{"Pacific/Auckland", 2753272800u, 720, 0},
+	{"Pacific/Auckland", 2745108000u, 780, 1},
+	{"Pacific/Auckland", 2768997599u, 720, 0},
+	{"Pacific/Auckland", 2768997600u, 780, 1},
+	{"Pacific/Auckland", 2761135200u, 720, 0},
+	{"Pacific/Auckland", 2785327199u, 780, 1},
+	{"Pacific/Auckland", 2785327200u, 720, 0},
+	{"Pacific/Auckland", 2777162400u, 780, 1},
+	{"Pacific/Auckland", 2800447199u, 720, 0},
+	{"Pacific/Auckland", 2800447200u, 780, 1},
+	{"Pacific/Auckland", 2792887200u, 720, 0},
+	{"Pacific/Auckland", 2816776799u, 780, 1},
+	{"Pacific/Auckland", 2816776800u, 720, 0},
+	{"Pacific/Auckland", 2808612000u, 780, 1},
+	{"Pacific/Auckland", 2831896799u, 720, 0},
+	{"Pacific/Auckland", 2831896800u, 780, 1},
+	{"Pacific/Auckland", 2824336800u, 720, 0},
+	{"Pacific/Auckland", 2848226399u, 780, 1},
+	{"Pacific/Auckland", 2848226400u, 720, 0},
+	{"Pacific/Auckland", 2840061600u, 780, 1},
+	{"Pacific/Auckland", 2863346399u, 720, 0},
+	{"Pacific/Auckland", 2863346400u, 780, 1},
+	{"Pacific/Auckland", 2855786400u, 720, 0},
+	{"Pacific/Auckland", 2879675999u, 780, 1},
+	{"Pacific/Auckland", 2879676000u, 720, 0},
+	{"Pacific/Auckland", 2871511200u, 780, 1},
+	{"Pacific/Auckland", 2894795999u, 720, 0},
+	{"Pacific/Auckland", 2894796000u, 780, 1},
+	{"Pacific/Auckland", 2887236000u, 720, 0},
+	{"Pacific/Auckland", 2911125599u, 780, 1},
+	{"Pacific/Auckland", 2911125600u, 720, 0},
+	{"Pacific/Auckland", 2902960800u, 780, 1},
+	{"Pacific/Auckland", 2926245599u, 720, 0},
+	{"Pacific/Auckland", 2926245600u, 780, 1},
+	{"Pacific/Auckland", 2918685600u, 720, 0},
+	{"Pacific/Auckland", 2942575199u, 780, 1},
+	{"Pacific/Auckland", 2942575200u, 720, 0},
+	{"Pacific/Auckland", 2934410400u, 780, 1},
+	{"Pacific/Auckland", 2958299999u, 720, 0},
+	{"Pacific/Auckland", 2958300000u, 780, 1},
+	{"Pacific/Auckland", 2950437600u, 720, 0},
+	{"Pacific/Auckland", 2974629599u, 780, 1},
+	{"Pacific/Auckland", 2974629600u, 720, 0},
+	{"Pacific/Auckland", 2966464800u, 780, 1},
+	{"Pacific/Auckland", 2989749599u, 720, 0},
+	{"Pacific/Auckland", 2989749600u, 780, 1},
+	{"Pacific/Auckland", 2982189600u, 720, 0},
+	{"Pacific/Auckland", 3006079199u, 780, 1},
+	{"Pacific/Auckland", 3006079200u, 720, 0},
+	{"Pacific/Auckland", 2997914400u, 780, 1},
+	{"Pacific/Auckland", 3021199199u, 720, 0},
+	{"Pacific/Auckland", 3021199200u, 780, 1},
+	{"Pacific/Auckland", 3013639200u, 720, 0},
+	{"Pacific/Auckland", 3037528799u, 780, 1},
+	{"Pacific/Auckland", 3037528800u, 720, 0},
+	{"Pacific/Auckland", 3029364000u, 780, 1},
+	{"Pacific/Auckland", 3052648799u, 720, 0},
+	{"Pacific/Auckland", 3052648800u, 780, 1},
+	{"Pacific/Auckland", 3045088800u, 720, 0},
+	{"Pacific/Auckland", 3068978399u, 780, 1},
+	{"Pacific/Auckland", 3068978400u, 720, 0},
+	{"Pacific/Auckland", 3060813600u, 780, 1},
+	{"Pacific/Auckland", 3084098399u, 720, 0},
+	{"Pacific/Auckland", 3084098400u, 780, 1},
+	{"Pacific/Auckland", 3076538400u, 720, 0},
+	{"Pacific/Auckland", 3100427999u, 780, 1},
+	{"Pacific/Auckland", 3100428000u, 720, 0},
+	{"Pacific/Auckland", 3092263200u, 780, 1},
+	{"Pacific/Auckland", 3116152799u, 720, 0},
+	{"Pacific/Auckland", 3116152800u, 780, 1},
+	{"Pacific/Auckland", 3108290400u, 720, 0},
+	{"Pacific/Auckland", 3132482399u, 780, 1},
+	{"Pacific/Auckland", 3132482400u, 720, 0},
+	{"Pacific/Auckland", 3124317600u, 780, 1},
+	{"Pacific/Auckland", 3147602399u, 720, 0},
+	{"Pacific/Auckland", 3147602400u, 780, 1},
+	{"Pacific/Auckland", 3140042400u, 720, 0},
+	{"Pacific/Auckland", 3163931999u, 780, 1},
+	{"Pacific/Auckland", 3163932000u, 720, 0},
+	{"Pacific/Auckland", 3155767200u, 780, 1},
+	{"Pacific/Auckland", 3179051999u, 720, 0},
+	{"Pacific/Auckland", 3179052000u, 780, 1},
+	{"Pacific/Auckland", 3171492000u, 720, 0},
+	{"Pacific/Auckland", 3195381599u, 780, 1},
+	{"Pacific/Auckland", 3195381600u, 720, 0},
+	{"Pacific/Auckland", 3187216800u, 780, 1},
+	{"Pacific/Auckland", 3210501599u, 720, 0},
+	{"Pacific/Auckland", 3210501600u, 780, 1},
+	{"Pacific/Auckland", 3202941600u, 720, 0},
+	{"Pacific/Auckland", 3226831199u, 780, 1},
+	{"Pacific/Auckland", 3226831200u, 720, 0},
+	{"Pacific/Auckland", 3218666400u, 780, 1},
+	{"Pacific/Auckland", 3241951199u, 720, 0},
+	{"Pacific/Auckland", 3241951200u, 780, 1},
+	{"Pacific/Auckland", 3234391200u, 720, 0},
+	{"Pacific/Auckland", 3258280799u, 780, 1},
+	{"Pacific/Auckland", 3258280800u, 720, 0},
+	{"Pacific/Auckland", 3250116000u, 780, 1},
+	{"Pacific/Auckland", 3273400799u, 720, 0},
+	{"Pacific/Auckland", 3273400800u, 780, 1},
+	{"Pacific/Auckland", 3265840800u, 720, 0},
+	{"Pacific/Auckland", 3289730399u, 780, 1},
+	{"Pacific/Auckland", 3289730400u, 720, 0},
+	{"Pacific/Auckland", 3281565600u, 780, 1},
+	{"Pacific/Auckland", 3305455199u, 720, 0},
+	{"Pacific/Auckland", 3305455200u, 780, 1},
+	{"Pacific/Auckland", 3297592800u, 720, 0},
+	{"Pacific/Auckland", 3321784799u, 780, 1},
+	{"Pacific/Auckland", 3321784800u, 720, 0},
+	{"Pacific/Auckland", 3313620000u, 780, 1},
+	{"Pacific/Auckland", 3336904799u, 720, 0},
+	{"Pacific/Auckland", 3336904800u, 780, 1},
+	{"Pacific/Auckland", 3329344800u, 720, 0},
+	{"Pacific/Auckland", 3353234399u, 780, 1},
+	{"Pacific/Auckland", 3353234400u, 720, 0},
+	{"Pacific/Auckland", 3345069600u, 780, 1},
+	{"Pacific/Auckland", 3368354399u, 720, 0},
+	{"Pacific/Auckland", 3368354400u, 780, 1},
+	{"Pacific/Auckland", 3360794400u, 720, 0},
+	{"Pacific/Auckland", 3384683999u, 780, 1},
+	{"Pacific/Auckland", 3384684000u, 720, 0},
+	{"Pacific/Auckland", 3376519200u, 780, 1},
+	{"Pacific/Auckland", 3399803999u, 720, 0},
+	{"Pacific/Auckland", 3399804000u, 780, 1},
+	{"Pacific/Auckland", 3392244000u, 720, 0},
+	{"Pacific/Auckland", 3416133599u, 780, 1},
+	{"Pacific/Auckland", 3416133600u, 720, 0},
+	{"Pacific/Auckland", 3407968800u, 780, 1},
+	{"Pacific/Auckland", 3431253599u, 720, 0},
+	{"Pacific/Auckland", 3431253600u, 780, 1},
+	{"Pacific/Auckland", 3423693600u, 720, 0},
+	{"Pacific/Auckland", 3447583199u, 780, 1},
+	{"Pacific/Auckland", 3447583200u, 720, 0},
+	{"Pacific/Auckland", 3439418400u, 780, 1},
+	{"Pacific/Auckland", 3462703199u, 720, 0},
+	{"Pacific/Auckland", 3462703200u, 780, 1},
+	{"Pacific/Auckland", 3455143200u, 720, 0},
+	{"Pacific/Auckland", 3479637599u, 780, 1},
+	{"Pacific/Auckland", 3479637600u, 720, 0},
+	{"Pacific/Auckland", 3471170400u, 780, 1},
+	{"Pacific/Auckland", 3494757599u, 720, 0},
+	{"Pacific/Auckland", 3494757600u, 780, 1},
+	{"Pacific/Auckland", 3487197600u, 720, 0},
+	{"Pacific/Auckland", 3511087199u, 780, 1},
+	{"Pacific/Auckland", 3511087200u, 720, 0},
+	{"Pacific/Auckland", 3502922400u, 780, 1},
+	{"Pacific/Auckland", 3526207199u, 720, 0},
+	{"Pacific/Auckland", 3526207200u, 780, 1},
+	{"Pacific/Auckland", 3518647200u, 720, 0},
+	{"Pacific/Auckland", 3542536799u, 780, 1},
+	{"Pacific/Auckland", 3542536800u, 720, 0},
+	{"Pacific/Auckland", 3534372000u, 780, 1},
+	{"Pacific/Auckland", 3557656799u, 720, 0},
+	{"Pacific/Auckland", 3557656800u, 780, 1},
+	{"Pacific/Auckland", 3550096800u, 720, 0},
+	{"Pacific/Auckland", 3573986399u, 780, 1},
+	{"Pacific/Auckland", 3573986400u, 720, 0},
+	{"Pacific/Auckland", 3565821600u, 780, 1},
+	{"Pacific/Auckland", 3589106399u, 720, 0},
+	{"Pacific/Auckland", 3589106400u, 780, 1},
+	{"Pacific/Auckland", 3581546400u, 720, 0},
+	{"Pacific/Auckland", 3605435999u, 780, 1},
+	{"Pacific/Auckland", 3605436000u, 720, 0},
+	{"Pacific/Auckland", 3597271200u, 780, 1},
+	{"Pacific/Auckland", 3620555999u, 720, 0},
+	{"Pacific/Auckland", 3620556000u, 780, 1},
+	{"Pacific/Auckland", 3612996000u, 720, 0},
+	{"Pacific/Auckland", 3636885599u, 780, 1},
+	{"Pacific/Auckland", 3636885600u, 720, 0},
+	{"Pacific/Auckland", 3628720800u, 780, 1},
+	{"Pacific/Auckland", 3652610399u, 720, 0},
+	{"Pacific/Auckland", 3652610400u, 780, 1},
+	{"Pacific/Auckland", 3644748000u, 720, 0},
+	{"Pacific/Auckland", 3668939999u, 780, 1},
+	{"Pacific/Auckland", 3668940000u, 720, 0},
+	{"Pacific/Auckland", 3660775200u, 780, 1},
+	{"Pacific/Auckland", 3684059999u, 720, 0},
+	{"Pacific/Auckland", 3684060000u, 780, 1},
+	{"Pacific/Auckland", 3676500000u, 720, 0},
+	{"Pacific/Auckland", 3700389599u, 780, 1},
+	{"Pacific/Auckland", 3700389600u, 720, 0},
+	{"Pacific/Auckland", 3692224800u, 780, 1},
+	{"Pacific/Auckland", 3715509599u, 720, 0},
+	{"Pacific/Auckland", 3715509600u, 780, 1},
+	{"Pacific/Auckland", 3707949600u, 720, 0},
+	{"Pacific/Auckland", 3731839199u, 780, 1},
+	{"Pacific/Auckland", 3731839200u, 720, 0},
+	{"Pacific/Auckland", 3723674400u, 780, 1},
+	{"Pacific/Auckland", 3746959199u, 720, 0},
+	{"Pacific/Auckland", 3746959200u, 780, 1},
+	{"Pacific/Auckland", 3739399200u, 720, 0},
+	{"Pacific/Auckland", 3763288799u, 780, 1},
+	{"Pacific/Auckland", 3763288800u, 720, 0},
+	{"Pacific/Auckland", 3755124000u, 780, 1},
+	{"Pacific/Auckland", 3778408799u, 720, 0},
+	{"Pacific/Auckland", 3778408800u, 780, 1},
+	{"Pacific/Auckland", 3770848800u, 720, 0},
+	{"Pacific/Auckland", 3794738399u, 780, 1},
+	{"Pacific/Auckland", 3794738400u, 720, 0},
+	{"Pacific/Auckland", 3786573600u, 780, 1},
+	{"Pacific/Auckland", 3809858399u, 720, 0},
+	{"Pacific/Auckland", 3809858400u, 780, 1},
+	{"Pacific/Auckland", 3802298400u, 720, 0},
+	{"Pacific/Auckland", 3826187999u, 780, 1},
+	{"Pacific/Auckland", 3826188000u, 720, 0},
+	{"Pacific/Auckland", 3818023200u, 780, 1},
+	{"Pacific/Auckland", 3841912799u, 720, 0},
+	{"Pacific/Auckland", 3841912800u, 780, 1},
+	{"Pacific/Auckland", 3834050400u, 720, 0},
+	{"Pacific/Auckland", 3858242399u, 780, 1},
+	{"Pacific/Auckland", 3858242400u, 720, 0},
+	{"Pacific/Auckland", 3850077600u, 780, 1},
+	{"Pacific/Auckland", 3873362399u, 720, 0},
+	{"Pacific/Auckland", 3873362400u, 780, 1},
+	{"Pacific/Auckland", 3865802400u, 720, 0},
+	{"Pacific/Auckland", 3889691999u, 780, 1},
+	{"Pacific/Auckland", 3889692000u, 720, 0},
+	{"Pacific/Auckland", 3881527200u, 780, 1},
+	{"Pacific/Auckland", 3904811999u, 720, 0},
+	{"Pacific/Auckland", 3904812000u, 780, 1},
+	{"Pacific/Auckland", 3897252000u, 720, 0},
+	{"Pacific/Auckland", 3921141599u, 780, 1},
+	{"Pacific/Auckland", 3921141600u, 720, 0},
+	{"Pacific/Auckland", 3912976800u, 780, 1},
+	{"Pacific/Auckland", 3936261599u, 720, 0},
+	{"Pacific/Auckland", 3936261600u, 780, 1},
+	{"Pacific/Auckland", 3928701600u, 720, 0},
+	{"Pacific/Auckland", 3952591199u, 780, 1},
+	{"Pacific/Auckland", 3952591200u, 720, 0},
+	{"Pacific/Auckland", 3944426400u, 780, 1},
+	{"Pacific/Auckland", 3967711199u, 720, 0},
+	{"Pacific/Auckland", 3967711200u, 780, 1},
+	{"Pacific/Auckland", 3960151200u, 720, 0},
+	{"Pacific/Auckland", 3984040799u, 780, 1},
+	{"Pacific/Auckland", 3984040800u, 720, 0},
+	{"Pacific/Auckland", 3975876000u, 780, 1},
+	{"Pacific/Auckland", 3999765599u, 720, 0},
+	{"Pacific/Auckland", 3999765600u, 780, 1},
+	{"Pacific/Auckland", 3991903200u, 720, 0},
+	{"Pacific/Auckland", 4016095199u, 780, 1},
+	{"Pacific/Auckland", 4016095200u, 720, 0},
+	{"Pacific/Auckland", 4007930400u, 780, 1},
+	{"Pacific/Auckland", 4031215199u, 720, 0},
+	{"Pacific/Auckland", 4031215200u, 780, 1},
+	{"Pacific/Auckland", 4023655200u, 720, 0},
+	{"Pacific/Auckland", 4047544799u, 780, 1},
+	{"Pacific/Auckland", 4047544800u, 720, 0},
+	{"Pacific/Auckland", 4039380000u, 780, 1},
+	{"Pacific/Auckland", 4062664799u, 720, 0},
+	{"Pacific/Auckland", 4062664800u, 780, 1},
+	{"Pacific/Auckland", 4055104800u, 720, 0},
+	{"Pacific/Auckland", 4078994399u, 780, 1},
+	{"Pacific/Auckland", 4078994400u, 720, 0},
+	{"Pacific/Auckland", 4070829600u, 780, 1},
+	{"Pacific/Auckland", 4094114399u, 720, 0},
+	{"Pacific/Auckland", 4094114400u, 780, 1},
+	{"Pacific/Auckland", 4086554400u, 720, 0},
+	{"Pacific/Auckland", 4110443999u, 780, 1},
+	{"Pacific/Auckland", 4110444000u, 720, 0},
+	{"Pacific/Auckland", 4102279200u, 780, 1},
+	{"Pacific/Auckland", 4125563999u, 720, 0},
+	{"Pacific/Auckland", 4125564000u, 780, 1},
+	{"Pacific/Auckland", 4118004000u, 720, 0},
+	{"Pacific/Auckland", 4141893599u, 780, 1},
+	{"Pacific/Auckland", 4141893600u, 720, 0},
+	{"Pacific/Auckland", 4133728800u, 780, 1},
+	{"Pacific/Auckland", 4157013599u, 720, 0},
+	{"Pacific/Auckland", 4157013600u, 780, 1},
+	{"Pacific/Auckland", 4149453600u, 720, 0},
+	{"Pacific/Auckland", 4173343199u, 780, 1},
+	{"Pacific/Auckland", 4173343200u, 720, 0},
+	{"Pacific/Auckland", 4165178400u, 780, 1},
+	{"Pacific/Auckland", 4188463199u, 720, 0},
+	{"Pacific/Auckland", 4188463200u, 780, 1},
+	{"Pacific/Auckland", 4180903200u, 720, 0},
+	{"Pacific/Auckland", 4204792799u, 780, 1},
+	{"Pacific/Auckland", 4204792800u, 720, 0},
+	{"Pacific/Auckland", 4196628000u, 780, 1},
+	{"Pacific/Auckland", 4220517599u, 720, 0},
+	{"Pacific/Auckland", 4220517600u, 780, 1},
+	{"Pacific/Auckland", 4212655200u, 720, 0},
+	{"Pacific/Auckland", 4236847199u, 780, 1},
+	{"Pacific/Auckland", 4236847200u, 720, 0},
+	{"Pacific/Auckland", 4228682400u, 780, 1},
+	{"Pacific/Auckland", 4251967199u, 720, 0},
+	{"Pacific/Auckland", 4251967200u, 780, 1},
+	{"Pacific/Auckland", 4244407200u, 720, 0},
+	{"Pacific/Auckland", 4268296799u, 780, 1},
+	{"Pacific/Auckland", 4268296800u, 720, 0},
+	{"Pacific/Auckland", 4260132000u, 780, 1},
+	{"Pacific/Auckland", 4283416799u, 720, 0},
+	{"Pacific/Auckland", 4283416800u, 780, 1},
+	{"Pacific/Auckland", 4275856800u, 720, 0},
+	{"Pacific/Auckland", 4294967295u, 780, 1},
+	// UTC
+	{"UTC", 1262304000u, 0, 0},
+	{"UTC", 4294967295u, 0, 0},
+};
@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""Write the reference offsets test_timezone.c checks the tz database with.
+
+The offsets come from Python's zoneinfo and the system tz database, not
+from tzgen.py, so the rule evaluation of the firmware is checked against
+an independent implementation.  The system tzdata must be the version
+tzdb.c was generated from.
+
+Run from the firmware directory:
+
+    python3 host/data/tzref.py
+"""
+
+import calendar
+import datetime
+import os
+import re
+import sys
+import zoneinfo
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+FIRMWARE = os.path.join(HERE, "..", "..")
+
+BEGIN = calendar.timegm((2010, 1, 1, 0, 0, 0))     # tzgen.py --since
+END = 0xFFFFFFFF                                    # end of time_t
+
+
+def state(zone, utc):
+    """Return (offset minutes, dst) of zone at utc."""
+    local = datetime.datetime.fromtimestamp(utc, datetime.timezone.utc).astimezone(zone)
+    return int(local.utcoffset().total_seconds()) // 60, int(bool(local.dst()))
+
+
+def transitions(zone):
+    """Yield the UTC seconds the offset or dst of zone changes at."""
+    utc = BEGIN
+    last = state(zone, utc)
+    while utc < END:
+        step = min(utc + 86400, END)
+        if state(zone, step) != last:
+            low, high = utc, step
+            while high - low > 1:
+                middle = (low + high) // 2
+                if state(zone, middle) == last:
+                    low = middle
+                else:
+                    high = middle
+            yield high
+            last = state(zone, high)
+        utc = step
+
+
+def main():
+    with open(os.path.join(FIRMWARE, "tzdb.h")) as f:
+        version = re.search(r'TZDB_VERSION\s+"(\w+)"', f.read()).group(1)
+    for path in zoneinfo.TZPATH:
+        if os.path.exists(os.path.join(path, "tzdata.zi")):
+            with open(os.path.join(path, "tzdata.zi")) as f:
+                system = f.readline().split()[-1]
+            if system != version:
+                sys.exit("tzdb.c is from tzdata %s, the system has %s" % (version, system))
+            break
+
+    names = []
+    with open(os.path.join(FIRMWARE, "tzdata", "zones.txt")) as f:
+        for line in f:
+            line = line.strip()
+            if line and not line.startswith("#"):
+                names.append(line)
+
+    out = []
+    out.append("// tzref.h - reference offsets of the zones in tzdata/zones.txt,")
+    out.append("// generated by host/data/tzref.py with Python zoneinfo, do not edit")
+    out.append("")
+    out.append('#define TZREF_VERSION\t"%s"' % version)
+    out.append("")
+    out.append("// zone, UTC second, minutes to add to UTC and daylight saving time")
+    out.append("// around every change of the offset and halfway between two changes")
+    out.append("static const tzref_t TzrefTimes[] =")
+    out.append("{")
+    for name in names:
+        zone = zoneinfo.ZoneInfo(name)
+        out.append("\t// %s" % name)
+        out.append('\t{"%s", %du, %d, %d},' % ((name, BEGIN) + state(zone, BEGIN)))
+        previous = BEGIN
+        for utc in transitions(zone):
+            # one second before the change, then halfway to the next one
+            out.append('\t{"%s", %du, %d, %d},' % ((name, utc - 1) + state(zone, utc - 1)))
+            out.append('\t{"%s", %du, %d, %d},' % ((name, utc) + state(zone, utc)))
+            middle = (previous + utc) // 2
+            out.append('\t{"%s", %du, %d, %d},' % ((name, middle) + state(zone, middle)))
+            previous = utc
+        out.append('\t{"%s", %du, %d, %d},' % ((name, END) + state(zone, END)))
+    out.append("};")
+    out.append("")
+
+    with open(os.path.join(HERE, "tzref.h"), "w") as f:
+        f.write("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
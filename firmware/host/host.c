@@ -0,0 +1,127 @@
+//*****************************************************************************
+//
+// File Name	: 'host.c'
+// Title		: Host build of the firmware modules, shared test support
+// Target MCU	: host (gcc)
+// Editor Tabs	: 4
+//
+//*****************************************************************************
+
+#include <string.h>
+#include <avr/io.h>
+#include <avr/eeprom.h>
+
+#include "host.h"
+
+volatile uint8_t hostRegisters[32];
+volatile uint16_t hostRegisters16[8];
+
+uint32_t hostEepromProgrammed;
+uint8_t hostEepromBusyCalls;
+int32_t hostEepromWriteLimit = -1;
+static uint8_t hostEepromBusy;
+
+static uint32_t hostChecks;
+static uint32_t hostFailures;
+
+// EEPROM, the EEMEM variables are in RAM, a write keeps the
+// EEPROM busy for hostEepromBusyCalls calls of eeprom_is_ready()
+
+int eeprom_is_ready(void)
+{
+	if(hostEepromBusy)
+	{
+		hostEepromBusy--;
+		return 0;
+	}
+	return 1;
+}
+
+uint8_t eeprom_read_byte(const uint8_t* p)
+{
+	return *p;
+}
+
+uint16_t eeprom_read_word(const uint16_t* p)
+{
+	uint16_t value;
+
+	memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+uint32_t eeprom_read_dword(const uint32_t* p)
+{
+	uint32_t value;
+
+	memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+void eeprom_read_block(void* dst, const void* src, size_t n)
+{
+	memcpy(dst, src, n);
+}
+
+void eeprom_write_byte(uint8_t* p, uint8_t value)
+{
+	// a power failure stops the programming
+	if(hostEepromWriteLimit == 0)
+		return;
+	if(hostEepromWriteLimit > 0)
+		hostEepromWriteLimit--;
+	*p = value;
+	hostEepromProgrammed++;
+	hostEepromBusy = hostEepromBusyCalls;
+}
+
+void eeprom_update_byte(uint8_t* p, uint8_t value)
+{
+	if(*p != value)
+		eeprom_write_byte(p, value);
+}
+
+void eeprom_update_word(uint16_t* p, uint16_t value)
+{
+	eeprom_update_block(&value, p, sizeof(value));
+}
+
+void eeprom_update_dword(uint32_t* p, uint32_t value)
+{
+	eeprom_update_block(&value, p, sizeof(value));
+}
+
+void eeprom_write_block(const void* src, void* dst, size_t n)
+{
+	size_t i;
+
+	for(i=0; i<n; i++)
+		eeprom_write_byte((uint8_t*)dst + i, ((const uint8_t*)src)[i]);
+}
+
+void eeprom_update_block(const void* src, void* dst, size_t n)
+{
+	size_t i;
+
+	for(i=0; i<n; i++)
+		eeprom_update_byte((uint8_t*)dst + i, ((const uint8_t*)src)[i]);
+}
+
+// checks
+
+uint8_t hostCheck(uint8_t passed, const char* condition, const char* file, int line)
+{
+	hostChecks++;
+	if(!passed)
+	{
+		hostFailures++;
+		printf("%s:%d: check failed: %s\n", file, line, condition);
+	}
+	return passed;
+}
+
+int hostResult(const char* name)
+{
+	printf("%s: %lu checks, %lu failed\n", name, (unsigned long)hostChecks, (unsigned long)hostFailures);
+	return hostFailures ? 1 : 0;
+}
@@ -0,0 +1,74 @@
+//*****************************************************************************
+//
+// File Name	: 'host.h'
+// Title		: Host build of the firmware modules, shared test support
+// Target MCU	: host (gcc)
+// Editor Tabs	: 4
+//
+// The firmware sources are compiled unchanged against the stand-in
+// headers in include/, this file declares what the test programs use to
+// drive them: the fake system time, the emulated EEPROM and the checks.
+//
+//*****************************************************************************
+
+#ifndef HOST_H
+#define HOST_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <avr/io.h>
+
+// system time returned by systemTimeGetMilliseconds() (hostclock.c)
+extern uint32_t hostMillis;
+// timer ticks within hostMillis, systemTimeGetTicks() adds them
+extern uint16_t hostTicks;
+
+// EEPROM emulation (host.c)
+extern uint32_t hostEepromProgrammed;	// bytes that changed
+extern uint8_t hostEepromBusyCalls;		// eeprom_is_ready() calls that report busy after a write
+extern int32_t hostEepromWriteLimit;	// bytes programmed before the power fails, -1 for none
+
+// interrupt handlers of the firmware, defined through ISR()
+void hostUartReceiveInterrupt(void);
+void hostUartTransmitInterrupt(void);
+void hostUartDataInterrupt(void);
+void hostTimer1CaptureInterrupt(void);
+void hostTimer3CompareInterrupt(void);
+
+// feed one byte through the uart receive interrupt
+static inline void hostUartReceive(uint8_t c)
+{
+	UCSR1A = 0;
+	UDR1 = c;
+	hostUartReceiveInterrupt();
+}
+
+// run the uart transmit interrupts until the transmit buffer is empty,
+// returns the number of bytes sent, at most size are stored in data
+static inline uint16_t hostUartTransmit(uint8_t* data, uint16_t size)
+{
+	extern volatile uint8_t uartReadyTx;
+	uint16_t n = 0;
+
+	// the first byte was written to UDR1 when the transmission started
+	while(!uartReadyTx)
+	{
+		if(n < size)
+			data[n] = UDR1;
+		n++;
+		// loads the next byte, or finds the buffer empty and ends
+		hostUartTransmitInterrupt();
+	}
+	return n;
+}
+
+// monotonic host clock for the replay and benchmarks (hostperf.c)
+uint64_t hostNanoseconds(void);
+
+// checks, a failed one is reported and counted
+#define CHECK(condition)	hostCheck((condition) != 0, #condition, __FILE__, __LINE__)
+uint8_t hostCheck(uint8_t passed, const char* condition, const char* file, int line);
+// print the summary, returns the exit code of the test program
+int hostResult(const char* name);
+
+#endif
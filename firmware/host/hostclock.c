@@ -0,0 +1,41 @@
+//*****************************************************************************
+//
+// File Name	: 'hostclock.c'
+// Title		: Fake system time for the host build
+// Target MCU	: host (gcc)
+// Editor Tabs	: 4
+//
+// Replaces systemtime.c, the tests move hostMillis and hostTicks.
+//
+//*****************************************************************************
+
+#include "systemtime.h"
+#include "host.h"
+
+uint32_t hostMillis;
+uint16_t hostTicks;
+
+void systemTimeInit(void)
+{
+	hostMillis = 0;
+	hostTicks = 0;
+}
+
+uint32_t systemTimeGetMilliseconds(void)
+{
+	return hostMillis;
+}
+
+uint32_t systemTimeGetTicks(void)
+{
+	return hostMillis * SYSTEMTIME_TICKS_PER_MS + hostTicks;
+}
+
+uint32_t systemTimeGetMicros(void)
+{
+	return systemTimeGetTicks() * SYSTEMTIME_US_PER_TICK;
+}
+
+void systemTimeAdjustPhase(int16_t ticks)
+{
+}
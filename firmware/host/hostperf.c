@@ -0,0 +1,23 @@
+//*****************************************************************************
+//
+// File Name	: 'hostperf.c'
+// Title		: Host clock for the replay and benchmark programs
+// Target MCU	: host (gcc)
+// Editor Tabs	: 4
+//
+// Kept apart from the firmware headers, their 32 bit time_t replaces the
+// one of the C library.
+//
+//*****************************************************************************
+
+#undef __time_t_defined
+#include <stdint.h>
+#include <time.h>
+
+uint64_t hostNanoseconds(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
@@ -0,0 +1,23 @@
+// Host build stand-in for <avr/eeprom.h>: EEMEM variables live in RAM,
+// host.c implements the accessors and counts what would be programmed.
+#ifndef HOST_AVR_EEPROM_H
+#define HOST_AVR_EEPROM_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define EEMEM
+
+int eeprom_is_ready(void);
+uint8_t eeprom_read_byte(const uint8_t* p);
+uint16_t eeprom_read_word(const uint16_t* p);
+uint32_t eeprom_read_dword(const uint32_t* p);
+void eeprom_read_block(void* dst, const void* src, size_t n);
+void eeprom_write_byte(uint8_t* p, uint8_t value);
+void eeprom_update_byte(uint8_t* p, uint8_t value);
+void eeprom_update_word(uint16_t* p, uint16_t value);
+void eeprom_update_dword(uint32_t* p, uint32_t value);
+void eeprom_write_block(const void* src, void* dst, size_t n);
+void eeprom_update_block(const void* src, void* dst, size_t n);
+
+#endif
@@ -0,0 +1,15 @@
+// Host build stand-in for <avr/interrupt.h>: nothing interrupts the
+// host program, handlers are called by the tests like functions.
+#ifndef HOST_AVR_INTERRUPT_H
+#define HOST_AVR_INTERRUPT_H
+
+#define cli()			do {} while(0)
+#define sei()			do {} while(0)
+
+#define HOST_ISR(vector)	void vector(void)
+#define ISR(vector, ...)	HOST_ISR(vector)
+#define ISR_BLOCK
+#define ISR_NOBLOCK
+#define ISR_NAKED
+
+#endif
@@ -0,0 +1,80 @@
+// Host build stand-in for <avr/io.h>: the I/O registers the firmware
+// touches are plain variables, the tests set and read them directly.
+#ifndef HOST_AVR_IO_H
+#define HOST_AVR_IO_H
+
+#include <stdint.h>
+
+extern volatile uint8_t hostRegisters[];
+extern volatile uint16_t hostRegisters16[];
+
+// 8 bit registers
+#define SREG		hostRegisters[0]
+#define DDRB		hostRegisters[1]
+#define PORTB		hostRegisters[2]
+#define PINB		hostRegisters[3]
+#define DDRC		hostRegisters[4]
+#define PORTC		hostRegisters[5]
+#define PINC		hostRegisters[6]
+#define DDRD		hostRegisters[7]
+#define PORTD		hostRegisters[8]
+#define PIND		hostRegisters[9]
+#define UDR1		hostRegisters[10]
+#define UCSR1A		hostRegisters[11]
+#define UCSR1B		hostRegisters[12]
+#define UCSR1C		hostRegisters[13]
+#define UBRR1L		hostRegisters[14]
+#define UBRR1H		hostRegisters[15]
+#define TCCR1A		hostRegisters[16]
+#define TCCR1B		hostRegisters[17]
+#define TCCR3A		hostRegisters[18]
+#define TCCR3B		hostRegisters[19]
+#define TIMSK1		hostRegisters[20]
+#define TIMSK3		hostRegisters[21]
+#define TIFR1		hostRegisters[22]
+#define TIFR3		hostRegisters[23]
+
+// 16 bit registers
+#define UBRR1		hostRegisters16[0]
+#define TCNT1		hostRegisters16[1]
+#define TCNT3		hostRegisters16[2]
+#define ICR1		hostRegisters16[3]
+#define ICR3		hostRegisters16[4]
+#define OCR3A		hostRegisters16[5]
+
+// register bits
+#define RXCIE1		7
+#define TXCIE1		6
+#define UDRIE1		5
+#define RXEN1		4
+#define TXEN1		3
+#define RXC1		7
+#define TXC1		6
+#define FE1			4
+#define DOR1		3
+#define UPE1		2
+#define U2X1		1
+#define ICNC1		7
+#define ICES1		6
+#define ICIE1		5
+#define ICF1		5
+#define ICNC3		7
+#define ICES3		6
+#define ICIE3		5
+#define ICF3		5
+#define WGM32		3
+#define CS31		1
+#define CS30		0
+#define OCIE3A		1
+#define OCF3A		1
+#define TOV3		0
+
+// interrupt vectors, ISR() turns them into functions the tests call
+#define USART1_RX_vect		hostUartReceiveInterrupt
+#define USART1_TX_vect		hostUartTransmitInterrupt
+#define USART1_UDRE_vect	hostUartDataInterrupt
+#define TIMER1_CAPT_vect	hostTimer1CaptureInterrupt
+#define TIMER3_CAPT_vect	hostTimer3CaptureInterrupt
+#define TIMER3_COMPA_vect	hostTimer3CompareInterrupt
+
+#endif
@@ -0,0 +1,30 @@
+// Host build stand-in for <avr/pgmspace.h>: program memory is ordinary
+// memory, the _P functions are their RAM counterparts.
+#ifndef HOST_AVR_PGMSPACE_H
+#define HOST_AVR_PGMSPACE_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PSTR(s)				(s)
+typedef const char* PGM_P;
+
+// the tables are packed like on the AVR, a word or dword read from them
+// keeps the type of the member and must not assume its alignment
+#define HOST_PGM_READ(p)	({ __typeof__((void)0, *(p)) _v; memcpy(&_v, (p), sizeof(_v)); _v; })
+
+#define pgm_read_byte(p)	(*(const uint8_t*)(p))
+#define pgm_read_word(p)	HOST_PGM_READ(p)
+#define pgm_read_dword(p)	HOST_PGM_READ(p)
+#define pgm_read_ptr(p)		(*(void* const*)(p))
+
+#define memcpy_P			memcpy
+#define memcmp_P			memcmp
+#define strcpy_P			strcpy
+#define strncpy_P			strncpy
+#define strcmp_P			strcmp
+#define strncmp_P			strncmp
+#define strlen_P			strlen
+
+#endif
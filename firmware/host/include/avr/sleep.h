@@ -0,0 +1,8 @@
+// Host build stand-in for <avr/sleep.h>
+#ifndef HOST_AVR_SLEEP_H
+#define HOST_AVR_SLEEP_H
+
+#define set_sleep_mode(mode)	do {} while(0)
+#define sleep_mode()			do {} while(0)
+
+#endif
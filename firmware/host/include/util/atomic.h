@@ -0,0 +1,9 @@
+// Host build stand-in for <util/atomic.h>
+#ifndef HOST_UTIL_ATOMIC_H
+#define HOST_UTIL_ATOMIC_H
+
+#define ATOMIC_BLOCK(type)		for(int hostAtomic = 1; hostAtomic; hostAtomic = 0)
+#define ATOMIC_RESTORESTATE
+#define ATOMIC_FORCEON
+
+#endif
@@ -0,0 +1,8 @@
+// Host build stand-in for <util/delay.h>
+#ifndef HOST_UTIL_DELAY_H
+#define HOST_UTIL_DELAY_H
+
+#define _delay_ms(ms)	do {} while(0)
+#define _delay_us(us)	do {} while(0)
+
+#endif
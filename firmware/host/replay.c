@@ -0,0 +1,126 @@
+//*****************************************************************************
+//
+// File Name	: 'replay.c'
+// Title		: Replays an NMEA log through the uart and the parser
+// Target MCU	: host (gcc)
+// Editor Tabs	: 4
+//
+// The log goes through the real uart receive interrupt at the byte rate
+// of the given baud rate, every epoch starts on the next second like
+// the burst of a receiver.  The main loop calls nmeaProcess() once per
+// pass like gpsProcess() does on the target, the calls are timed with
+// the host clock.  Host times only rank changes to the parser, the
+// gpsprof command measures the target.
+//
+//	replay <log> [baud] [loop ms]
+//
+//*****************************************************************************
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "global.h"
+#include "ring.h"
+#include "uart.h"
+#include "gps.h"
+#include "nmea.h"
+#include "host.h"
+
+GpsInfoType GpsInfo;
+
+// an epoch starts with its RMC sentence
+static uint8_t epochStart(const char* data)
+{
+	return data[0] == '$' && strncmp(data+3, "RMC", 3) == 0;
+}
+
+int main(int argc, char** argv)
+{
+	uint32_t baud = 9600;
+	uint32_t loopMillis = 1;
+	uint32_t packets[256];
+	uint32_t calls = 0;
+	uint32_t credit = 0;
+	uint64_t busy = 0;
+	uint64_t longest = 0;
+	uint64_t start;
+	uint64_t ns;
+	UartStatsType stats;
+	uint8_t packet;
+	char* log;
+	long size;
+	long sent = 0;
+	FILE* f;
+
+	if(argc < 2)
+	{
+		fprintf(stderr, "usage: %s <log> [baud] [loop ms]\n", argv[0]);
+		return 2;
+	}
+	if(argc > 2)
+		baud = strtoul(argv[2], 0, 10);
+	if(argc > 3)
+		loopMillis = strtoul(argv[3], 0, 10);
+	if(!(f = fopen(argv[1], "rb")))
+	{
+		perror(argv[1]);
+		return 2;
+	}
+	fseek(f, 0, SEEK_END);
+	size = ftell(f);
+	rewind(f);
+	log = malloc(size + 1);
+	if(fread(log, 1, size, f) != size)
+		return 2;
+	log[size] = 0;
+	fclose(f);
+
+	uartInit();
+	nmeaInit();
+	memset(packets, 0, sizeof(packets));
+
+	// one millisecond per pass, 10 bits per byte on the line
+	while(sent < size || ringGetDataLength(uartGetRxBuffer()))
+	{
+		hostMillis++;
+		credit += baud;
+		while(credit >= 10000 && sent < size)
+		{
+			// the receiver waits for the next second with a new epoch
+			if(epochStart(log+sent) && sent && hostMillis % 1000)
+				break;
+			credit -= 10000;
+			hostUartReceive(log[sent++]);
+		}
+		if(credit > 10000)
+			credit = 10000;
+
+		if(hostMillis % loopMillis)
+			continue;
+		start = hostNanoseconds();
+		packet = nmeaProcess(uartGetRxBuffer());
+		ns = hostNanoseconds() - start;
+		busy += ns;
+		if(ns > longest)
+			longest = ns;
+		calls++;
+		packets[packet]++;
+	}
+
+	uartGetStats(&stats);
+	printf("replay: %s, %ld bytes at %lu baud, %lu ms loop, %lu s\n", argv[1], size,
+		(unsigned long)baud, (unsigned long)loopMillis, (unsigned long)hostMillis/1000);
+	printf(" packets:      RMC %lu GGA %lu GSA %lu GSV %lu VTG %lu GLL %lu ZDA %lu unknown %lu\n",
+		(unsigned long)packets[NMEA_RMC], (unsigned long)packets[NMEA_GGA], (unsigned long)packets[NMEA_GSA],
+		(unsigned long)packets[NMEA_GSV], (unsigned long)packets[NMEA_VTG], (unsigned long)packets[NMEA_GLL],
+		(unsigned long)packets[NMEA_ZDA], (unsigned long)packets[NMEA_UNKNOWN]);
+	printf(" sentences:    accepted %u, bad checksum %u, truncated %u, overflowed %u, ignored %u\n",
+		GpsInfo.NmeaStats.accepted, GpsInfo.NmeaStats.badChecksum, GpsInfo.NmeaStats.truncated,
+		GpsInfo.NmeaStats.overflowed, GpsInfo.NmeaStats.ignored);
+	printf(" uart:         %lu bytes, %u lost, peak %u of %u\n", (unsigned long)stats.rxBytes,
+		stats.rxOverflow, stats.rxPeak, UART_RX_BUFFER_SIZE);
+	printf(" calls:        %lu, mean %.0f ns, max %.0f ns (host)\n", (unsigned long)calls,
+		calls ? (double)busy / calls : 0.0, (double)longest);
+	free(log);
+	return 0;
+}
@@ -0,0 +1,168 @@
+//*****************************************************************************
+//
+// File Name	: 'test_config.c'
+// Title		: Host tests of the settings record
+// Target MCU	: host (gcc)
+// Editor Tabs	: 4
+//
+// The EEPROM is emulated in RAM by host.c, it stays busy for a few calls
+// after every programmed byte and can lose power after a number of them.
+//
+//*****************************************************************************
+
+#include <string.h>
+
+#include "global.h"
+#include "config.h"
+#include "host.h"
+
+extern configSlot_t EEconfigSlots[CONFIG_SLOTS];
+
+// runs the main loop until the record is written
+static void run(void)
+{
+	uint32_t i;
+
+	for(i=0; i<100000; i++)
+	{
+		hostMillis++;
+		configProcess();
+		if(configGetStatus()->state == CONFIG_IDLE)
+			return;
+	}
+}
+
+static void testDefaults(void)
+{
+	configStatus_t* status = configGetStatus();
+	configData_t* config = configGet();
+
+	// an erased EEPROM gives the defaults
+	hostEepromBusyCalls = 2;
+	memset(EEconfigSlots, 0xFF, sizeof(EEconfigSlots));
+	configInit();
+	CHECK(status->slot == CONFIG_SLOTS && status->badSlots == CONFIG_SLOTS);
+	CHECK(strcmp(config->zone, "Europe/Berlin") == 0);
+	CHECK(config->gpsBaudRate == 9600 && config->syncServiceInterval == 30);
+
+	// written once the changes stopped for CONFIG_WRITE_DELAY_MS
+	strcpy(config->owner, "Alice");
+	configChanged();
+	hostMillis += CONFIG_WRITE_DELAY_MS-1;
+	configProcess();
+	CHECK(status->state == CONFIG_PENDING);
+	run();
+	CHECK(status->slot == 0 && status->sequence == 1 && status->writes == 1);
+	configInit();
+	CHECK(status->slot == 0 && status->badSlots == CONFIG_SLOTS-1);
+	CHECK(strcmp(config->owner, "Alice") == 0);
+}
+
+static void testRotation(void)
+{
+	configStatus_t* status = configGetStatus();
+	configData_t* config = configGet();
+	uint32_t programmed;
+	uint16_t writes;
+	uint8_t i;
+
+	// every write goes to the next slot
+	for(i=0; i<9; i++)
+	{
+		config->displayRotate = i+1;
+		configChanged();
+		run();
+	}
+	CHECK(status->sequence == 10 && status->slot == (10-1) % CONFIG_SLOTS);
+	configInit();
+	CHECK(status->sequence == 10 && status->badSlots == 0 && config->displayRotate == 9);
+
+	// changes in quick succession are written together
+	writes = status->writes;
+	for(i=0; i<5; i++)
+	{
+		config->displayRotate = 20+i;
+		configChanged();
+		hostMillis += 500;
+		configProcess();
+	}
+	run();
+	CHECK(status->writes == writes+1);
+
+	// a change taken back costs no write
+	programmed = hostEepromProgrammed;
+	config->displayRotate = 99;
+	configChanged();
+	config->displayRotate = 24;
+	configChanged();
+	run();
+	CHECK(hostEepromProgrammed == programmed && status->skipped == 1);
+
+	// a change during a write starts it over
+	config->gpsBaudRate = 38400;
+	configChanged();
+	hostMillis += CONFIG_WRITE_DELAY_MS;
+	configProcess();
+	CHECK(status->state == CONFIG_WRITING);
+	config->gpsBaudRate = 115200;
+	configChanged();
+	run();
+	configInit();
+	CHECK(config->gpsBaudRate == 115200);
+}
+
+static void testFailures(void)
+{
+	configStatus_t* status = configGetStatus();
+	configData_t* config = configGet();
+	uint16_t sequence = status->sequence;
+	uint8_t slot;
+
+	// the power fails in the middle of a write, the record before stays
+	strcpy(config->owner, "Bob");
+	configChanged();
+	hostEepromWriteLimit = 3;
+	run();
+	hostEepromWriteLimit = -1;
+	configInit();
+	CHECK(status->sequence == sequence && status->badSlots == 1);
+	CHECK(strcmp(config->owner, "Alice") == 0);
+
+	// a corrupted newest slot falls back to the one before
+	strcpy(config->owner, "Carol");
+	configChanged();
+	run();
+	slot = status->slot;
+	EEconfigSlots[slot].data.owner[1] ^= 0x40;
+	configInit();
+	CHECK(status->slot != slot && strcmp(config->owner, "Alice") == 0);
+}
+
+static void testSequenceWrap(void)
+{
+	configStatus_t* status = configGetStatus();
+	configData_t* config = configGet();
+	uint8_t i;
+
+	// a slot written after the wrap is still the newest
+	memset(EEconfigSlots, 0xFF, sizeof(EEconfigSlots));
+	configInit();
+	status->sequence = 0xFFFD;
+	for(i=0; i<6; i++)
+	{
+		config->displayRotate = 40+i;
+		configChanged();
+		run();
+	}
+	configInit();
+	CHECK(status->sequence == 3 && config->displayRotate == 45);
+}
+
+int main(void)
+{
+	testDefaults();
+	testRotation();
+	testFailures();
+	testSequenceWrap();
+	return hostResult("config");
+}
@@ -0,0 +1,194 @@
+//*****************************************************************************
+//
+// File Name	: 'test_nmea.c'
+// Title		: Host tests of the NMEA parser
+// Target MCU	: host (gcc)
+// Editor Tabs	: 4
+//
+// Sentences go through the real uart receive interrupt into the receive
+// ring, nmeaProcess() parses them in place like on the target.
+//
+//*****************************************************************************
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "global.h"
+#include "ring.h"
+#include "uart.h"
+#include "gps.h"
+#include "nmea.h"
+#include "host.h"
+
+GpsInfoType GpsInfo;
+
+static uint16_t packets[256];
+
+// builds "$<body>*<checksum>\r\n"
+static const char* sentence(const char* body)
+{
+	static char buffer[128];
+	uint8_t checksum = 0;
+	const char* c;
+
+	for(c=body; *c; c++)
+		checksum ^= *c;
+	snprintf(buffer, sizeof(buffer), "$%s*%02X\r\n", body, checksum);
+	return buffer;
+}
+
+// receives one byte per ms, the main loop runs after every chunk
+static void receive(const char* data, uint8_t chunk)
+{
+	uint8_t packet;
+	uint8_t n;
+
+	while(*data)
+	{
+		n = chunk ? 1 + rand() % chunk : 1;
+		while(n-- && *data)
+		{
+			hostMillis++;
+			hostUartReceive(*data++);
+		}
+		while((packet = nmeaProcess(uartGetRxBuffer())))
+			packets[packet]++;
+	}
+}
+
+static void reset(void)
+{
+	uartInit();
+	nmeaInit();
+	memset(&GpsInfo, 0, sizeof(GpsInfo));
+	memset(packets, 0, sizeof(packets));
+}
+
+static void testRmc(void)
+{
+	uint32_t start;
+
+	reset();
+	hostMillis = 1000;
+	start = hostMillis+1;
+	receive(sentence("GPRMC,123519.250,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W"), 0);
+	CHECK(packets[NMEA_RMC] == 1);
+	CHECK(GpsInfo.UtcTime.hour == 12 && GpsInfo.UtcTime.minute == 35 && GpsInfo.UtcTime.second == 19);
+	CHECK(GpsInfo.UtcTime.millis == 250);
+	CHECK(GpsInfo.UtcTime.day == 23 && GpsInfo.UtcTime.month == 3 && GpsInfo.UtcTime.year == 94);
+	// the time belongs to the arrival of the '$', not to the parse
+	CHECK(GpsInfo.validTimeReceivedMillis == start);
+	CHECK(GpsInfo.NmeaStats.accepted == 1);
+
+	// a void fix leaves the last time alone
+	receive(sentence("GPRMC,000000.000,V,,,,,,,010100,,"), 0);
+	CHECK(packets[NMEA_RMC] == 2);
+	CHECK(GpsInfo.UtcTime.hour == 12 && GpsInfo.UtcTime.day == 23);
+	CHECK(GpsInfo.validTimeReceivedMillis == start);
+
+	// a malformed time is rejected as a whole
+	receive(sentence("GNRMC,1260xx,A,4807.038,N,01131.000,E,,,240394,,"), 0);
+	CHECK(GpsInfo.UtcTime.hour == 12 && GpsInfo.UtcTime.day == 23);
+
+	// days past the end of their month are rejected, leap years allowed
+	receive(sentence("GPRMC,101010,A,,,,,,,310424,,"), 0);
+	receive(sentence("GPRMC,101010,A,,,,,,,290223,,"), 0);
+	CHECK(GpsInfo.UtcTime.hour == 12 && GpsInfo.UtcTime.day == 23);
+	receive(sentence("GPRMC,101010,A,,,,,,,290224,,"), 0);
+	CHECK(GpsInfo.UtcTime.hour == 10 && GpsInfo.UtcTime.day == 29 && GpsInfo.UtcTime.month == 2);
+	receive(sentence("GPRMC,111111,A,,,,,,,310124,,"), 0);
+	CHECK(GpsInfo.UtcTime.hour == 11 && GpsInfo.UtcTime.day == 31);
+}
+
+static void testSentences(void)
+{
+	reset();
+	receive(sentence("GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,"), 0);
+	CHECK(packets[NMEA_GGA] == 1 && GpsInfo.numSVs == 8);
+	receive(sentence("GNZDA,201530.00,04,07,2002,00,00"), 0);
+	CHECK(packets[NMEA_ZDA] == 1);
+	CHECK(GpsInfo.UtcTime.hour == 20 && GpsInfo.UtcTime.day == 4 && GpsInfo.UtcTime.month == 7 && GpsInfo.UtcTime.year == 2);
+	// other talkers and sentences are dropped after the header
+	receive(sentence("GPGSV,2,1,08,01,40,083,46,02,17,308,41,12,07,344,39,14,22,228,45"), 0);
+	receive(sentence("PUBX,00"), 0);
+	receive(sentence("XXRMC,123519,A,,,,,,,230394,,"), 0);
+	CHECK(GpsInfo.NmeaStats.ignored == 3);
+	// without fields the header is never matched, the handler
+	// of the previous sentence must not run
+	receive(sentence("GPRMC"), 0);
+	CHECK(GpsInfo.NmeaStats.ignored == 4);
+	CHECK(packets[NMEA_ZDA] == 1 && packets[NMEA_RMC] == 0);
+	CHECK(GpsInfo.NmeaStats.accepted == 2);
+}
+
+static void testErrors(void)
+{
+	reset();
+	receive("$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W*00\r\n", 0);
+	CHECK(GpsInfo.NmeaStats.badChecksum == 1 && packets[NMEA_RMC] == 0);
+	// cut off by the next '$' and without a checksum
+	receive("$GPRMC,123519,A,4807.0", 0);
+	receive("$GPRMC,123519,A\r\n", 0);
+	CHECK(GpsInfo.NmeaStats.truncated == 2);
+	receive(sentence("GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P"), 0);
+	CHECK(GpsInfo.NmeaStats.overflowed == 1);
+	// garbage in front of a good sentence
+	receive("\x01\xFF garbage,*12\r\n", 0);
+	receive(sentence("GPRMC,010203,A,,,,,,,040506,,"), 0);
+	CHECK(packets[NMEA_RMC] == 1 && GpsInfo.UtcTime.hour == 1 && GpsInfo.UtcTime.year == 6);
+	// the receive buffer is empty again, nothing was left behind
+	CHECK(ringGetDataLength(uartGetRxBuffer()) == 0);
+}
+
+static void testStream(void)
+{
+	char log[512];
+	uint16_t i;
+
+	// the same sentences in random chunks, across many ring wraps
+	strcpy(log, sentence("GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,"));
+	strcat(log, sentence("GPGSA,A,3,04,05,,09,12,,,24,,,,,2.5,1.3,2.1"));
+	strcat(log, sentence("GPGSV,2,1,08,01,40,083,46,02,17,308,41,12,07,344,39,14,22,228,45"));
+	strcat(log, sentence("GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W"));
+	strcat(log, sentence("GNZDA,201530.00,04,07,2002,00,00"));
+	reset();
+	srand(1);
+	for(i=0; i<500; i++)
+		receive(log, 40);
+	CHECK(packets[NMEA_GGA] == 500 && packets[NMEA_RMC] == 500 && packets[NMEA_ZDA] == 500);
+	CHECK(GpsInfo.NmeaStats.badChecksum == 0 && GpsInfo.NmeaStats.truncated == 0);
+	CHECK(GpsInfo.NmeaStats.bytes == 500UL*strlen(log));
+	CHECK(uartGetRxOverflow() == 0);
+}
+
+static void testBacklog(void)
+{
+	uint8_t i;
+
+	// more lines than the uart queues line ends for pile up while the
+	// main loop is busy, one call catches up with all of them
+	reset();
+	for(i=0; i<UART_RX_LINES+1; i++)
+	{
+		const char* s = sentence("GPGSA,A");
+		while(*s)
+			hostUartReceive(*s++);
+	}
+	CHECK(nmeaProcess(uartGetRxBuffer()) == NMEA_NODATA);
+	CHECK(ringGetDataLength(uartGetRxBuffer()) == 0);
+	CHECK(GpsInfo.NmeaStats.ignored == UART_RX_LINES+1);
+	// and the queue is in step again for the next line
+	receive(sentence("GNZDA,201530.00,04,07,2002,00,00"), 0);
+	CHECK(packets[NMEA_ZDA] == 1);
+	CHECK(ringGetDataLength(uartGetRxBuffer()) == 0);
+}
+
+int main(void)
+{
+	testRmc();
+	testSentences();
+	testErrors();
+	testStream();
+	testBacklog();
+	return hostResult("nmea");
+}
@@ -0,0 +1,187 @@
+//*****************************************************************************
+//
+// File Name	: 'test_pps.c'
+// Title		: Host tests of the PPS time discipline
+// Target MCU	: host (gcc)
+// Editor Tabs	: 4
+//
+// Timer1, timer3 and the interrupts are simulated tick by tick, the real
+// systemtime.c millisecond interrupt and pps.c capture handler run on
+// them.  The local oscillator is off by a few ppm, the capture interrupt
+// is delayed by a random latency.
+//
+//*****************************************************************************
+
+#include <stdlib.h>
+#include <string.h>
+#include <avr/io.h>
+
+#include "global.h"
+#include "timer32u4.h"
+#include "systemtime.h"
+#include "gps.h"
+#include "pps.h"
+#include "host.h"
+
+GpsInfoType GpsInfo;
+time_t gpsTime;
+extern volatile PpsType Pps;
+
+// timer32u4.c, only what pps.c and systemtime.c use
+void timer1Init(void) {}
+void timer1SetPrescaler(uint8_t prescale) {}
+void timer3Init(void) {}
+void timer3SetMode(uint8_t mode) {}
+void timer3SetOutputModeA(uint8_t mode) {}
+void timer3SetCompareValueA(uint16_t value) { OCR3A = value; }
+void timerAttach(uint8_t interruptNum, void (*userFunc)(void)) {}
+
+// gps.c
+GpsInfoType* gpsGetInfo(void)
+{
+	return &GpsInfo;
+}
+
+time_t gpsGetTimeAt(uint32_t* millis)
+{
+	*millis = GpsInfo.validTimeReceivedMillis;
+	return gpsTime;
+}
+
+// one timer tick, both timers run from the same prescaled clock
+static void tick(void)
+{
+	TCNT1++;
+	if(TCNT3 == OCR3A)
+	{
+		TCNT3 = 0;
+		TIFR3 |= (1<<OCF3A);
+	}
+	else
+		TCNT3++;
+}
+
+// runs the compare interrupt if it is pending
+static void service(void)
+{
+	if(TIFR3 & (1<<OCF3A))
+	{
+		TIFR3 &= ~(1<<OCF3A);
+		hostTimer3CompareInterrupt();
+	}
+}
+
+// simulates seconds of edges, returns the largest distance in ticks
+// between a locked edge and the millisecond tick
+static uint16_t run(double ppm, uint16_t seconds, uint16_t maxLatency)
+{
+	double ticksPerSecond = 250000.0 * (1.0 + ppm*1e-6);
+	double nextEdge = 1234.5;
+	uint32_t ticks = 0;
+	uint32_t end = ticksPerSecond * seconds;
+	uint16_t latency = 0;
+	uint16_t worst = 0;
+	uint16_t error;
+
+	for(ticks=0; ticks<end; ticks++)
+	{
+		tick();
+		if(ticks >= nextEdge)
+		{
+			// distance of the edge to the nearest millisecond tick
+			error = (TCNT3 < 125) ? TCNT3 : OCR3A+1 - TCNT3;
+			if(ppsIsLocked() && error > worst)
+				worst = error;
+			ICR1 = TCNT1;
+			// other interrupts hold the capture off, at least one tick
+			latency = 1 + (maxLatency ? rand() % maxLatency : 0);
+			nextEdge += ticksPerSecond;
+		}
+		if(latency)
+		{
+			// nothing is serviced until the capture ran, it has
+			// the higher priority once interrupts are enabled
+			if(--latency == 0)
+				ppsCapture();
+			else
+				continue;
+		}
+		service();
+	}
+	return worst;
+}
+
+static void reset(void)
+{
+	memset((void*)hostRegisters, 0, 32);
+	memset((void*)hostRegisters16, 0, 16);
+	systemTimeInit();
+	ppsInit();
+	srand(3);
+}
+
+static void testLock(double ppm)
+{
+	uint16_t worst;
+
+	reset();
+	worst = run(ppm, 30, 60);
+	CHECK(Pps.count >= PPS_LOCK_COUNT);
+	// the millisecond tick sits on the edge within a couple of ticks (8 us)
+	CHECK(worst <= 2);
+	CHECK(Pps.phase >= -2 && Pps.phase <= 2);
+	// the oscillator error is corrected in advance, 250 ticks/s per 1000 ppm
+	CHECK(abs(Pps.drift - (int16_t)(ppm/4)) <= 2);
+	CHECK(Pps.edgeMillis - Pps.prevEdgeMillis == 1000);
+	printf("pps: %+.0f ppm, drift %d ticks/s, worst edge %u ticks\n", ppm, Pps.drift, worst);
+}
+
+static void testLatency(void)
+{
+	// capture held off for up to almost a millisecond, the compare
+	// interrupt may be pending and unserviced meanwhile
+	reset();
+	CHECK(run(-35, 20, 240) <= 2);
+	CHECK(Pps.count >= PPS_LOCK_COUNT);
+}
+
+static void testTimeAt(void)
+{
+	uint32_t millis;
+
+	reset();
+	run(20, 10, 10);
+	CHECK(ppsIsLocked());
+
+	// the sentence about the last edge arrives 300 ms after it
+	gpsTime = 1700000000;
+	GpsInfo.UtcTime.millis = 0;
+	GpsInfo.validTimeReceivedMillis = Pps.edgeMillis + 300;
+	CHECK(ppsGetTimeAt(&millis) == gpsTime && millis == Pps.edgeMillis);
+	// the next edge came before the sentence was parsed
+	GpsInfo.validTimeReceivedMillis = Pps.edgeMillis - 700;
+	CHECK(ppsGetTimeAt(&millis) == gpsTime && millis == Pps.prevEdgeMillis);
+	// a sentence about a fraction of a second has no edge
+	GpsInfo.validTimeReceivedMillis = Pps.edgeMillis + 300;
+	GpsInfo.UtcTime.millis = 500;
+	CHECK(ppsGetTimeAt(&millis) == 0);
+
+	// edges stop, the lock is lost after PPS_TIMEOUT_MS
+	GpsInfo.UtcTime.millis = 0;
+	while(systemTimeGetMilliseconds() - Pps.edgeMillis < PPS_TIMEOUT_MS)
+	{
+		tick();
+		service();
+	}
+	CHECK(!ppsIsLocked() && ppsGetTimeAt(&millis) == 0);
+}
+
+int main(void)
+{
+	testLock(60);
+	testLock(-60);
+	testLock(7.3);
+	testLatency();
+	testTimeAt();
+	return hostResult("pps");
+}
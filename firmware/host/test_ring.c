@@ -0,0 +1,185 @@
+//*****************************************************************************
+//
+// File Name	: 'test_ring.c'
+// Title		: Host tests of the byte ring
+// Target MCU	: host (gcc)
+// Editor Tabs	: 4
+//
+// Random producer and consumer steps are compared with a plain queue for
+// every allowed ring size, long enough for head and tail to wrap many
+// times.  The spans are checked against the same queue.
+//
+//*****************************************************************************
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "global.h"
+#include "ring.h"
+#include "host.h"
+
+RING_SIZE_CHECK(128);
+
+// reference queue
+static uint8_t model[1024];
+static uint16_t modelHead;
+static uint16_t modelTail;
+
+static uint16_t modelLength(void)
+{
+	return modelHead - modelTail;
+}
+
+static uint8_t modelAt(uint16_t index)
+{
+	return model[(modelTail + index) % sizeof(model)];
+}
+
+static void testModel(uint8_t size)
+{
+	uint8_t storage[128 + 16];
+	ringBuffer ring;
+	uint32_t errors = 0;
+	uint32_t i;
+	uint8_t data;
+	uint8_t n;
+
+	// guard bytes behind the ring must stay untouched
+	memset(storage, 0xA5, sizeof(storage));
+	ringInit(&ring, storage, size);
+	modelHead = modelTail = 0;
+	for(i=0; i<200000; i++)
+	{
+		switch(rand() % 5)
+		{
+		case 0:
+		case 1:
+			data = rand();
+			if(ringAddToEnd(&ring, data))
+				model[modelHead++ % sizeof(model)] = data;
+			else if(modelLength() != size)
+				errors++;
+			break;
+		case 2:
+			if(modelLength())
+			{
+				if(ringGetFromFront(&ring) != modelAt(0))
+					errors++;
+				modelTail++;
+			}
+			else if(ringGetFromFront(&ring) != 0)
+				errors++;
+			break;
+		case 3:
+			n = rand() % (size+2);
+			ringDumpFromFront(&ring, n);
+			modelTail += (n < modelLength()) ? n : modelLength();
+			break;
+		default:
+			if(modelLength())
+			{
+				n = rand() % modelLength();
+				if(ringGetAtIndex(&ring, n) != modelAt(n))
+					errors++;
+			}
+			break;
+		}
+		if(ringGetDataLength(&ring) != modelLength() || ringIsNotFull(&ring) != size - modelLength())
+			errors++;
+	}
+	for(i=size; i<sizeof(storage); i++)
+		if(storage[i] != 0xA5)
+			errors++;
+	CHECK(errors == 0);
+}
+
+static void testLimits(void)
+{
+	uint8_t storage[128];
+	ringBuffer ring;
+	uint16_t i;
+
+	// a full 128 byte ring, head and tail a whole lap apart
+	ringInit(&ring, storage, sizeof(storage));
+	for(i=0; i<128; i++)
+		if(!ringAddToEnd(&ring, i))
+			break;
+	CHECK(i == 128 && !ringAddToEnd(&ring, 0xFF));
+	CHECK(ringGetDataLength(&ring) == 128 && ringIsNotFull(&ring) == 0);
+	CHECK(ringGetAtIndex(&ring, 127) == 127);
+	for(i=0; i<128; i++)
+		if(ringGetFromFront(&ring) != i)
+			break;
+	CHECK(i == 128 && ringGetDataLength(&ring) == 0 && ringIsNotFull(&ring) == 128);
+
+	// flush drops all, dump never moves past the data
+	ringAddToEnd(&ring, 1);
+	ringAddToEnd(&ring, 2);
+	ringFlush(&ring);
+	CHECK(ringGetDataLength(&ring) == 0);
+	ringAddToEnd(&ring, 3);
+	ringDumpFromFront(&ring, 200);
+	CHECK(ringGetDataLength(&ring) == 0 && ringAddToEnd(&ring, 4) && ringGetFromFront(&ring) == 4);
+}
+
+static void testSpans(void)
+{
+	uint8_t storage[32];
+	uint8_t copy[32];
+	ringBuffer ring;
+	ringSpans spans;
+	uint32_t errors = 0;
+	uint32_t i;
+	uint8_t length;
+	uint8_t n;
+
+	// the spans hold the data in order, the second one starts at the
+	// beginning of the memory and is only used past the wrap
+	ringInit(&ring, storage, sizeof(storage));
+	modelHead = modelTail = 0;
+	for(i=0; i<100000; i++)
+	{
+		for(n=rand() % 20; n && ringAddToEnd(&ring, i+n); n--)
+			model[modelHead++ % sizeof(model)] = i+n;
+		length = ringPeekSpans(&ring, &spans);
+		if(length != modelLength() || spans.length[0] + spans.length[1] != length)
+			errors++;
+		if(spans.length[1] && (spans.data[1] != storage || spans.data[0] + spans.length[0] != storage + sizeof(storage)))
+			errors++;
+		if(spans.length[0] == 0 && spans.length[1])
+			errors++;
+		memcpy(copy, spans.data[0], spans.length[0]);
+		memcpy(copy + spans.length[0], spans.data[1], spans.length[1]);
+		for(n=0; n<length; n++)
+			if(copy[n] != modelAt(n))
+				errors++;
+		// a scan releases part of what it saw
+		n = length ? rand() % (length+1) : 0;
+		ringDumpFromFront(&ring, n);
+		modelTail += n;
+	}
+	CHECK(errors == 0);
+
+	// bytes added after the peek are left for the next one
+	ringFlush(&ring);
+	ringAddToEnd(&ring, 1);
+	length = ringPeekSpans(&ring, &spans);
+	ringAddToEnd(&ring, 2);
+	CHECK(length == 1 && spans.length[0] == 1 && spans.length[1] == 0);
+	ringDumpFromFront(&ring, length);
+	CHECK(ringGetDataLength(&ring) == 1 && ringGetFromFront(&ring) == 2);
+	// an empty ring has two empty spans
+	CHECK(ringPeekSpans(&ring, &spans) == 0 && spans.length[0] == 0 && spans.length[1] == 0);
+}
+
+int main(void)
+{
+	uint8_t size;
+
+	srand(17);
+	for(size=2; size && size<=128; size <<= 1)
+		testModel(size);
+	testLimits();
+	testSpans();
+	return hostResult("ring");
+}
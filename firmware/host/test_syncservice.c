@@ -0,0 +1,283 @@
+//*****************************************************************************
+//
+// File Name	: 'test_syncservice.c'
+// Title		: Host tests of the time source arbitration
+// Target MCU	: host (gcc)
+// Editor Tabs	: 4
+//
+// The pps, gps and rtc sources are registered like in main.c, they answer
+// with the true time plus an error.  The receiver writes the rtc.  The
+// main loop runs every few milliseconds on the fake system time.
+//
+//*****************************************************************************
+
+#include <string.h>
+
+#include "global.h"
+#include "time.h"
+#include "gps.h"
+#include "pps.h"
+#include "rtc.h"
+#include "syncservice.h"
+#include "host.h"
+
+#define SOURCE_PPS		0
+#define SOURCE_GPS		1
+#define SOURCE_RTC		2
+
+#define TRUE_TIME		1700000000UL	// at system millisecond 0
+#define INTERVAL		30				// seconds
+
+extern syncState_t syncState;
+
+static uint8_t ppsOn;
+static uint8_t gpsOn;
+static uint8_t rtcOn;
+static int32_t gpsError;		// seconds
+static int32_t rtcError;
+static uint16_t polls[3];
+static uint16_t rtcWrites;
+
+// true time of the second that holds the system millisecond
+static time_t trueTime(uint32_t millis)
+{
+	return TRUE_TIME + millis/1000;
+}
+
+static time_t ppsAt(uint32_t* millis)
+{
+	polls[SOURCE_PPS]++;
+	if(!ppsOn)
+		return 0;
+	*millis = hostMillis - hostMillis%1000;
+	return trueTime(*millis);
+}
+
+static time_t gpsAt(uint32_t* millis)
+{
+	polls[SOURCE_GPS]++;
+	if(!gpsOn)
+		return 0;
+	// the sentence about the second arrived a while after it began
+	*millis = hostMillis - hostMillis%1000;
+	return trueTime(*millis) + gpsError;
+}
+
+static time_t rtcAt(uint32_t* millis)
+{
+	polls[SOURCE_RTC]++;
+	if(!rtcOn)
+		return 0;
+	*millis = hostMillis;
+	return trueTime(hostMillis) + rtcError;
+}
+
+static void rtcSet(time_t t)
+{
+	rtcWrites++;
+	rtcError = t - trueTime(hostMillis);
+}
+
+// ms the clock is ahead of the true time
+static int32_t clockError(void)
+{
+	uint16_t millis;
+	time_t t = timeNowPrecise(&millis);
+
+	return (int32_t)(t - TRUE_TIME)*1000 + millis - hostMillis;
+}
+
+// the main loop for ms milliseconds
+static void run(uint32_t ms)
+{
+	uint32_t end = hostMillis + ms;
+
+	while((int32_t)(hostMillis - end) < 0)
+	{
+		hostMillis += 7;
+		timeNow();
+		timeSyncServiceProcess();
+	}
+}
+
+static void reset(void)
+{
+	syncSource_t* source;
+	uint8_t i;
+
+	memset(&syncState, 0, sizeof(syncState));
+	timeSyncServiceInit();
+	for(i=0; i<timeSyncServiceGetSources(); i++)
+	{
+		source = timeSyncServiceGetSource(i);
+		source->status = SYNC_SOURCE_NONE;
+		source->reach = 0;
+		source->outlierRuns = 0;
+	}
+	ppsOn = gpsOn = rtcOn = FALSE;
+	gpsError = rtcError = 0;
+	rtcWrites = 0;
+	// up to the next run, the test starts an interval before the one after
+	memset(polls, 0, sizeof(polls));
+	while(polls[SOURCE_RTC] == 0)
+		run(1);
+	memset(polls, 0, sizeof(polls));
+	syncState.uncertaintyMillis = hostMillis;
+}
+
+static void testPolling(void)
+{
+	// unsynced the sources are asked once per interval as well
+	reset();
+	run(INTERVAL*1000UL - 100);
+	CHECK(polls[SOURCE_RTC] == 0 && polls[SOURCE_GPS] == 0);
+	CHECK(timeSyncServiceGetState()->state == SYNC_UNSYNCED);
+	run(200);
+	CHECK(polls[SOURCE_RTC] == 1 && polls[SOURCE_GPS] == 1);
+
+	// the first answer sets the clock
+	gpsOn = TRUE;
+	run(INTERVAL*1000UL);
+	CHECK(polls[SOURCE_RTC] == 2);
+	CHECK(timeSyncServiceGetState()->state == SYNC_LOCKED && timeSyncServiceGetState()->source == SOURCE_GPS);
+	CHECK(clockError() >= 0 && clockError() < 20);
+	CHECK(rtcWrites == 1);
+}
+
+static void testBadRtc(void)
+{
+	uint8_t i;
+
+	// a dead rtc battery, the rtc sets the clock before the receiver
+	// has the time
+	reset();
+	rtcOn = TRUE;
+	rtcError = -3600;
+	run(INTERVAL*1000UL);
+	CHECK(timeSyncServiceGetState()->source == SOURCE_RTC);
+	CHECK(clockError() / 1000 == -3600);
+
+	// the receiver disagrees with the clock and the rtc that set it,
+	// it is believed after SYNCSERVICE_OUTLIER_RUNS intervals
+	gpsOn = TRUE;
+	for(i=1; i<SYNCSERVICE_OUTLIER_RUNS; i++)
+	{
+		run(INTERVAL*1000UL);
+		CHECK(timeSyncServiceGetSource(SOURCE_GPS)->status == SYNC_SOURCE_OUTLIER);
+	}
+	run(INTERVAL*1000UL);
+	CHECK(timeSyncServiceGetState()->source == SOURCE_GPS);
+	CHECK(clockError() >= 0 && clockError() < 20);
+	// the rtc is written again and agrees
+	CHECK(rtcError == 0);
+	run(INTERVAL*1000UL);
+	CHECK(timeSyncServiceGetSource(SOURCE_RTC)->status != SYNC_SOURCE_OUTLIER);
+	CHECK(timeSyncServiceGetSource(SOURCE_GPS)->status == SYNC_SOURCE_SELECTED);
+}
+
+static void testSettime(uint8_t pps)
+{
+	uint8_t i;
+
+	// locked, then settime sets the clock and the rtc an hour wrong
+	reset();
+	ppsOn = pps;
+	gpsOn = TRUE;
+	rtcOn = TRUE;
+	run(2*INTERVAL*1000UL);
+	CHECK(timeSyncServiceGetState()->source == (pps ? SOURCE_PPS : SOURCE_GPS));
+	timeSetTimePrecise(timeNow() + 3600, 0);
+	rtcSet(timeNow());
+
+	for(i=0; i<SYNCSERVICE_OUTLIER_RUNS; i++)
+		run(INTERVAL*1000UL);
+	CHECK(timeSyncServiceGetState()->state == SYNC_LOCKED);
+	CHECK(timeSyncServiceGetState()->source == (pps ? SOURCE_PPS : SOURCE_GPS));
+	CHECK(clockError() >= 0 && clockError() < (pps ? 2 : 20));
+	CHECK(rtcError == 0);
+}
+
+static void testHoldover(void)
+{
+	uint32_t start;
+	int32_t error;
+	uint16_t selected;
+	uint8_t i;
+
+	// the receiver is gone, an rtc two seconds off must not take over
+	// from a clock that is still better
+	reset();
+	gpsOn = TRUE;
+	run(INTERVAL*1000UL);
+	gpsOn = FALSE;
+	rtcOn = TRUE;
+	rtcError = 2;
+	for(i=0; i<3*SYNCSERVICE_OUTLIER_RUNS; i++)
+		run(INTERVAL*1000UL);
+	CHECK(timeSyncServiceGetState()->state == SYNC_HOLDOVER);
+	CHECK(timeSyncServiceGetSource(SOURCE_RTC)->status == SYNC_SOURCE_OUTLIER);
+	CHECK(timeSyncServiceGetSource(SOURCE_RTC)->outlierRuns >= SYNCSERVICE_OUTLIER_RUNS);
+	CHECK(clockError() >= 0 && clockError() < 20);
+
+	// once the clock may be off by more than the rtc, the rtc takes over,
+	// at SYNCSERVICE_DRIFT_PPM that takes about five hours, the rtc
+	// has whole seconds and may be up to one behind the truth
+	start = hostMillis;
+	while(timeSyncServiceGetState()->source != SOURCE_RTC && hostMillis - start < 24*3600000UL)
+		run(INTERVAL*1000UL);
+	CHECK(timeSyncServiceGetState()->state == SYNC_LOCKED && timeSyncServiceGetState()->source == SOURCE_RTC);
+	CHECK(hostMillis - start > 4*3600000UL);
+	CHECK(clockError() > 1000 && clockError() <= 2000);
+
+	// from then on the rtc is selected every interval, agreeing on the
+	// second it must not move the phase of the clock
+	error = clockError();
+	selected = timeSyncServiceGetSource(SOURCE_RTC)->selected;
+	for(i=0; i<5; i++)
+	{
+		run(INTERVAL*1000UL);
+		CHECK(clockError() == error);
+	}
+	CHECK(timeSyncServiceGetState()->state == SYNC_LOCKED && timeSyncServiceGetState()->source == SOURCE_RTC);
+	CHECK(timeSyncServiceGetSource(SOURCE_RTC)->selected > selected);
+}
+
+static void testFinerWins(void)
+{
+	uint8_t i;
+
+	// a wrong rtc votes on neither the receiver nor the pps
+	reset();
+	ppsOn = TRUE;
+	gpsOn = TRUE;
+	rtcOn = TRUE;
+	rtcError = 5;
+	run(INTERVAL*1000UL);
+	CHECK(timeSyncServiceGetState()->source == SOURCE_PPS);
+	CHECK(timeSyncServiceGetSource(SOURCE_GPS)->status == SYNC_SOURCE_CANDIDATE);
+	CHECK(timeSyncServiceGetSource(SOURCE_RTC)->status == SYNC_SOURCE_OUTLIER);
+	CHECK(timeSyncServiceGetSource(SOURCE_RTC)->offset > 4000 && timeSyncServiceGetSource(SOURCE_RTC)->offset <= 5000);
+	// and is written with the time of the pps
+	CHECK(rtcError == 0);
+	for(i=0; i<5; i++)
+		run(INTERVAL*1000UL);
+	CHECK(timeSyncServiceGetState()->source == SOURCE_PPS && clockError() < 2);
+	CHECK(timeSyncServiceGetSource(SOURCE_RTC)->status == SYNC_SOURCE_CANDIDATE);
+}
+
+int main(void)
+{
+	timeSyncServiceSetSyncReceiver(rtcSet);
+	timeSyncServiceAddSource("pps", ppsAt, PPS_DISPERSION_MS);
+	timeSyncServiceAddSource("gps", gpsAt, GPS_DISPERSION_MS);
+	timeSyncServiceAddSource("rtc", rtcAt, RTC_DISPERSION_MS);
+	timeSyncServiceSetInterval(INTERVAL);
+
+	testPolling();
+	testBadRtc();
+	testSettime(TRUE);
+	testSettime(FALSE);
+	testHoldover();
+	testFinerWins();
+	return hostResult("syncservice");
+}
@@ -0,0 +1,218 @@
+//*****************************************************************************
+//
+// File Name	: 'test_time.c'
+// Title		: Host tests of the time and date functions
+// Target MCU	: host (gcc)
+// Editor Tabs	: 4
+//
+// timeBreak() and timeMake() are compared with an independent 64 bit
+// civil calendar conversion over the whole time_t range, the element
+// cache and the day and zone steps with timeBreak().
+//
+//*****************************************************************************
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "global.h"
+#include "time.h"
+#include "host.h"
+
+// reference conversion, days since 1970 from the proleptic Gregorian date
+static int64_t referenceDays(int64_t year, int64_t month, int64_t day)
+{
+	int64_t era;
+	int64_t yoe;
+	int64_t doy;
+
+	year -= month <= 2;
+	era = (year >= 0 ? year : year-399) / 400;
+	yoe = year - era * 400;
+	doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+	return era * 146097 + yoe * 365 + yoe/4 - yoe/100 + doy - 719468;
+}
+
+static void referenceBreak(int64_t t, tmElements_t* el)
+{
+	int64_t days = t / 86400;
+	int64_t z = days + 719468;
+	int64_t era = z / 146097;
+	int64_t doe = z - era * 146097;
+	int64_t yoe = (doe - doe/1460 + doe/36524 - doe/146096) / 365;
+	int64_t doy = doe - (365*yoe + yoe/4 - yoe/100);
+	int64_t mp = (5*doy + 2) / 153;
+	int64_t month = mp < 10 ? mp+3 : mp-9;
+	int64_t year = yoe + era * 400 + (month <= 2);
+
+	el->Second = t % 60;
+	el->Minute = (t / 60) % 60;
+	el->Hour = (t / 3600) % 24;
+	el->Wday = ((days + 4) % 7) + 1;
+	el->Day = doy - (153*mp + 2)/5 + 1;
+	el->Month = month;
+	el->Year = year - 1970;
+}
+
+static uint8_t sameElements(tmElements_t* a, tmElements_t* b)
+{
+	return memcmp(a, b, sizeof(tmElements_t)) == 0;
+}
+
+static void testConversion(void)
+{
+	tmElements_t el;
+	tmElements_t ref;
+	uint32_t day;
+	uint32_t errors = 0;
+	static const int32_t seconds[] = {-2, -1, 0, 1, 2, 43199, 43200};
+	uint8_t i;
+	int64_t t;
+	uint8_t year;
+	uint8_t month;
+
+	// every day of the time_t range, around midnight and at noon
+	for(day=0; day<=0xFFFFFFFFUL/86400; day++)
+	{
+		for(i=0; i<sizeof(seconds)/sizeof(seconds[0]); i++)
+		{
+			t = (int64_t)day*86400 + seconds[i];
+			if(t < 0 || t > 0xFFFFFFFFLL)
+				continue;
+			timeBreak((time_t)t, &el);
+			referenceBreak(t, &ref);
+			if(!sameElements(&el, &ref) || timeMake(el) != (time_t)t)
+				errors++;
+		}
+	}
+	CHECK(errors == 0);
+
+	// the ends of the range and the leap years around the centuries
+	timeBreak(0, &el);
+	CHECK(el.Year == 0 && el.Month == 1 && el.Day == 1 && el.Wday == dowThursday);
+	timeBreak(0xFFFFFFFFUL, &el);
+	CHECK(tmYearToCalendar(el.Year) == 2106 && el.Month == 2 && el.Day == 7 && el.Hour == 6);
+	el.Year = CalendarYrToTm(2000); el.Month = 2; el.Day = 29; el.Hour = 0; el.Minute = 0; el.Second = 0;
+	CHECK(timeMake(el) == 951782400UL);
+	el.Year = CalendarYrToTm(2100); el.Month = 3; el.Day = 1;
+	CHECK(timeMake(el) == (time_t)(referenceDays(2100, 3, 1) * 86400));
+
+	// month lengths
+	errors = 0;
+	for(year=0; year<137; year++)
+		for(month=1; month<=12; month++)
+			if(timeMonthLength(month, year) != referenceDays(1970+year+(month == 12), month%12+1, 1) - referenceDays(1970+year, month, 1))
+				errors++;
+	CHECK(errors == 0);
+
+	// the getters break the time up the same way
+	t = 1709251199;	// 2024-02-29 23:59:59
+	CHECK(timeGetYear(t) == 2024 && timeGetMonth(t) == 2 && timeGetDay(t) == 29);
+	CHECK(timeGetHour(t) == 23 && timeGetMinute(t) == 59 && timeGetSecond(t) == 59);
+	CHECK(timeGetWeekday(t) == dowThursday && timeGetHourFormat12(t) == 11 && timeIsPM(t));
+}
+
+static void testCache(void)
+{
+	tmElements_t el;
+	tmElements_t ref;
+	uint32_t errors = 0;
+	uint32_t i;
+	time_t t = 0;
+
+	// the clock in steps of up to two minutes, every few thousand calls
+	// it is set backwards or far ahead
+	srand(5);
+	for(i=0; i<2000000; i++)
+	{
+		if(i % 4096 == 0)
+			t = ((uint32_t)rand() << 16) ^ rand();
+		else
+			t += rand() % ((i & 1) ? 2 : 121);
+		timeGetElements(t, &el);
+		timeBreak(t, &ref);
+		if(!sameElements(&el, &ref))
+			errors++;
+	}
+	CHECK(errors == 0);
+
+	// the second steps over the new year and the end of the range
+	timeGetElements(1704067199, &el);	// 2023-12-31 23:59:59
+	timeGetElements(1704067200, &el);
+	CHECK(el.Year == CalendarYrToTm(2024) && el.Month == 1 && el.Day == 1 && el.Hour == 0 && el.Wday == dowMonday);
+	timeGetElements(0xFFFFFFFFUL - 30, &el);
+	timeGetElements(0xFFFFFFFFUL, &el);
+	timeBreak(0xFFFFFFFFUL, &ref);
+	CHECK(sameElements(&el, &ref));
+}
+
+static void testDaySteps(void)
+{
+	tmElements_t el;
+	tmElements_t ref;
+	uint32_t errors = 0;
+	uint32_t day;
+	uint32_t days = 0xFFFFFFFFUL / SECS_PER_DAY;
+
+	// every day of the range forwards and backwards
+	timeBreak(0, &el);
+	for(day=1; day<=days; day++)
+	{
+		timeNextDay(&el);
+		timeBreak(day * SECS_PER_DAY, &ref);
+		if(!sameElements(&el, &ref))
+			errors++;
+	}
+	for(day=days; day>0; day--)
+	{
+		timePreviousDay(&el);
+		timeBreak((day-1) * SECS_PER_DAY, &ref);
+		if(!sameElements(&el, &ref))
+			errors++;
+	}
+	CHECK(errors == 0);
+}
+
+static void testShift(void)
+{
+	tmElements_t el;
+	tmElements_t ref;
+	uint32_t errors = 0;
+	uint32_t i;
+	int16_t minutes;
+	time_t t;
+
+	// zone offsets of up to a day either way, at random times
+	srand(7);
+	for(i=0; i<1000000; i++)
+	{
+		t = SECS_PER_DAY + ((((uint32_t)rand() << 16) ^ rand()) % (0xFFFFFFFFUL - 2*SECS_PER_DAY));
+		minutes = rand() % (2*MINS_PER_DAY - 1) - (MINS_PER_DAY - 1);
+		timeBreak(t, &el);
+		timeShift(&el, minutes);
+		timeBreak(t + (int32_t)minutes * 60, &ref);
+		if(!sameElements(&el, &ref))
+			errors++;
+	}
+	CHECK(errors == 0);
+
+	// across the leap day and the new year
+	timeBreak(1709164800, &el);	// 2024-02-29 00:00:00
+	timeShift(&el, -1);
+	CHECK(el.Month == 2 && el.Day == 28 && el.Hour == 23 && el.Minute == 59);
+	timeShift(&el, 1439);
+	CHECK(el.Month == 2 && el.Day == 29 && el.Hour == 23 && el.Minute == 58);
+	timeShift(&el, 2);
+	CHECK(el.Month == 3 && el.Day == 1 && el.Hour == 0 && el.Minute == 0 && el.Wday == dowFriday);
+	timeBreak(1704067200, &el);	// 2024-01-01 00:00:00
+	timeShift(&el, -300);
+	CHECK(tmYearToCalendar(el.Year) == 2023 && el.Month == 12 && el.Day == 31 && el.Hour == 19);
+}
+
+int main(void)
+{
+	testConversion();
+	testCache();
+	testDaySteps();
+	testShift();
+	return hostResult("time");
+}
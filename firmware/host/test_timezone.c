@@ -0,0 +1,237 @@
+//*****************************************************************************
+//
+// File Name	: 'test_timezone.c'
+// Title		: Host tests of the timezone offsets
+// Target MCU	: host (gcc)
+// Editor Tabs	: 4
+//
+// The cached offsets are compared with a fresh evaluation of the zone for
+// every lookup, over all zones of the compiled tz database.  The offsets
+// of the database are checked against the reference times data/tzref.py
+// took from Python's zoneinfo.  The zone list keeps a cache per zone.
+//
+//*****************************************************************************
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "global.h"
+#include "time.h"
+#include "config.h"
+#include "timezone.h"
+#include "tzdb.h"
+#include "host.h"
+
+typedef struct
+{
+	const char* zone;
+	time_t utc;
+	int16_t offset;
+	uint8_t dst;
+} tzref_t;
+
+#include "data/tzref.h"
+
+extern timezoneZone_t timezoneRules;
+extern timezoneCache_t timezoneCache;
+
+static configData_t config;
+static uint16_t changes;
+
+// config.c
+configData_t* configGet(void)
+{
+	return &config;
+}
+
+void configChanged(void)
+{
+	changes++;
+}
+
+// a random time in the range the zones cover
+static time_t randomTime(void)
+{
+	return ((((uint32_t)rand() << 16) ^ rand()) % 0xF0000000UL) + 0x08000000UL;
+}
+
+// offset of the selected zone without the cache
+static int32_t uncachedOffset(time_t utc)
+{
+	timezoneCache_t cache;
+
+	timezoneZoneToCache(&timezoneRules, &cache, utc);
+	return cache.offset;
+}
+
+// the interval holds utc, starts where the one before ended and the
+// offset of its last second matches
+static uint8_t intervalIsConsistent(const timezoneZone_t* zone, timezoneCache_t* cache, time_t utc)
+{
+	timezoneCache_t other;
+
+	if(cache->length == 0 || utc - cache->start >= cache->length)
+		return FALSE;
+	timezoneZoneToCache(zone, &other, cache->start + cache->length - 1);
+	if(other.offset != cache->offset || other.start != cache->start)
+		return FALSE;
+	if(cache->start)
+	{
+		timezoneZoneToCache(zone, &other, cache->start - 1);
+		if(other.start + other.length != cache->start)
+			return FALSE;
+	}
+	return TRUE;
+}
+
+static void testCache(void)
+{
+	uint32_t errors = 0;
+	uint32_t i;
+	uint8_t zone;
+	time_t utc = 0;
+
+	srand(11);
+	for(zone=0; zone<TZDB_ZONES; zone++)
+	{
+		timezoneLoadZone(zone);
+		for(i=0; i<100000; i++)
+		{
+			// minutes to days on, with a jump now and then
+			if(i % 1000 == 0)
+				utc = randomTime();
+			else
+				utc += rand() % ((i & 1) ? 120 : 3*SECS_PER_DAY);
+			if(timezoneTimeToLocal(utc) != utc + uncachedOffset(utc))
+				errors++;
+			if(timezoneUtcIsDst(utc) != timezoneCache.dst)
+				errors++;
+			if(!intervalIsConsistent(&timezoneRules, &timezoneCache, utc))
+				errors++;
+		}
+	}
+	CHECK(errors == 0);
+
+	// a new zone drops the cache at once
+	timezoneLoadZone(timezoneFindZone("Asia/Tokyo"));
+	CHECK(timezoneTimeToLocal(1700000000) == 1700000000 + 9*SECS_PER_HOUR);
+	timezoneLoadZone(timezoneFindZone("America/New_York"));
+	CHECK(timezoneTimeToLocal(1700000000) == 1700000000 - 5*SECS_PER_HOUR);
+}
+
+static void testDatabase(void)
+{
+	const tzref_t* ref;
+	uint32_t errors = 0;
+	uint8_t zone;
+	uint8_t zones = 0;
+	const char* last = "";
+
+	CHECK(strcmp(TZREF_VERSION, TZDB_VERSION) == 0);
+	for(ref=TzrefTimes; ref<TzrefTimes+sizeof(TzrefTimes)/sizeof(TzrefTimes[0]); ref++)
+	{
+		if(strcmp(ref->zone, last))
+		{
+			zone = timezoneFindZone(ref->zone);
+			CHECK(zone != TIMEZONE_CUSTOM);
+			timezoneLoadZone(zone);
+			last = ref->zone;
+			zones++;
+		}
+		if(timezoneTimeToLocal(ref->utc) != ref->utc + ref->offset*(int32_t)SECS_PER_MIN)
+		{
+			printf("timezone: %s at %lu is %+ld min, not %+d\n", ref->zone, (unsigned long)ref->utc,
+				(long)(timezoneTimeToLocal(ref->utc) - ref->utc) / 60, ref->offset);
+			errors++;
+		}
+		if(timezoneUtcIsDst(ref->utc) != ref->dst)
+			errors++;
+	}
+	CHECK(errors == 0);
+	CHECK(zones == TZDB_ZONES);
+}
+
+static void testCustom(void)
+{
+	timeChangeRule_t dst = {"CEST", 120, 2, Sun, Last, Mar};
+	timeChangeRule_t std = {"CET", 60, 3, Sun, Last, Oct};
+
+	// own rules apply all the time and forget the zone
+	changes = 0;
+	strcpy(config.zone, "Europe/Berlin");
+	timezoneSetDst(dst);
+	timezoneSetStd(std);
+	CHECK(timezoneGetZone() == TIMEZONE_CUSTOM && config.zone[0] == 0 && changes == 2);
+	// 2024-03-31 01:00 UTC the clocks go forward, 2024-10-27 01:00 UTC back
+	CHECK(timezoneTimeToLocal(1711846799) == 1711846799 + 1*SECS_PER_HOUR);
+	CHECK(timezoneTimeToLocal(1711846800) == 1711846800 + 2*SECS_PER_HOUR);
+	CHECK(timezoneTimeToLocal(1729990799) == 1729990799 + 2*SECS_PER_HOUR);
+	CHECK(timezoneTimeToLocal(1729990800) == 1729990800 + 1*SECS_PER_HOUR);
+	CHECK(timezoneTimeToLocal(0) == 1*SECS_PER_HOUR);
+	CHECK(timezoneTimeToUTC(1711846800 + 2*SECS_PER_HOUR) == 1711846800);
+}
+
+static void testList(void)
+{
+	uint32_t errors = 0;
+	uint32_t i;
+	uint8_t position;
+	time_t utc;
+
+	memset(&config, 0, sizeof(config));
+	timezoneSetZone("Europe/Berlin");
+	timezoneListClear();
+	CHECK(timezoneListGetLength() == 1 && timezoneListGetZone(0) == timezoneFindZone("Europe/Berlin"));
+
+	// unknown names and more zones than fit are refused
+	changes = 0;
+	CHECK(timezoneListAdd("America/New_York"));
+	CHECK(!timezoneListAdd("Mars/Olympus_Mons"));
+	CHECK(timezoneListAdd("Asia/Kolkata"));
+	CHECK(timezoneListAdd("Pacific/Auckland"));
+	CHECK(!timezoneListAdd("UTC"));
+	CHECK(timezoneListGetLength() == TIMEZONE_LIST_LENGTH && changes == 3);
+	CHECK(strcmp(config.list[1], "Asia/Kolkata") == 0);
+
+	// every position keeps its own cache, all agree with loading the zone
+	srand(13);
+	utc = randomTime();
+	for(i=0; i<20000; i++)
+	{
+		utc += rand() % (2*SECS_PER_DAY);
+		for(position=TIMEZONE_LIST_LENGTH; position--; )
+		{
+			int16_t offset = timezoneListGetOffset(position, utc);
+			uint8_t zone = timezoneListGetZone(position);
+			timezoneZone_t rules;
+			timezoneCache_t cache;
+
+			memcpy(&rules, &TzdbZones[zone], sizeof(rules));
+			timezoneZoneToCache(&rules, &cache, utc);
+			if(offset*(int32_t)SECS_PER_MIN != cache.offset)
+				errors++;
+		}
+	}
+	CHECK(errors == 0);
+	CHECK(timezoneListGetOffset(2, 1700000000) == 330);
+
+	// loaded again from the configuration, names the table lost are skipped
+	strcpy(config.list[0], "Europe/Atlantis");
+	timezoneInit();
+	CHECK(timezoneListGetLength() == TIMEZONE_LIST_LENGTH-1);
+	CHECK(timezoneListGetZone(0) == timezoneFindZone("Europe/Berlin"));
+	CHECK(timezoneListGetZone(1) == timezoneFindZone("Asia/Kolkata"));
+	CHECK(timezoneListGetZone(2) == timezoneFindZone("Pacific/Auckland"));
+
+	timezoneListClear();
+	CHECK(timezoneListGetLength() == 1 && config.list[2][0] == 0);
+}
+
+int main(void)
+{
+	testCache();
+	testDatabase();
+	testCustom();
+	testList();
+	return hostResult("timezone");
+}
@@ -0,0 +1,276 @@
+//*****************************************************************************
+//
+// File Name	: 'test_ubx.c'
+// Title		: Host tests of the UBX protocol driver
+// Target MCU	: host (gcc)
+// Editor Tabs	: 4
+//
+// Messages go through the real uart receive interrupt, the configuration
+// the driver sends is taken from the uart transmit interrupt.
+//
+//*****************************************************************************
+
+#include <string.h>
+
+#include "global.h"
+#include "ring.h"
+#include "uart.h"
+#include "gps.h"
+#include "ubx.h"
+#include "host.h"
+
+GpsInfoType GpsInfo;
+GpsBaudType GpsBaud;
+
+GpsBaudType* gpsGetBaud(void)
+{
+	return &GpsBaud;
+}
+
+uint8_t gpsBaudIsLocked(void)
+{
+	return GpsBaud.state == GPS_BAUD_LOCKED;
+}
+
+// sends a message with payload through the receive interrupt
+static void receive(uint8_t msgClass, uint8_t msgId, const uint8_t* payload, uint16_t length, uint8_t corrupt)
+{
+	uint8_t header[4] = {msgClass, msgId, length, length>>8};
+	uint8_t ckA = 0;
+	uint8_t ckB = 0;
+	uint16_t i;
+
+	hostUartReceive(UBX_SYNC1);
+	hostUartReceive(UBX_SYNC2);
+	for(i=0; i<4; i++)
+	{
+		ckA += header[i];
+		ckB += ckA;
+		hostUartReceive(header[i]);
+	}
+	for(i=0; i<length; i++)
+	{
+		ckA += payload[i];
+		ckB += ckA;
+		hostUartReceive(payload[i]);
+		// the main loop keeps up, the ring is smaller than a PVT message
+		if((i & 0x1F) == 0x1F)
+			ubxProcess(uartGetRxBuffer());
+	}
+	hostUartReceive(ckA ^ corrupt);
+	hostUartReceive(ckB);
+}
+
+// runs the parser until the receive buffer is empty, returns the last message
+static uint8_t process(void)
+{
+	uint8_t packet;
+	uint8_t last = UBX_NODATA;
+
+	while(ringGetDataLength(uartGetRxBuffer()))
+	{
+		if((packet = ubxProcess(uartGetRxBuffer())))
+			last = packet;
+	}
+	return last;
+}
+
+static void putU16(uint8_t* p, uint16_t value)
+{
+	p[0] = value;
+	p[1] = value>>8;
+}
+
+static void putU32(uint8_t* p, uint32_t value)
+{
+	putU16(p, value);
+	putU16(p+2, value>>16);
+}
+
+// NAV-TIMEUTC payload for 2024-02-29 23:59:58
+static void timeUtc(uint8_t* p, int32_t nano, uint8_t valid)
+{
+	memset(p, 0, 20);
+	putU32(p+4, 25);				// tAcc [ns]
+	putU32(p+8, nano);
+	putU16(p+12, 2024);
+	p[14] = 2;
+	p[15] = 29;
+	p[16] = 23;
+	p[17] = 59;
+	p[18] = 58;
+	p[19] = valid;
+}
+
+static void reset(void)
+{
+	uartInit();
+	hostMillis = 0;
+	memset(&GpsInfo, 0, sizeof(GpsInfo));
+	memset(&GpsBaud, 0, sizeof(GpsBaud));
+	ubxInit();
+}
+
+static void testTimeUtc(void)
+{
+	uint8_t payload[20];
+
+	reset();
+	hostMillis = 5000;
+	timeUtc(payload, 123456789, UBX_VALID_MASK);
+	receive(UBX_CLASS_NAV, UBX_NAV_TIMEUTC, payload, sizeof(payload), 0);
+	CHECK(process() == UBX_TIMEUTC);
+	CHECK(GpsInfo.UtcTime.year == 24 && GpsInfo.UtcTime.month == 2 && GpsInfo.UtcTime.day == 29);
+	CHECK(GpsInfo.UtcTime.hour == 23 && GpsInfo.UtcTime.minute == 59 && GpsInfo.UtcTime.second == 58);
+	CHECK(GpsInfo.UtcTime.millis == 123);
+	CHECK(GpsInfo.UtcNano == 123456789 && GpsInfo.UtcAccuracy == 25);
+	CHECK(GpsInfo.validTimeReceivedMillis == 5000);
+	CHECK(GpsInfo.UbxStats.accepted == 1 && GpsInfo.UbxStats.configured);
+
+	// a solution just before the second counts as its start
+	timeUtc(payload, -2000, UBX_VALID_MASK);
+	receive(UBX_CLASS_NAV, UBX_NAV_TIMEUTC, payload, sizeof(payload), 0);
+	CHECK(process() == UBX_TIMEUTC && GpsInfo.UtcTime.millis == 0);
+
+	// without valid UTC the last time stays
+	hostMillis = 6000;
+	timeUtc(payload, 0, UBX_VALID_TOW|UBX_VALID_WKN);
+	payload[18] = 10;
+	receive(UBX_CLASS_NAV, UBX_NAV_TIMEUTC, payload, sizeof(payload), 0);
+	CHECK(process() == UBX_TIMEUTC);
+	CHECK(GpsInfo.UtcTime.second == 58 && GpsInfo.validTimeReceivedMillis == 5000);
+
+	// a corrupted message is counted and dropped
+	timeUtc(payload, 0, UBX_VALID_MASK);
+	payload[18] = 10;
+	receive(UBX_CLASS_NAV, UBX_NAV_TIMEUTC, payload, sizeof(payload), 0x01);
+	CHECK(process() == UBX_NODATA);
+	CHECK(GpsInfo.UbxStats.badChecksum == 1 && GpsInfo.UtcTime.second == 58);
+
+	// a corrupted length does not swallow the message behind it
+	hostUartReceive(UBX_SYNC1);
+	hostUartReceive(UBX_SYNC2);
+	hostUartReceive(UBX_CLASS_NAV);
+	hostUartReceive(UBX_NAV_TIMEUTC);
+	hostUartReceive(20);
+	hostUartReceive(0x80);
+	receive(UBX_CLASS_NAV, UBX_NAV_TIMEUTC, payload, sizeof(payload), 0);
+	CHECK(process() == UBX_TIMEUTC);
+	CHECK(GpsInfo.UbxStats.badLength == 1 && GpsInfo.UtcTime.second == 10);
+}
+
+static void testStamp(void)
+{
+	uint8_t payload[20];
+
+	// the time belongs to the arrival of the sync char, not to the parse,
+	// sync chars in the payload and in front do not move it
+	reset();
+	hostMillis = 7000;
+	hostUartReceive(UBX_SYNC1);
+	hostMillis = 7010;
+	timeUtc(payload, 0, UBX_VALID_MASK);
+	payload[0] = UBX_SYNC1;
+	payload[1] = UBX_SYNC1;
+	receive(UBX_CLASS_NAV, UBX_NAV_TIMEUTC, payload, sizeof(payload), 0);
+	hostMillis = 7250;
+	CHECK(process() == UBX_TIMEUTC);
+	CHECK(GpsInfo.validTimeReceivedMillis == 7010);
+
+	// the next message gets its own stamp
+	hostMillis = 8010;
+	receive(UBX_CLASS_NAV, UBX_NAV_TIMEUTC, payload, sizeof(payload), 0);
+	hostMillis = 8500;
+	CHECK(process() == UBX_TIMEUTC);
+	CHECK(GpsInfo.validTimeReceivedMillis == 8010);
+}
+
+static void testPvt(void)
+{
+	uint8_t payload[92];
+
+	// only the first UBX_MAXPAYLOAD bytes are kept, the rest is checksummed
+	reset();
+	memset(payload, 0xA5, sizeof(payload));
+	putU16(payload+4, 2030);
+	payload[6] = 12;
+	payload[7] = 31;
+	payload[8] = 12;
+	payload[9] = 0;
+	payload[10] = 1;
+	payload[11] = UBX_VALID_MASK;
+	putU32(payload+12, 40);
+	putU32(payload+16, 500000000);
+	payload[23] = 11;
+	receive(UBX_CLASS_NAV, UBX_NAV_PVT, payload, sizeof(payload), 0);
+	CHECK(process() == UBX_PVT);
+	CHECK(GpsInfo.numSVs == 11);
+	CHECK(GpsInfo.UtcTime.year == 30 && GpsInfo.UtcTime.month == 12 && GpsInfo.UtcTime.day == 31);
+	CHECK(GpsInfo.UtcTime.hour == 12 && GpsInfo.UtcTime.second == 1 && GpsInfo.UtcTime.millis == 500);
+
+	// other classes are checked and reported as unknown
+	receive(UBX_CLASS_ACK, UBX_ACK_ACK, payload, 2, 0);
+	CHECK(process() == UBX_UNKNOWN);
+	CHECK(GpsInfo.UbxStats.accepted == 2 && GpsInfo.UbxStats.badChecksum == 0);
+}
+
+static void testConfigure(void)
+{
+	uint8_t sent[128];
+	uint16_t n;
+	uint16_t i;
+	uint8_t ckA;
+	uint8_t ckB;
+	uint8_t messages = 0;
+
+	// nothing is sent before the rate is known
+	reset();
+	hostMillis = UBX_CONFIG_RETRY_MS;
+	process();
+	ubxProcess(uartGetRxBuffer());
+	CHECK(uartTransmitIsIdle());
+
+	GpsBaud.state = GPS_BAUD_LOCKED;
+	GpsBaud.rate = 115200;
+	ubxProcess(uartGetRxBuffer());
+	n = hostUartTransmit(sent, sizeof(sent));
+	CHECK(n == 8+20 + 8+3);
+
+	// two well formed messages, CFG-PRT keeps the rate found
+	for(i=0; i+8 <= n; i += 8 + (sent[i+4] | sent[i+5]<<8))
+	{
+		uint16_t length = sent[i+4] | sent[i+5]<<8;
+		uint16_t j;
+
+		CHECK(sent[i] == UBX_SYNC1 && sent[i+1] == UBX_SYNC2 && sent[i+2] == UBX_CLASS_CFG);
+		ckA = 0;
+		ckB = 0;
+		for(j=2; j<6+length; j++)
+		{
+			ckA += sent[i+j];
+			ckB += ckA;
+		}
+		CHECK(sent[i+6+length] == ckA && sent[i+7+length] == ckB);
+		if(sent[i+3] == UBX_CFG_PRT)
+			CHECK(sent[i+6+UBX_CFG_PRT_BAUD] == 0x00 && sent[i+7+UBX_CFG_PRT_BAUD] == 0xC2 && sent[i+8+UBX_CFG_PRT_BAUD] == 0x01);
+		messages++;
+	}
+	CHECK(messages == 2);
+
+	// repeated until navigation data arrives
+	hostMillis += UBX_CONFIG_RETRY_MS-1;
+	ubxProcess(uartGetRxBuffer());
+	CHECK(uartTransmitIsIdle());
+	hostMillis++;
+	ubxProcess(uartGetRxBuffer());
+	CHECK(hostUartTransmit(sent, sizeof(sent)) == n);
+}
+
+int main(void)
+{
+	testTimeUtc();
+	testStamp();
+	testPvt();
+	testConfigure();
+	return hostResult("ubx");
+}
@@ -4,6 +4,7 @@
 #include "usb_serial.h"
 #include "i2c.h"
 
+#include "config.h"
 #include "cmdlineinterface.h"
 #include "rprintf.h"
 #include "systemtime.h"
@@ -11,6 +12,7 @@
 #include "time.h"
 #include "rtc.h"
 #include "gps.h"
+#include "pps.h"
 #include "display.h"
 #include "timezone.h"
 
@@ -38,22 +40,27 @@ int main(void)
 	LED_GREEN_OFF;
 	LED_RED_OFF;
 
+	// settings for the modules below
+	configInit();
+
 	usb_init();
 	rprintfInit(usb_serial_putchar);
 	cmdlineInterfaceInit();
 
 	rtcInit();
 	gpsInit();
+	ppsInit();
 
 	timeInit();
-	timeSetSyncProvider(rtcGetTime);
-	timeSetSyncInterval(60);
 
+	// the sync service picks the best of the sources, the RTC
+	// included, and holds the time over outages
 	timeSyncServiceInit();
 	timeSyncServiceSetSyncReceiver(rtcSetTime);
-	timeSyncServiceSetSyncProviderHighValidity(gpsGetTime);
-	//timeSyncServiceSetSyncProviderLowValidity(ntpGetTime);
-	timeSyncServiceSetInterval(30);
+	timeSyncServiceAddSource(PSTR("pps"), ppsGetTimeAt, PPS_DISPERSION_MS);
+	timeSyncServiceAddSource(PSTR("gps"), gpsGetTimeAt, GPS_DISPERSION_MS);
+	timeSyncServiceAddSource(PSTR("rtc"), rtcGetTimeAt, RTC_DISPERSION_MS);
+	timeSyncServiceSetInterval(configGet()->syncServiceInterval);
 
 	timezoneInit();
 
@@ -70,6 +77,7 @@ int main(void)
 
 		cmdlineInterfaceProcess();
 		timeSyncServiceProcess();
+		configProcess();
 
 		//outsource that in display function
 		if(timeStatus() != timeNotSet)
@@ -78,7 +86,7 @@ int main(void)
 			if(timeNow() != prevDisplayUTC)
 			{
 				prevDisplayUTC = timeNow();
-				displayTime(timezoneTimeToLocal(prevDisplayUTC));
+				displayClock(prevDisplayUTC);
 			}
 		}
 		else
@@ -19,20 +19,20 @@
 //
 //*****************************************************************************
 
+
 #ifndef WIN32
 #include <avr/io.h>
 #include <avr/interrupt.h>
 #include <avr/pgmspace.h>
 #endif
 #include <string.h>
-#include <stdlib.h>
-#include <math.h>
 
 #include "global.h"
-#include "buffer.h"
+#include "ring.h"
 #include "rprintf.h"
 #include "time.h"
 #include "systemtime.h"
+#include "uart.h"
 #include "gps.h"
 
 #include "nmea.h"
@@ -40,302 +40,487 @@
 
 // Program ROM constants
 
+// accepted talker IDs: GPS, GNSS (combined), GLONASS, Galileo, BeiDou
+const uint8_t NmeaTalkers[] PROGMEM = "GPGNGLGAGB";
+
+// sentence types we decode, all others are dropped after the header
+const NmeaSentenceType NmeaSentences[] PROGMEM =
+{
+	{"RMC", NMEA_RMC, nmeaProcessRMC},
+	{"ZDA", NMEA_ZDA, nmeaProcessZDA},
+	{"GGA", NMEA_GGA, nmeaProcessGGA},
+};
+
+#define NMEA_NUM_SENTENCES	(sizeof(NmeaSentences)/sizeof(NmeaSentenceType))
+
 // Global variables
 extern GpsInfoType GpsInfo;
-uint8_t NmeaPacket[NMEA_BUFFERSIZE];
+NmeaParserType NmeaParser;
+ringBuffer* NmeaRxBuffer;
 
 void nmeaInit(void)
 {
-	
-}
-
-uint8_t* nmeaGetPacketBuffer(void)
-{
-	return NmeaPacket;
+	NmeaParser.state = NMEA_STATE_IDLE;
+	NmeaParser.scan = 0;
+	NmeaParser.length = 0;
+	NmeaParser.field = 0;
+	NmeaParser.checksum = 0;
+	NmeaParser.sentence = 0;
+	NmeaParser.starts = 0;
+	NmeaParser.lines = 0;
 }
 
-uint8_t nmeaProcess(cBuffer* rxBuffer)
+uint8_t nmeaProcess(ringBuffer* rxBuffer)
 {
-	uint8_t foundpacket = NMEA_NODATA;
-	uint8_t startFlag = FALSE;
-	//uint8_t data;
-	uint16_t i,j;
-
-	// process the receive buffer
-	// go through buffer looking for packets
-	while(rxBuffer->datalength)
+	const NmeaSentenceType* sentence;
+	ringSpans spans;
+	uint8_t* data;
+	uint8_t* next;
+	uint8_t count;
+	uint8_t skip;
+	uint8_t span;
+	uint8_t c;
+	uint8_t end;
+	uint8_t pending;
+	uint8_t packet = NMEA_NODATA;
+	uint32_t stamp;
+
+	// the receive interrupt queues the end of every line, without
+	// a complete line there is nothing to do
+	pending = uartGetRxLine(NmeaParser.lines, &end);
+	if(!pending && ringIsNotFull(rxBuffer))
+		return NMEA_NODATA;
+
+	// sentences are parsed in place, the front of the receive buffer is
+	// always the '$' of the sentence in progress (or garbage while idle)
+	NmeaRxBuffer = rxBuffer;
+	// take one snapshot of the received data, the bytes in it
+	// are not touched by the receive interrupt anymore
+	count = ringPeekSpans(rxBuffer, &spans);
+
+	if(pending > UART_RX_LINES)
 	{
-		// look for a start of NMEA packet
-		if(bufferGetAtIndex(rxBuffer,0) == '$')
+		// fell too far behind, the line ends were overwritten,
+		// catch up with everything received so far, all of it in
+		// this call, one packet per call would never catch up
+		NmeaParser.lines += pending;
+	}
+	else if(pending)
+	{
+		// parse exactly up to the end of the next line
+		NmeaParser.lines++;
+		c = end - rxBuffer->tail;
+		if(c <= count)
 		{
-			// found start
-			startFlag = TRUE;
-			// when start is found, we leave it intact in the receive buffer
-			// in case the full NMEA string is not completely received.  The
-			// start will be detected in the next nmeaProcess iteration.
-
-			// done looking for start
-			break;
+			if(c <= spans.length[0])
+			{
+				spans.length[0] = c;
+				spans.length[1] = 0;
+			}
+			else
+				spans.length[1] = c - spans.length[0];
 		}
-		else
-			bufferGetFromFront(rxBuffer);
 	}
 
-	// if we detected a start, look for end of packet
-	if(startFlag)
+	// look at every received byte exactly once
+	// stop after one complete packet to keep the time per call bounded,
+	// unless catching up
+	skip = NmeaParser.scan;
+	for(span=0; span<2; span++)
 	{
-		for(i=1; i<(rxBuffer->datalength)-1; i++)
+		data = spans.data[span];
+		count = spans.length[span];
+		// step over what earlier calls have parsed already
+		if(skip >= count)
+		{
+			skip -= count;
+			continue;
+		}
+		data += skip;
+		count -= skip;
+		skip = 0;
+
+		while(count)
 		{
-			// check for end of NMEA packet <CR><LF>
-			if((bufferGetAtIndex(rxBuffer,i) == '\r') && (bufferGetAtIndex(rxBuffer,i+1) == '\n'))
+			if(NmeaParser.state == NMEA_STATE_IDLE)
+			{
+				// outside a packet only the next '$' matters, this skips
+				// the rest of ignored sentences in one go
+				next = memchr(data, '$', count);
+				c = next ? next - data : count;
+				NmeaParser.scan += c;
+				data += c;
+				count -= c;
+				if(!count)
+					break;
+			}
+			c = *data++;
+			count--;
+
+			if(c == '$')
 			{
-				// have a packet end
-				// dump initial '$'
-				bufferGetFromFront(rxBuffer);
-				// copy packet to NmeaPacket
-				for(j=0; j<(i-1); j++)
+				if(NmeaParser.scan)
 				{
-					// although NMEA strings should be 80 characters or less,
-					// receive buffer errors can generate erroneous packets.
-					// Protect against packet buffer overflow
-					if(j<(NMEA_BUFFERSIZE-1))
-						NmeaPacket[j] = bufferGetFromFront(rxBuffer);
-					else
-						bufferGetFromFront(rxBuffer);
+					// drop everything in front of the new packet start
+					ringDumpFromFront(rxBuffer, NmeaParser.scan);
+					GpsInfo.NmeaStats.bytes += NmeaParser.scan;
+					NmeaParser.scan = 0;
 				}
-				// null terminate it
-				NmeaPacket[j] = 0;
-				// dump <CR><LF> from rxBuffer
-				bufferGetFromFront(rxBuffer);
-				bufferGetFromFront(rxBuffer);
+				// each '$' is seen here exactly once, in the order the
+				// receive interrupt stamped them
+				if(!uartGetRxStamp(NmeaParser.starts++, &stamp))
+					stamp = systemTimeGetMilliseconds();
+				NmeaParser.stamp = stamp;
+			}
 
+			if(nmeaParseByte(c))
+			{
 #ifdef NMEA_DEBUG_PKT
-				rprintf("Rx NMEA packet type: ");
-				rprintfStrLen(NmeaPacket, 0, 5);
-				rprintfStrLen(NmeaPacket, 5, (i-1)-5);
+				rprintf("Rx NMEA packet: ");
+				for(c=1; c<NmeaParser.length; c++)
+					rprintfChar(nmeaPeek(c));
 				rprintfCRLF();
 #endif
-				// found a packet
-				// done with this processing session
-				foundpacket = NMEA_UNKNOWN;
-				break;
+				// found a packet, the header was already matched while receiving
+				sentence = &NmeaSentences[NmeaParser.sentence];
+				((NmeaHandlerFuncPtr)pgm_read_word(&sentence->handler))();
+				// release the packet
+				ringDumpFromFront(rxBuffer, NmeaParser.scan);
+				GpsInfo.NmeaStats.bytes += NmeaParser.scan;
+				NmeaParser.scan = 0;
+				// report packet type, the last one when catching up
+				packet = pgm_read_byte(&sentence->code);
+				if(pending <= UART_RX_LINES)
+					return packet;
 			}
 		}
 	}
 
-	if(foundpacket)
+	if(NmeaParser.state == NMEA_STATE_IDLE && NmeaParser.scan)
 	{
-		// check message type and process appropriately
-		/*
-		if(!strncmp((const char*)NmeaPacket, "GPGGA", 5))
+		// release garbage and rejected packets
+		ringDumpFromFront(rxBuffer, NmeaParser.scan);
+		GpsInfo.NmeaStats.bytes += NmeaParser.scan;
+		NmeaParser.scan = 0;
+	}
+	return packet;
+}
+
+uint8_t nmeaPeek(uint8_t offset)
+{
+	// only the consumer moves tail and the receive interrupt only
+	// appends, so received bytes can be read without a critical section
+	return NmeaRxBuffer->dataptr[(uint8_t)(NmeaRxBuffer->tail + offset) & NmeaRxBuffer->mask];
+}
+
+uint8_t nmeaLookupSentence(void)
+{
+	uint8_t i, j;
+
+	// header is the talker ID followed by the sentence type, e.g. "GNRMC"
+	for(i=0; i<sizeof(NmeaTalkers)-1; i+=2)
+	{
+		if(nmeaPeek(1) == pgm_read_byte(&NmeaTalkers[i]) &&
+		   nmeaPeek(2) == pgm_read_byte(&NmeaTalkers[i+1]))
+			break;
+	}
+	if(i >= sizeof(NmeaTalkers)-1)
+		return NMEA_UNKNOWN;
+
+	for(i=0; i<NMEA_NUM_SENTENCES; i++)
+	{
+		for(j=0; j<3; j++)
+		{
+			if(nmeaPeek(3+j) != pgm_read_byte(&NmeaSentences[i].type[j]))
+				break;
+		}
+		if(j == 3)
+			return i;
+	}
+	return NMEA_UNKNOWN;
+}
+
+uint8_t nmeaHexDigit(uint8_t c)
+{
+	if(c >= '0' && c <= '9')
+		return c - '0';
+	if(c >= 'A' && c <= 'F')
+		return c - 'A' + 10;
+	if(c >= 'a' && c <= 'f')
+		return c - 'a' + 10;
+	return 0xFF;
+}
+
+uint8_t nmeaParseByte(uint8_t c)
+{
+	uint8_t pos = NmeaParser.scan++;
+	uint8_t d;
+
+	// a '$' always starts a new packet, even in the middle of a broken one
+	if(c == '$')
+	{
+		if(NmeaParser.state != NMEA_STATE_IDLE)
+			GpsInfo.NmeaStats.truncated++;
+		NmeaParser.state = NMEA_STATE_DATA;
+		NmeaParser.field = 0;
+		NmeaParser.fieldStart[0] = pos+1;
+		NmeaParser.checksum = 0;
+		return FALSE;
+	}
+
+	switch(NmeaParser.state)
+	{
+	case NMEA_STATE_DATA:
+		if(c == '*')
+		{
+			// a sentence without fields was never looked up,
+			// none of the decoded ones is that short
+			if(NmeaParser.field == 0)
+			{
+				NmeaParser.state = NMEA_STATE_IDLE;
+				GpsInfo.NmeaStats.ignored++;
+				break;
+			}
+			// end of data
+			NmeaParser.length = pos;
+			NmeaParser.state = NMEA_STATE_CHECKSUM_HI;
+			break;
+		}
+		if(c == '\r' || c == '\n')
+		{
+			// packet ended without a checksum
+			NmeaParser.state = NMEA_STATE_IDLE;
+			GpsInfo.NmeaStats.truncated++;
+			break;
+		}
+		// although NMEA strings should be 80 characters or less,
+		// receive buffer errors can generate erroneous packets.
+		// Drop packets that are too long
+		if(pos > NMEA_MAXLENGTH)
+		{
+			NmeaParser.state = NMEA_STATE_IDLE;
+			GpsInfo.NmeaStats.overflowed++;
+			break;
+		}
+		// checksum is the XOR of all bytes between '$' and '*'
+		NmeaParser.checksum ^= c;
+		if(c == ',')
+		{
+			// end of the header, drop sentences nobody decodes
+			// before the rest of them is parsed
+			if(NmeaParser.field == 0)
+			{
+				if(pos != 6 || (NmeaParser.sentence = nmeaLookupSentence()) == NMEA_UNKNOWN)
+				{
+					NmeaParser.state = NMEA_STATE_IDLE;
+					GpsInfo.NmeaStats.ignored++;
+					break;
+				}
+			}
+			// remember where the next field starts
+			if(++NmeaParser.field < NMEA_MAXFIELDS)
+				NmeaParser.fieldStart[NmeaParser.field] = pos+1;
+			break;
+		}
+		if(NmeaParser.field == 0 && pos > 5)
+		{
+			// header longer than talker ID and sentence type
+			NmeaParser.state = NMEA_STATE_IDLE;
+			GpsInfo.NmeaStats.ignored++;
+		}
+		break;
+	case NMEA_STATE_CHECKSUM_HI:
+	case NMEA_STATE_CHECKSUM_LO:
+		if((d = nmeaHexDigit(c)) > 0x0F)
+		{
+			NmeaParser.state = NMEA_STATE_IDLE;
+			GpsInfo.NmeaStats.truncated++;
+			break;
+		}
+		// remove the received checksum nibble by nibble,
+		// a correct packet leaves zero behind
+		if(NmeaParser.state == NMEA_STATE_CHECKSUM_HI)
+		{
+			NmeaParser.checksum ^= d<<4;
+			NmeaParser.state = NMEA_STATE_CHECKSUM_LO;
+		}
+		else
 		{
-			// process packet of this type
-			nmeaProcessGPGGA(NmeaPacket);
-			// report packet type
-			foundpacket = NMEA_GPGGA;
+			NmeaParser.checksum ^= d;
+			NmeaParser.state = NMEA_STATE_CR;
 		}
-		else if(!strncmp((const char*)NmeaPacket, "GPVTG", 5))
+		break;
+	case NMEA_STATE_CR:
+		if(c == '\r')
+			break;
+		NmeaParser.state = NMEA_STATE_IDLE;
+		if(c != '\n')
 		{
-			// process packet of this type
-			nmeaProcessGPVTG(NmeaPacket);
-			// report packet type
-			foundpacket = NMEA_GPVTG;
+			GpsInfo.NmeaStats.truncated++;
+			break;
 		}
-		*/
-		if(!strncmp((const char*)NmeaPacket, "GPRMC", 5))
+		// have a packet end
+		if(NmeaParser.checksum)
 		{
-			// process packet of this type
-			nmeaProcessGPRMC(NmeaPacket);
-			// report packet type
-			foundpacket = NMEA_GPRMC;
+			GpsInfo.NmeaStats.badChecksum++;
+			break;
 		}
+		GpsInfo.NmeaStats.accepted++;
+		return TRUE;
+	default:
+		// waiting for start of packet
+		break;
 	}
-	else if(rxBuffer->datalength >= rxBuffer->size)
+	return FALSE;
+}
+
+uint8_t nmeaGetField(uint8_t field)
+{
+	// fields that were not received point to the '*'
+	if(field > NmeaParser.field || field >= NMEA_MAXFIELDS)
+		return NmeaParser.length;
+	return NmeaParser.fieldStart[field];
+}
+
+uint8_t nmeaParseDigits(uint8_t offset, uint8_t n, uint8_t* value)
+{
+	uint8_t v = 0;
+	uint8_t d;
+
+	while(n--)
 	{
-		// if we found no packet, and the buffer is full
-		// we're logjammed, flush entire buffer
-		bufferFlush(rxBuffer);
+		d = nmeaPeek(offset++) - '0';
+		// rejects ',', '*' and any other non-digit
+		if(d > 9)
+			return FALSE;
+		v = v*10 + d;
 	}
-	return foundpacket;
+	*value = v;
+	return TRUE;
 }
-/*
-void nmeaProcessGPGGA(uint8_t* packet)
-{
-	uint8_t i;
-	char* endptr;
-	double degrees, minutesfrac;
-
-#ifdef NMEA_DEBUG_GGA
-	rprintf("NMEA: ");
-	rprintfStr(packet);
-	rprintfCRLF();
-#endif
 
-	// start parsing just after "GPGGA,"
-	i = 6;
-	// attempt to reject empty packets right away
-	if(packet[i]==',' && packet[i+1]==',')
-		return;
+uint8_t nmeaParseTime(uint8_t offset, GpsTimeType* time)
+{
+	uint8_t d;
+	uint16_t scale = 100;
 
 	// get UTC time [hhmmss.sss]
-	//GpsInfo.PosLLA.TimeOfFix.f = strtod((const char*)&packet[i], &endptr);
-	while(packet[i++] != ',');				// next field: latitude
-
-	// get latitude [ddmm.mmmmm]
-	//GpsInfo.PosLLA.lat.f = strtod((const char*)&packet[i], &endptr);
-	// convert to pure degrees [dd.dddd] format
-	//minutesfrac = modf(GpsInfo.PosLLA.lat.f/100, &degrees);
-	//GpsInfo.PosLLA.lat.f = degrees + (minutesfrac*100)/60;
-	// convert to radians
-	//GpsInfo.PosLLA.lat.f *= (M_PI/180);
-	while(packet[i++] != ',');				// next field: N/S indicator
-
-	// correct latitute for N/S
-	//if(packet[i] == 'S') GpsInfo.PosLLA.lat.f = -GpsInfo.PosLLA.lat.f;
-	while(packet[i++] != ',');				// next field: longitude
-
-	// get longitude [ddmm.mmmmm]
-	//GpsInfo.PosLLA.lon.f = strtod((const char*)&packet[i], &endptr);
-	// convert to pure degrees [dd.dddd] format
-	//minutesfrac = modf(GpsInfo.PosLLA.lon.f/100, &degrees);
-	//GpsInfo.PosLLA.lon.f = degrees + (minutesfrac*100)/60;
-	// convert to radians
-	//GpsInfo.PosLLA.lon.f *= (M_PI/180);
-	while(packet[i++] != ',');				// next field: E/W indicator
-
-	// correct latitute for E/W
-	//if(packet[i] == 'W') GpsInfo.PosLLA.lon.f = -GpsInfo.PosLLA.lon.f;
-	while(packet[i++] != ',');				// next field: position fix status
-
-	// position fix status
-	// 0 = Invalid, 1 = Valid SPS, 2 = Valid DGPS, 3 = Valid PPS
-	// check for good position fix
-	if( (packet[i] != '0') && (packet[i] != ',') )
-		GpsInfo.PosLLA.updates++;
-	while(packet[i++] != ',');				// next field: satellites used
-
-	// get number of satellites used in GPS solution
-	GpsInfo.numSVs = atoi((const char*)&packet[i]);
-	while(packet[i++] != ',');				// next field: HDOP (horizontal dilution of precision)
-	while(packet[i++] != ',');				// next field: altitude
-
-	// get altitude (in meters)
-	//GpsInfo.PosLLA.alt.f = strtod((const char*)&packet[i], &endptr);
-
-	while(packet[i++] != ',');				// next field: altitude units, always 'M'
-	while(packet[i++] != ',');				// next field: geoid seperation
-	while(packet[i++] != ',');				// next field: seperation units
-	while(packet[i++] != ',');				// next field: DGPS age
-	while(packet[i++] != ',');				// next field: DGPS station ID
-	while(packet[i++] != '*');				// next field: checksum
+	if(!nmeaParseDigits(offset, 2, &time->hour) ||
+	   !nmeaParseDigits(offset+2, 2, &time->minute) ||
+	   !nmeaParseDigits(offset+4, 2, &time->second))
+		return FALSE;
+	if(time->hour > 23 || time->minute > 59 || time->second > 60)
+		return FALSE;
+
+	// the fraction has a receiver dependent number of digits (or none)
+	time->millis = 0;
+	offset += 6;
+	if(nmeaPeek(offset++) == '.')
+	{
+		while(scale && (d = nmeaPeek(offset++) - '0') <= 9)
+		{
+			time->millis += d * scale;
+			scale /= 10;
+		}
+	}
+	return TRUE;
 }
 
-void nmeaProcessGPVTG(uint8_t* packet)
+uint8_t nmeaParseDate(uint8_t offset, GpsTimeType* time)
 {
-	uint8_t i;
-	char* endptr;
+	// get UTC date [ddmmyy]
+	if(!nmeaParseDigits(offset, 2, &time->day) ||
+	   !nmeaParseDigits(offset+2, 2, &time->month) ||
+	   !nmeaParseDigits(offset+4, 2, &time->year))
+		return FALSE;
+	return nmeaDateIsValid(time);
+}
 
-#ifdef NMEA_DEBUG_VTG
-	rprintf("NMEA: ");
-	rprintfStr(packet);
-	rprintfCRLF();
-#endif
+uint8_t nmeaDateIsValid(GpsTimeType* time)
+{
+	// a day past the end of the month would roll into the next one in
+	// timeMake(), the year counts from 2000 like in gpsGetTime()
+	if(time->month < 1 || time->month > 12)
+		return FALSE;
+	return (time->day >= 1 && time->day <= timeMonthLength(time->month, y2kYearToTm(time->year)));
+}
 
-	// start parsing just after "GPVTG,"
-	i = 6;
-	// attempt to reject empty packets right away
-	if(packet[i]==',' && packet[i+1]==',')
-		return;
+void nmeaSetTime(GpsTimeType* time)
+{
+	GpsInfo.UtcTime = *time;
+	// the sentence time belongs to the moment the sentence started
+	// arriving, not to the moment it was parsed
+	GpsInfo.validTimeReceivedMillis = NmeaParser.stamp;
+}
+
+void nmeaProcessRMC(void)
+{
+	GpsTimeType time;
 
-	// get course (true north ref) in degrees [ddd.dd]
-	//GpsInfo.VelHS.heading.f = strtod((const char*)&packet[i], &endptr);
-	while(packet[i++] != ',');				// next field: 'T'
-	while(packet[i++] != ',');				// next field: course (magnetic north)
+	// fields are looked up by the offsets recorded while receiving,
+	// so nothing before them is scanned again
 
-	// get course (magnetic north ref) in degrees [ddd.dd]
-	//GpsInfo.VelHS.heading.f = strtod(&packet[i], &endptr);
-	while(packet[i++] != ',');				// next field: 'M'
-	while(packet[i++] != ',');				// next field: speed (knots)
+	// validity check
+	// V = Invalid, A = OK
+	if( nmeaPeek(nmeaGetField(2)) != 'A' )
+		return;
 
-	// get speed in knots
-	//GpsInfo.VelHS.speed.f = strtod(&packet[i], &endptr);
-	while(packet[i++] != ',');				// next field: 'N'
-	while(packet[i++] != ',');				// next field: speed (km/h)
+	// field 1: UTC time [hhmmss.sss]
+	// field 9: date stamp [ddmmyy]
+	// decode into a local copy so a malformed packet leaves GpsInfo untouched
+	if(!nmeaParseTime(nmeaGetField(1), &time) || !nmeaParseDate(nmeaGetField(9), &time))
+		return;
 
-	// get speed in km/h
-	//GpsInfo.VelHS.speed.f = strtod((const char*)&packet[i], &endptr);
-	while(packet[i++] != ',');				// next field: 'K'
-	while(packet[i++] != '*');				// next field: checksum
+	nmeaSetTime(&time);
 
-	GpsInfo.VelHS.updates++;
+	GpsInfo.PosLLA.updates++;
+
+	// fields 3-6: latitude [ddmm.mmmmm], N/S, longitude [dddmm.mmmmm], E/W
+	// fields 7-8: speed in knots, true course
+	// fields 10-11: variation, variation e/w
 }
-*/
 
-void nmeaProcessGPRMC(uint8_t* packet)
+void nmeaProcessZDA(void)
 {
-	uint8_t i;
-	char* endptr;
-	double degrees, minutesfrac;
-
-#ifdef NMEA_DEBUG_RMC
-	rprintf("NMEA: ");
-	rprintfStr(packet);
-	rprintfCRLF();
-#endif
-
-	// start parsing just after "GPGGA,"
-	i = 6;
-	// attempt to reject empty packets right away
-	if(packet[i]==',' && packet[i+1]==',')
+	GpsTimeType time;
+	uint8_t century;
+
+	// ZDA has no status field, receivers leave the fields empty
+	// until the time is known, so a complete decode is the validity check
+
+	// field 1: UTC time [hhmmss.sss]
+	// field 2-4: day [dd], month [mm], year [yyyy]
+	if(!nmeaParseTime(nmeaGetField(1), &time) ||
+	   !nmeaParseDigits(nmeaGetField(2), 2, &time.day) ||
+	   !nmeaParseDigits(nmeaGetField(3), 2, &time.month) ||
+	   !nmeaParseDigits(nmeaGetField(4), 2, &century) ||
+	   !nmeaParseDigits(nmeaGetField(4)+2, 2, &time.year))
+		return;
+	if(century != 20 || !nmeaDateIsValid(&time))
 		return;
 
-	// get UTC time [hhmmss.sss]
-	GpsInfo.PosLLA.TimeOfFix.f = strtod((const char*)&packet[i], &endptr);
-	while(packet[i++] != ',');				// next field: validity
+	nmeaSetTime(&time);
 
-	// validity check
-	// V = Invalid, A = OK
-	if( packet[i] != 'A' )
+	// fields 5-6: local zone hours, local zone minutes
+}
+
+void nmeaProcessGGA(void)
+{
+	uint8_t offset;
+	uint8_t d;
+
+	// field 6: position fix status
+	// 0 = Invalid, 1 = Valid SPS, 2 = Valid DGPS, 3 = Valid PPS
+	d = nmeaPeek(nmeaGetField(6));
+	if(d == '0' || d == ',' || d == '*')
 		return;
 
-	GpsInfo.validTimeReceivedMillis = systemTimeGetMilliseconds();
+	// field 7: number of satellites used in GPS solution
+	offset = nmeaGetField(7);
+	GpsInfo.numSVs = 0;
+	while((d = nmeaPeek(offset++) - '0') <= 9)
+		GpsInfo.numSVs = GpsInfo.numSVs*10 + d;
 
-	GpsInfo.PosLLA.updates++;
-	while(packet[i++] != ',');				// next field: latitude
-
-	// get latitude [ddmm.mmmmm]
-	//GpsInfo.PosLLA.lat.f = strtod((const char*)&packet[i], &endptr);
-	// convert to pure degrees [dd.dddd] format
-	//minutesfrac = modf(GpsInfo.PosLLA.lat.f/100, &degrees);
-	//GpsInfo.PosLLA.lat.f = degrees + (minutesfrac*100)/60;
-	// convert to radians
-	//GpsInfo.PosLLA.lat.f *= (M_PI/180);
-	while(packet[i++] != ',');				// next field: N/S indicator
-
-	// correct latitute for N/S
-	//if(packet[i] == 'S') GpsInfo.PosLLA.lat.f = -GpsInfo.PosLLA.lat.f;
-	while(packet[i++] != ',');				// next field: longitude
-
-	// get longitude [ddmm.mmmmm]
-	//GpsInfo.PosLLA.lon.f = strtod((const char*)&packet[i], &endptr);
-	// convert to pure degrees [dd.dddd] format
-	//minutesfrac = modf(GpsInfo.PosLLA.lon.f/100, &degrees);
-	//GpsInfo.PosLLA.lon.f = degrees + (minutesfrac*100)/60;
-	// convert to radians
-	//GpsInfo.PosLLA.lon.f *= (M_PI/180);
-	while(packet[i++] != ',');				// next field: E/W indicator
-
-	// correct latitute for E/W
-	//if(packet[i] == 'W') GpsInfo.PosLLA.lon.f = -GpsInfo.PosLLA.lon.f;
-	while(packet[i++] != ',');				// next field: speed in knots
-
-	while(packet[i++] != ',');				// next field: true course
-	while(packet[i++] != ',');				// next field: date stamp
-
-	GpsInfo.UtDate = strtol((const char*)&packet[i], &endptr, 10);
-	while(packet[i++] != ',');				// next field: variation
-
-	while(packet[i++] != ',');				// next field: variation e/w
-	while(packet[i++] != '*');				// next field: checksum
+	// fields 1-5: UTC time, latitude, N/S, longitude, E/W
+	// fields 8-14: HDOP, altitude, units, geoid separation, units, DGPS age, station
 }
-
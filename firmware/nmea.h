@@ -31,32 +31,74 @@
 #define NMEA_H
 
 #include "global.h"
-#include "buffer.h"
+#include "ring.h"
+#include "gps.h"
 
 // constants/macros/typdefs
-#define NMEA_BUFFERSIZE		80
+#define NMEA_MAXLENGTH		80	///< longest packet accepted, '$' up to '*'
+#define NMEA_MAXFIELDS		10	///< number of field start offsets kept, RMC date is field 9
+
+// Parser states
+#define NMEA_STATE_IDLE		0	// waiting for '$'
+#define NMEA_STATE_DATA		1	// parsing sentence body
+#define NMEA_STATE_CHECKSUM_HI	2	// got '*', waiting for checksum high nibble
+#define NMEA_STATE_CHECKSUM_LO	3	// waiting for checksum low nibble
+#define NMEA_STATE_CR		4	// waiting for <CR><LF>
+
+//! Incremental NMEA parser state, survives between nmeaProcess() calls
+typedef struct struct_NmeaParser
+{
+	uint8_t state;					///< current parser state (NMEA_STATE_*)
+	uint8_t scan;					///< offset of the next unparsed byte in the receive buffer
+	uint8_t length;					///< offset of the '*' ending the packet data
+	uint8_t field;					///< index of the field currently being received
+	uint8_t checksum;				///< running XOR checksum of the packet
+	uint8_t sentence;				///< index of the matched entry in NmeaSentences
+	uint8_t starts;					///< number of '$' seen, matches the uart timestamps
+	uint8_t lines;					///< number of lines parsed, matches the uart line ends
+	uint32_t stamp;					///< system time the packet's '$' was received at
+	uint8_t fieldStart[NMEA_MAXFIELDS];	///< offset of each field in the receive buffer
+} NmeaParserType;
 
 // Message Codes
 #define NMEA_NODATA		0	// No data. Packet not available, bad, or not decoded
-#define NMEA_GPGGA		1	// Global Positioning System Fix Data
-#define NMEA_GPVTG		2	// Course over ground and ground speed
-#define NMEA_GPGLL		3	// Geographic position - latitude/longitude
-#define NMEA_GPGSV		4	// GPS satellites in view
-#define NMEA_GPGSA		5	// GPS DOP and active satellites
-#define NMEA_GPRMC		6	// Recommended minimum specific GPS data
+#define NMEA_GGA		1	// Global Positioning System Fix Data
+#define NMEA_VTG		2	// Course over ground and ground speed
+#define NMEA_GLL		3	// Geographic position - latitude/longitude
+#define NMEA_GSV		4	// GPS satellites in view
+#define NMEA_GSA		5	// GPS DOP and active satellites
+#define NMEA_RMC		6	// Recommended minimum specific GPS data
+#define NMEA_ZDA		7	// UTC time and date
 #define NMEA_UNKNOWN	0xFF// Packet received but not known
 
+typedef void (*NmeaHandlerFuncPtr)(void);
+
+//! Sentence dispatch table entry, lives in program memory
+typedef struct struct_NmeaSentence
+{
+	uint8_t type[3];				///< sentence type without talker ID, e.g. "RMC"
+	uint8_t code;					///< message code reported by nmeaProcess()
+	NmeaHandlerFuncPtr handler;		///< decoder called for a complete packet
+} NmeaSentenceType;
+
 // Debugging
-//#define NMEA_DEBUG_PKT	///< define to enable debug of all NMEA messages
-//#define NMEA_DEBUG_GGA	///< define to enable debug of GGA messages
-//#define NMEA_DEBUG_VTG	///< define to enable debug of VTG messages
+//#define NMEA_DEBUG_PKT	///< define to enable debug of all decoded NMEA messages
 
 // functions
 void nmeaInit(void);
-uint8_t* nmeaGetPacketBuffer(void);
-uint8_t nmeaProcess(cBuffer* rxBuffer);
-//void nmeaProcessGPGGA(uint8_t* packet);
-//void nmeaProcessGPVTG(uint8_t* packet);
-void nmeaProcessGPRMC(uint8_t* packet);
+uint8_t nmeaProcess(ringBuffer* rxBuffer);
+uint8_t nmeaPeek(uint8_t offset);
+uint8_t nmeaLookupSentence(void);
+uint8_t nmeaHexDigit(uint8_t c);
+uint8_t nmeaParseByte(uint8_t c);
+uint8_t nmeaGetField(uint8_t field);
+uint8_t nmeaParseDigits(uint8_t offset, uint8_t n, uint8_t* value);
+uint8_t nmeaParseTime(uint8_t offset, GpsTimeType* time);
+uint8_t nmeaParseDate(uint8_t offset, GpsTimeType* time);
+uint8_t nmeaDateIsValid(GpsTimeType* time);
+void nmeaSetTime(GpsTimeType* time);
+void nmeaProcessGGA(void);
+void nmeaProcessRMC(void);
+void nmeaProcessZDA(void);
 
 #endif
@@ -0,0 +1,139 @@
+/*! \file pps.c \brief GPS pulse per second time discipline. */
+//*****************************************************************************
+//
+// File Name	: 'pps.c'
+// Title		: GPS pulse per second time discipline
+// Target MCU	: Atmel AVR Series
+// Editor Tabs	: 4
+//
+// This code is distributed under the GNU Public License
+//		which can be found at http://www.gnu.org/licenses/gpl.txt
+//
+//*****************************************************************************
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+#include "global.h"
+#include "timer32u4.h"
+#include "systemtime.h"
+#include "gps.h"
+
+#include "pps.h"
+
+#define PPS_CONFIG		(DDRD &= ~(1<<4))
+
+// Global variables
+volatile PpsType Pps;
+
+void ppsInit(void)
+{
+	PPS_CONFIG;
+	Pps.count = 0;
+	Pps.edges = 0;
+	Pps.drift = 0;
+
+	// timer1 runs with the same prescaler as the system time timer3,
+	// so capture ticks and millisecond ticks have the same length
+	timer1Init();
+	timer1SetPrescaler(TIMER3PRESCALE);
+	// rising edge, noise canceler on
+	TCCR1B |= (1<<ICES1)|(1<<ICNC1);
+	timerAttach(TIMER1INPUTCAPTURE_INT, ppsCapture);
+	TIFR1 = (1<<ICF1);
+	TIMSK1 |= (1<<ICIE1);
+}
+
+void ppsCapture(void)
+{
+	uint16_t capture = ICR1;
+	uint16_t age = TCNT1 - capture;
+	int32_t ticks = TCNT3;
+	uint32_t millis = systemTimeGetMilliseconds();
+
+	// a compare match that is not serviced yet already ended the millisecond
+	if((TIFR3 & (1<<OCF3A)) && ticks < SYSTEMTIME_TICKS_PER_MS/2)
+		millis++;
+
+	// position of the edge after the start of the millisecond, the
+	// interrupt may have been delayed by more than one millisecond
+	ticks -= age;
+	while(ticks < 0)
+	{
+		ticks += SYSTEMTIME_TICKS_PER_MS;
+		millis--;
+	}
+	// the edge starts the millisecond tick nearest to it
+	if(ticks >= SYSTEMTIME_TICKS_PER_MS/2)
+	{
+		ticks -= SYSTEMTIME_TICKS_PER_MS;
+		millis++;
+	}
+
+	if(Pps.edges && (uint32_t)(millis - Pps.edgeMillis - 999) <= 2)
+	{
+		if(Pps.count < 0xFF)
+			Pps.count++;
+		// the phase left after a full correction is the oscillator drift,
+		// correct it in advance from now on
+		Pps.drift += ticks;
+		if(Pps.drift > PPS_MAX_DRIFT || Pps.drift < -PPS_MAX_DRIFT)
+			Pps.drift = 0;
+	}
+	else
+	{
+		Pps.count = 0;
+		Pps.drift = 0;
+	}
+
+	// move the millisecond tick onto the edge
+	systemTimeAdjustPhase(ticks + Pps.drift);
+	Pps.prevEdgeMillis = Pps.edgeMillis;
+	Pps.edgeMillis = millis;
+	Pps.phase = ticks;
+	Pps.edges++;
+}
+
+void ppsGetState(PpsType* pps)
+{
+	// the capture interrupt updates the state
+	cli();
+	*pps = Pps;
+	sei();
+}
+
+uint8_t ppsIsLocked(void)
+{
+	PpsType pps;
+
+	ppsGetState(&pps);
+	return (pps.count >= PPS_LOCK_COUNT &&
+			(systemTimeGetMilliseconds() - pps.edgeMillis) < PPS_TIMEOUT_MS);
+}
+
+time_t ppsGetTimeAt(uint32_t* millis)
+{
+	GpsInfoType* info = gpsGetInfo();
+	PpsType pps;
+	uint32_t gpsMillis;
+	time_t t;
+
+	if(!ppsIsLocked())
+		return 0;
+	// only a sentence about a whole second belongs to an edge
+	t = gpsGetTimeAt(&gpsMillis);
+	if(t == 0 || info->UtcTime.millis != 0)
+		return 0;
+
+	// the sentence arrives within the second that started at its edge,
+	// it is either the last edge or, if the next one came already,
+	// the one before
+	ppsGetState(&pps);
+	if((info->validTimeReceivedMillis - pps.edgeMillis) < 1000)
+		*millis = pps.edgeMillis;
+	else if((info->validTimeReceivedMillis - pps.prevEdgeMillis) < 1000)
+		*millis = pps.prevEdgeMillis;
+	else
+		return 0;
+	return t;
+}
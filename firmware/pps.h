@@ -0,0 +1,55 @@
+/*! \file pps.h \brief GPS pulse per second time discipline. */
+//*****************************************************************************
+//
+// File Name	: 'pps.h'
+// Title		: GPS pulse per second time discipline
+// Target MCU	: Atmel AVR Series
+// Editor Tabs	: 4
+//
+///	\ingroup driver_hw
+/// \defgroup pps PPS Input Capture Time Discipline (pps.c)
+/// \code #include "pps.h" \endcode
+/// \par Overview
+///		The 1PPS output of the GPS receiver is connected to ICP1 (PD4).
+/// Timer1 captures every rising edge, the edge is converted to system time
+/// with timer tick resolution and the millisecond tick of systemtime.c is
+/// slewed so that it coincides with the edge.  The next sentence with a
+/// whole second names the second the edge started, ppsGetTimeAt() hands
+/// both to the sync service.
+//
+// This code is distributed under the GNU Public License
+//		which can be found at http://www.gnu.org/licenses/gpl.txt
+//
+//*****************************************************************************
+
+#ifndef PPS_H
+#define PPS_H
+
+#include "global.h"
+#include "time.h"
+
+// constants/macros/typdefs
+#define PPS_LOCK_COUNT		3		///< edges one second apart needed before the time is used
+#define PPS_TIMEOUT_MS		1500	///< edge considered lost after this time
+#define PPS_MAX_DRIFT		250		///< oscillator error accepted, in timer ticks per second (1000ppm)
+#define PPS_DISPERSION_MS	1		///< error of a locked edge, the millisecond tick resolution
+
+//! PPS edge history, written by the capture interrupt
+typedef struct struct_Pps
+{
+	uint32_t edgeMillis;		///< system time of the last edge
+	uint32_t prevEdgeMillis;	///< system time of the edge before
+	int16_t phase;				///< last edge position relative to the millisecond tick in timer ticks
+	int16_t drift;				///< ticks per second the oscillator loses against the edges
+	uint8_t count;				///< consecutive edges one second apart
+	uint16_t edges;				///< number of edges captured
+} PpsType;
+
+// functions
+void ppsInit(void);
+void ppsCapture(void);
+void ppsGetState(PpsType* pps);
+uint8_t ppsIsLocked(void);
+time_t ppsGetTimeAt(uint32_t* millis);
+
+#endif
@@ -0,0 +1,124 @@
+/*! \file ring.c \brief Single producer, single consumer byte ring. */
+//*****************************************************************************
+//
+// File Name	: 'ring.c'
+// Title		: Single producer, single consumer byte ring
+// Target MCU	: any
+// Editor Tabs	: 4
+//
+// This code is distributed under the GNU Public License
+//		which can be found at http://www.gnu.org/licenses/gpl.txt
+//
+//*****************************************************************************
+
+#include "ring.h"
+#include "global.h"
+
+// keep the compiler from moving data accesses across head/tail updates
+#define RING_BARRIER	__asm__ __volatile__ ("" ::: "memory")
+
+// initialization
+
+void ringInit(ringBuffer* ring, uint8_t *start, uint8_t size)
+{
+	// set start pointer and wrap mask of the ring
+	ring->dataptr = start;
+	ring->mask = size-1;
+	// initialize indices
+	ring->head = 0;
+	ring->tail = 0;
+}
+
+// producer side
+
+uint8_t ringAddToEnd(ringBuffer* ring, uint8_t data)
+{
+	uint8_t head = ring->head;
+
+	// make sure the ring has room
+	if((uint8_t)(head - ring->tail) > ring->mask)
+		return 0;
+	// store the byte before the consumer can see it
+	ring->dataptr[head & ring->mask] = data;
+	RING_BARRIER;
+	ring->head = head+1;
+	// return success
+	return -1;
+}
+
+uint8_t ringIsNotFull(ringBuffer* ring)
+{
+	return ring->mask+1 - (uint8_t)(ring->head - ring->tail);
+}
+
+// consumer side
+
+uint8_t ringGetFromFront(ringBuffer* ring)
+{
+	uint8_t tail = ring->tail;
+	uint8_t data = 0;
+
+	// check to see if there's data in the ring
+	if(ring->head != tail)
+	{
+		// read the byte before the producer may overwrite it
+		data = ring->dataptr[tail & ring->mask];
+		RING_BARRIER;
+		ring->tail = tail+1;
+	}
+	return data;
+}
+
+uint8_t ringGetAtIndex(ringBuffer* ring, uint8_t index)
+{
+	// bytes in front of head are not touched by the producer
+	return ring->dataptr[(uint8_t)(ring->tail + index) & ring->mask];
+}
+
+uint8_t ringPeekSpans(ringBuffer* ring, ringSpans* spans)
+{
+	uint8_t tail = ring->tail;
+	// one look at head, later bytes are left for the next call
+	uint8_t length = ring->head - tail;
+	uint8_t start = tail & ring->mask;
+	uint8_t first = ring->mask+1 - start;
+
+	spans->data[0] = &ring->dataptr[start];
+	spans->data[1] = ring->dataptr;
+	if(length <= first)
+	{
+		spans->length[0] = length;
+		spans->length[1] = 0;
+	}
+	else
+	{
+		// data wraps around the end of the memory
+		spans->length[0] = first;
+		spans->length[1] = length - first;
+	}
+	return length;
+}
+
+void ringDumpFromFront(ringBuffer* ring, uint8_t numbytes)
+{
+	uint8_t length = ring->head - ring->tail;
+
+	// never move tail past head
+	if(numbytes > length)
+		numbytes = length;
+	RING_BARRIER;
+	ring->tail += numbytes;
+}
+
+void ringFlush(ringBuffer* ring)
+{
+	// drop everything the producer has added so far
+	ring->tail = ring->head;
+}
+
+// either side
+
+uint8_t ringGetDataLength(ringBuffer* ring)
+{
+	return ring->head - ring->tail;
+}
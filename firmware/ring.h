@@ -0,0 +1,87 @@
+/*! \file ring.h \brief Single producer, single consumer byte ring. */
+//*****************************************************************************
+//
+// File Name	: 'ring.h'
+// Title		: Single producer, single consumer byte ring
+// Target MCU	: any
+// Editor Tabs	: 4
+//
+///	\ingroup general
+/// \defgroup ring Lock-free Byte Ring Structure and Function Library (ring.c)
+/// \code #include "ring.h" \endcode
+/// \par Overview
+///		A FIFO byte ring for one producer and one consumer, typically an
+///	interrupt handler on one side and the main loop on the other.  Unlike
+///	the cBuffer it replaced it needs no critical sections: the producer only
+///	writes head, the consumer only writes tail, and both are single bytes
+///	that the AVR reads and writes in one instruction.  head and tail run
+///	freely, their difference is the number of bytes in the ring, and the
+///	position in memory is taken with a mask instead of a division.
+///	\par
+///		The size must be a power of two and at most 128 bytes, use
+///	RING_SIZE_CHECK() next to the storage to verify that at compile time.
+//
+// This code is distributed under the GNU Public License
+//		which can be found at http://www.gnu.org/licenses/gpl.txt
+//
+//*****************************************************************************
+//@{
+
+#ifndef RING_H
+#define RING_H
+
+#include <stdint.h>
+
+// structure/typdefs
+
+//! ringBuffer structure
+typedef struct struct_ringBuffer
+{
+	uint8_t *dataptr;			///< the physical memory address where the ring is stored
+	uint8_t mask;				///< the allocated size of the ring minus one
+	volatile uint8_t head;		///< number of bytes added, written by the producer only
+	volatile uint8_t tail;		///< number of bytes removed, written by the consumer only
+} ringBuffer;
+
+//! ringSpans structure, the data of a ring as contiguous memory regions
+typedef struct struct_ringSpans
+{
+	uint8_t *data[2];			///< start of the data before and after the wrap
+	uint8_t length[2];			///< bytes in each region, the second one may be empty
+} ringSpans;
+
+//! fail the build if size is not a power of two between 2 and 128
+#define RING_SIZE_CHECK(size)	typedef char ringSizeCheck##size[((size) >= 2 && (size) <= 128 && !((size) & ((size)-1))) ? 1 : -1]
+
+// function prototypes
+
+//! initialize a ring to start at a given address and have given size
+void ringInit(ringBuffer* ring, uint8_t *start, uint8_t size);
+
+// producer side
+//! add a byte to the end of the ring, returns zero if the ring is full
+uint8_t	ringAddToEnd(ringBuffer* ring, uint8_t data);
+//! get the number of free bytes in the ring (returns zero value if full)
+uint8_t ringIsNotFull(ringBuffer* ring);
+
+// consumer side
+//! get the first byte from the front of the ring
+uint8_t	ringGetFromFront(ringBuffer* ring);
+//! get a byte at the specified offset from the front without removing it
+uint8_t	ringGetAtIndex(ringBuffer* ring, uint8_t index);
+//! get the data as up to two contiguous regions, returns the total length
+// ** note: the regions stay valid until they are dumped, so they can be
+// scanned with memchr() or in a tight loop and released in one step
+// with ringDumpFromFront()
+uint8_t ringPeekSpans(ringBuffer* ring, ringSpans* spans);
+//! dump (discard) the first numbytes from the front of the ring
+void ringDumpFromFront(ringBuffer* ring, uint8_t numbytes);
+//! flush (clear) the contents of the ring
+void ringFlush(ringBuffer* ring);
+
+// either side
+//! get the number of bytes currently in the ring
+uint8_t ringGetDataLength(ringBuffer* ring);
+
+#endif
+//@}
@@ -1,4 +1,5 @@
 #include "time.h"
+#include "systemtime.h"
 #include "ds1307.h"
 #include "rtc.h"
 
@@ -19,6 +20,13 @@ time_t rtcGetTime(void)
 	return timeMake(el);
 }
 
+time_t rtcGetTimeAt(uint32_t* millis)
+{
+	// the second started at most RTC_DISPERSION_MS before
+	*millis = systemTimeGetMilliseconds();
+	return rtcGetTime();
+}
+
 void rtcSetTime(time_t time)
 {
 	tmElements_t el;
@@ -29,6 +37,4 @@ void rtcSetTime(time_t time)
 	ds1307SetDate(el.Day);
 	ds1307SetMonth(el.Month);
 	ds1307SetYear(el.Year - 30);
-
-	timeSetTime(time);
 }
\ No newline at end of file
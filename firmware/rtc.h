@@ -3,8 +3,12 @@
 
 #include "global.h"
 
+// whole seconds only, the phase of the RTC is not known
+#define RTC_DISPERSION_MS	1000
+
 void rtcInit(void);
 time_t rtcGetTime(void);
+time_t rtcGetTimeAt(uint32_t* millis);
 void rtcSetTime(time_t time);
 
 #endif
\ No newline at end of file
@@ -12,62 +12,264 @@
 typedef struct
 {
 	uint32_t interval;
-
+	uint32_t lastMillis;		// system time of the last run
+	uint8_t started;			// run at least once
+	uint8_t sources;			// registered sources
+	time_t clockTime;			// the clock at sysMillis, readings are compared with it
+	uint16_t clockMillis;
+	uint32_t sysMillis;
+	uint8_t reference;			// clockTime is set for this run
 } syncservice_t;
 
 syncservice_t syncservice;
+syncSource_t syncSources[SYNCSERVICE_SOURCES];
+syncState_t syncState;
 
 static setExternalTime syncReceiverPtr;
-static getExternalTime syncProviderHighPtr;
-static getExternalTime syncProviderLowPtr;
 
 
 void timeSyncServiceInit(void)
 {
 	LED_GREEN_CONFIG;
+	syncState.state = SYNC_UNSYNCED;
+	syncState.source = SYNCSERVICE_SOURCES;
 }
 
 void timeSyncServiceProcess(void)
 {
-	static uint32_t lastTimeSynced = 0;
-	if(systemTimeGetMilliseconds() - lastTimeSynced < syncservice.interval)
+	time_t t[SYNCSERVICE_SOURCES];
+	uint32_t millis[SYNCSERVICE_SOURCES];
+	uint16_t clockMillis;
+	syncSource_t clock;
+	syncSource_t* source;
+	uint8_t outliers = 0;
+	uint8_t others;
+	uint8_t agreed;
+	uint8_t best;
+	uint8_t i, j;
+
+	// once every syncinterval, the first run right away, the sources
+	// are not polled faster before the clock is set either
+	if(syncservice.started &&
+	   systemTimeGetMilliseconds() - syncservice.lastMillis < syncservice.interval)
 		return;
+	syncservice.lastMillis = systemTimeGetMilliseconds();
+	syncservice.started = TRUE;
+
+	timeSyncServiceGrow();
+
+	syncservice.clockTime = timeNowPrecise(&clockMillis);
+	syncservice.clockMillis = clockMillis;
+	syncservice.sysMillis = systemTimeGetMilliseconds();
+	// unsynced the clock may be years off and all offsets would be
+	// clipped alike and agree, the first reading is compared with then
+	syncservice.reference = (syncState.state != SYNC_UNSYNCED);
+	for(i=0; i<syncservice.sources; i++)
+		timeSyncServiceSample(&syncSources[i], &t[i], &millis[i]);
 
-	if(syncReceiverPtr != 0)
+	// once it is set the clock votes as well, with what it may be off by now
+	clock.offset = 0;
+	clock.dispersion = (syncState.uncertainty < 0xFFFF*1000UL) ? syncState.uncertainty/1000 : 0xFFFF;
+
+	// a reading that agrees with nothing else is not believed, only the
+	// clock and sources at least as good vote, a coarse source must not
+	// keep a better one out
+	for(i=0; i<syncservice.sources; i++)
 	{
-		if(syncProviderHighPtr != 0)
+		if(syncSources[i].status == SYNC_SOURCE_NONE)
+			continue;
+		others = 0;
+		agreed = FALSE;
+		if(syncState.state != SYNC_UNSYNCED)
+		{
+			others++;
+			agreed = timeSyncServiceAgree(&syncSources[i], &clock);
+		}
+		for(j=0; j<syncservice.sources; j++)
 		{
-			time_t t = syncProviderHighPtr();
-			if(t != 0)
-			{
-				syncReceiverPtr(t);
-				timeSetTime(t);
-				LED_GREEN_ON;
-			}
-			else
-			{
-				LED_GREEN_OFF;
-			}
+			if(j == i || syncSources[j].status == SYNC_SOURCE_NONE ||
+			   syncSources[j].dispersion > syncSources[i].dispersion)
+				continue;
+			others++;
+			if(timeSyncServiceAgree(&syncSources[i], &syncSources[j]))
+				agreed = TRUE;
 		}
-		//else if(syncProviderLowPtr != 0)
-		//{
-			//time_t t = syncProviderLowPtr();
-			//if(t != 0)
-			//{
-				//syncReceiverPtr(t);
-				//timeSetTime(t);
-				//lastTimeSynced = systemTimeGetMilliseconds();
-			//}
-		//}
+		if(others && !agreed)
+			outliers |= 1<<i;
+	}
+
+	for(i=0; i<syncservice.sources; i++)
+	{
+		source = &syncSources[i];
+		source->reach <<= 1;
+		if(source->status == SYNC_SOURCE_NONE)
+			continue;
+		if(outliers & (1<<i))
+		{
+			source->status = SYNC_SOURCE_OUTLIER;
+			source->rejected++;
+			if(source->outlierRuns < 0xFF)
+				source->outlierRuns++;
+			continue;
+		}
+		source->outlierRuns = 0;
+		source->reach |= 1;
+		source->lastMillis = syncservice.sysMillis;
+	}
+
+	// a source only takes over if it is better than the running clock,
+	// or if it kept disagreeing with it, then the clock itself is wrong
+	best = timeSyncServiceSelect();
+	if(best < syncservice.sources &&
+	   (syncState.state == SYNC_UNSYNCED || syncSources[best].status == SYNC_SOURCE_OUTLIER ||
+	    syncSources[best].dispersion*1000UL < syncState.uncertainty))
+	{
+		source = &syncSources[best];
+		// the provider tells when its second started, so the
+		// time it took to get here does not delay the clock. A coarse
+		// source that agrees with the clock only vouches for it, the
+		// whole seconds of the rtc would move the phase by up to one
+		// each interval once the holdover uncertainty exceeds the rtc's
+		if(syncState.state == SYNC_UNSYNCED || source->dispersion < SYNCSERVICE_RECEIVER_MS ||
+		   source->offset > (int32_t)source->dispersion || source->offset < -(int32_t)source->dispersion)
+			timeSetTimeAt(t[best], millis[best]);
+		// the receiver only stores the time, the phase set above stays
+		// with the system time, a coarse source would spoil a good receiver
+		if(syncReceiverPtr != 0 && source->dispersion < SYNCSERVICE_RECEIVER_MS)
+			syncReceiverPtr(timeNow());
+		syncState.uncertainty = source->dispersion*1000UL;
+		source->status = SYNC_SOURCE_SELECTED;
+		source->selected++;
+		timeSyncServiceSetState(SYNC_LOCKED, best);
+	}
+	else if(syncState.state != SYNC_UNSYNCED)
+	{
+		timeSyncServiceSetState((syncState.uncertainty < SYNCSERVICE_HOLDOVER_MS*1000UL) ? SYNC_HOLDOVER : SYNC_LOST, syncState.source);
 	}
 
-	// only do it once every syncinterval
-	lastTimeSynced = systemTimeGetMilliseconds();
+	if(syncState.state == SYNC_LOCKED)
+		LED_GREEN_ON;
+	else
+		LED_GREEN_OFF;
+}
+
+void timeSyncServiceSample(syncSource_t* source, time_t* t, uint32_t* millis)
+{
+	int32_t seconds;
+	int32_t offset;
+	uint32_t age;
+
+	*t = source->get(millis);
+	if(*t == 0)
+	{
+		source->status = SYNC_SOURCE_NONE;
+		return;
+	}
+	source->status = SYNC_SOURCE_CANDIDATE;
+
+	if(!syncservice.reference)
+	{
+		// the reading moved on to sysMillis, its offset is 0
+		age = syncservice.sysMillis - *millis;
+		syncservice.clockTime = *t + age/1000;
+		syncservice.clockMillis = age%1000;
+		syncservice.reference = TRUE;
+	}
+
+	// ms the source is ahead of the clock at the start of its second,
+	// clipped so that the differences of two offsets still fit
+	seconds = *t - syncservice.clockTime;
+	if(seconds > SYNCSERVICE_OFFSET_LIMIT/1000)
+		offset = SYNCSERVICE_OFFSET_LIMIT;
+	else if(seconds < -SYNCSERVICE_OFFSET_LIMIT/1000)
+		offset = -SYNCSERVICE_OFFSET_LIMIT;
+	else
+		offset = seconds*1000 - syncservice.clockMillis - (int32_t)(*millis - syncservice.sysMillis);
+	if(offset > SYNCSERVICE_OFFSET_LIMIT)
+		offset = SYNCSERVICE_OFFSET_LIMIT;
+	else if(offset < -SYNCSERVICE_OFFSET_LIMIT)
+		offset = -SYNCSERVICE_OFFSET_LIMIT;
+	source->offset = offset;
+}
+
+uint8_t timeSyncServiceAgree(syncSource_t* a, syncSource_t* b)
+{
+	int32_t difference = a->offset - b->offset;
+
+	if(difference < 0)
+		difference = -difference;
+	return difference <= (int32_t)a->dispersion + b->dispersion + SYNCSERVICE_MARGIN_MS;
+}
+
+uint8_t timeSyncServiceSelect(void)
+{
+	uint8_t best = SYNCSERVICE_SOURCES;
+	uint8_t i;
+
+	// lowest dispersion first, a source reached more often breaks a tie
+	for(i=0; i<syncservice.sources; i++)
+	{
+		if(syncSources[i].status != SYNC_SOURCE_CANDIDATE)
+			continue;
+		if(best == SYNCSERVICE_SOURCES ||
+		   syncSources[i].dispersion < syncSources[best].dispersion ||
+		   (syncSources[i].dispersion == syncSources[best].dispersion && syncSources[i].reach > syncSources[best].reach))
+			best = i;
+	}
+
+	// a source that kept disagreeing for SYNCSERVICE_OUTLIER_RUNS is more
+	// likely right than the clock and the coarser sources that follow it,
+	// e.g. after settime, which writes the rtc as well, or a wrong rtc
+	// that set the clock before the receiver had the time. Alone it
+	// has to be better than the clock
+	for(i=0; i<syncservice.sources; i++)
+	{
+		if(syncSources[i].status != SYNC_SOURCE_OUTLIER || syncSources[i].outlierRuns < SYNCSERVICE_OUTLIER_RUNS)
+			continue;
+		if(best < SYNCSERVICE_SOURCES ?
+		   syncSources[i].dispersion < syncSources[best].dispersion :
+		   syncSources[i].dispersion*1000UL < syncState.uncertainty)
+			best = i;
+	}
+	return best;
+}
+
+void timeSyncServiceGrow(void)
+{
+	uint32_t now = systemTimeGetMilliseconds();
+	uint32_t growth;
+
+	// the free running clock is off by up to SYNCSERVICE_DRIFT_PPM,
+	// the intervals are short enough for the product to fit
+	growth = (now - syncState.uncertaintyMillis) * SYNCSERVICE_DRIFT_PPM / 1000;
+	syncState.uncertaintyMillis = now;
+	if(syncState.state == SYNC_UNSYNCED)
+		return;
+	if(syncState.uncertainty + growth < syncState.uncertainty)
+		syncState.uncertainty = 0xFFFFFFFF;
+	else
+		syncState.uncertainty += growth;
+}
+
+void timeSyncServiceSetState(uint8_t state, uint8_t source)
+{
+	syncTransition_t* entry;
+
+	if(state == syncState.state && source == syncState.source)
+		return;
+	entry = &syncState.log[syncState.transitions % SYNCSERVICE_LOG];
+	entry->time = timeNow();
+	entry->from = syncState.state;
+	entry->to = state;
+	entry->source = source;
+	syncState.transitions++;
+	syncState.state = state;
+	syncState.source = source;
 }
 
 void timeSyncServiceSetInterval(uint16_t interval)
 {
-	syncservice.interval = interval * 1000;
+	syncservice.interval = interval * 1000UL;
 }
 
 void timeSyncServiceSetSyncReceiver(setExternalTime setTimeFunction)
@@ -75,12 +277,32 @@ void timeSyncServiceSetSyncReceiver(setExternalTime setTimeFunction)
 	syncReceiverPtr = setTimeFunction;
 }
 
-void timeSyncServiceSetSyncProviderHighValidity(getExternalTime getTimeFunction)
+uint8_t timeSyncServiceAddSource(const char* name, getExternalTimeAt getTimeFunction, uint16_t dispersion)
+{
+	syncSource_t* source;
+
+	if(syncservice.sources >= SYNCSERVICE_SOURCES)
+		return FALSE;
+	source = &syncSources[syncservice.sources];
+	source->name = name;
+	source->get = getTimeFunction;
+	source->dispersion = dispersion;
+	source->status = SYNC_SOURCE_NONE;
+	syncservice.sources++;
+	return TRUE;
+}
+
+uint8_t timeSyncServiceGetSources(void)
 {
-	syncProviderHighPtr = getTimeFunction;
+	return syncservice.sources;
 }
 
-void timeSyncServiceSetSyncProviderLowValidity(getExternalTime getTimeFunction)
+syncSource_t* timeSyncServiceGetSource(uint8_t index)
 {
-	syncProviderLowPtr = getTimeFunction;
-}
\ No newline at end of file
+	return &syncSources[index];
+}
+
+syncState_t* timeSyncServiceGetState(void)
+{
+	return &syncState;
+}
@@ -3,14 +3,76 @@
 
 #include "global.h"
 
+#define SYNCSERVICE_SOURCES			5		// providers that can be registered
+#define SYNCSERVICE_LOG				8		// state transitions kept for the cmdline
+#define SYNCSERVICE_MARGIN_MS		20		// disagreement accepted on top of the dispersions
+#define SYNCSERVICE_OUTLIER_RUNS	3		// intervals a better source is rejected before it overrides the clock
+#define SYNCSERVICE_DRIFT_PPM		50		// assumed error of the free running clock
+#define SYNCSERVICE_HOLDOVER_MS		1000	// uncertainty at which the holdover is given up
+#define SYNCSERVICE_RECEIVER_MS		500		// dispersion a source needs to set the receiver
+#define SYNCSERVICE_OFFSET_LIMIT	1000000000L	// offsets are clipped to this many ms
+
+// Sync states
+#define SYNC_UNSYNCED			0		// no source has set the clock yet
+#define SYNC_LOCKED				1		// the clock follows the selected source
+#define SYNC_HOLDOVER			2		// no better source, the clock runs free
+#define SYNC_LOST				3		// the holdover uncertainty grew too large
+
+// Source states of the last interval
+#define SYNC_SOURCE_NONE		0		// no time
+#define SYNC_SOURCE_CANDIDATE	1		// agrees, but was not selected
+#define SYNC_SOURCE_SELECTED	2		// set the clock
+#define SYNC_SOURCE_OUTLIER		3		// agrees with neither the clock nor an as good source
+
 typedef void (*setExternalTime)(time_t t);
 typedef time_t (*getExternalTime)(void);
+typedef time_t (*getExternalTimeAt)(uint32_t* millis);
+
+// Registered time provider and what its last answers looked like
+typedef struct
+{
+	const char* name;			// in program memory
+	getExternalTimeAt get;		// time and the system time its second started, 0 if none
+	uint16_t dispersion;		// ms a reading may be off, lower is better
+	uint8_t status;				// SYNC_SOURCE_*
+	uint8_t reach;				// one bit per interval, set for a good reading
+	uint8_t outlierRuns;		// intervals in a row as an outlier
+	int32_t offset;				// ms the source was ahead of the clock, of the first reading while unsynced
+	uint32_t lastMillis;		// system time of the last good reading
+	uint16_t selected;			// intervals the source set the clock
+	uint16_t rejected;			// intervals the source was an outlier
+} syncSource_t;
+
+typedef struct
+{
+	time_t time;		// clock time of the transition
+	uint8_t from;		// SYNC_* states
+	uint8_t to;
+	uint8_t source;		// selected source, SYNCSERVICE_SOURCES if none
+} syncTransition_t;
+
+typedef struct
+{
+	uint8_t state;				// SYNC_*
+	uint8_t source;				// source that set the clock last, SYNCSERVICE_SOURCES if none
+	uint32_t uncertainty;		// us the clock may be off
+	uint32_t uncertaintyMillis;	// system time the uncertainty was last grown
+	uint16_t transitions;		// state changes since start-up
+	syncTransition_t log[SYNCSERVICE_LOG];	// the last transitions, oldest overwritten
+} syncState_t;
 
 void timeSyncServiceInit(void);
 void timeSyncServiceProcess(void);
 void timeSyncServiceSetInterval(uint16_t interval);
 void timeSyncServiceSetSyncReceiver(setExternalTime setTimeFunction);
-void timeSyncServiceSetSyncProviderHighValidity(getExternalTime getTimeFunction);
-void timeSyncServiceSetSyncProviderLowValidity(getExternalTime getTimeFunction);
+uint8_t timeSyncServiceAddSource(const char* name, getExternalTimeAt getTimeFunction, uint16_t dispersion);
+void timeSyncServiceSample(syncSource_t* source, time_t* t, uint32_t* millis);
+uint8_t timeSyncServiceAgree(syncSource_t* a, syncSource_t* b);
+uint8_t timeSyncServiceSelect(void);
+void timeSyncServiceGrow(void);
+void timeSyncServiceSetState(uint8_t state, uint8_t source);
+uint8_t timeSyncServiceGetSources(void);
+syncSource_t* timeSyncServiceGetSource(uint8_t index);
+syncState_t* timeSyncServiceGetState(void);
 
-#endif
\ No newline at end of file
+#endif
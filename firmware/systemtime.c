@@ -4,27 +4,85 @@
 #include "systemtime.h"
 
 volatile uint32_t milliseconds;
+volatile int16_t phaseSlew;
 
 void systemTimeInit(void)
 {
 	cli();
 	milliseconds = 0;
+	phaseSlew = 0;
 	timer3Init();
 	timer3SetMode(TIMER_MODE_CTC_OCR);
 	timer3SetOutputModeA(TIMER_OUTMODE_TOGGLE);
-	timer3SetCompareValueA(249);
-	timerAttach(TIMER3OUTCOMPAREA_INT, systemTimeMillisecondsTick);
+	timer3SetCompareValueA(SYSTEMTIME_TICKS_PER_MS-1);
 	sei();
 }
 
-void systemTimeMillisecondsTick(void)
+// dedicated handler instead of the timerAttach() dispatch: no indirect
+// call, so only the registers used here are saved, and interrupts stay
+// disabled by the hardware until it returns
+ISR(TIMER3_COMPA_vect)
 {
-	cli();
+	int16_t slew = phaseSlew;
+
 	milliseconds++;
-	sei();
+	// shift the phase by one timer tick per millisecond,
+	// the new compare value applies to the period just started
+	if(slew > 0)
+	{
+		OCR3A = SYSTEMTIME_TICKS_PER_MS;
+		phaseSlew = slew - 1;
+	}
+	else if(slew < 0)
+	{
+		OCR3A = SYSTEMTIME_TICKS_PER_MS-2;
+		phaseSlew = slew + 1;
+	}
+	else
+		OCR3A = SYSTEMTIME_TICKS_PER_MS-1;
 }
 
 uint32_t systemTimeGetMilliseconds(void)
 {
-	return milliseconds;
+	uint32_t ms;
+	uint8_t sreg = SREG;
+
+	// the 4 byte load must not be split by the tick,
+	// restore the interrupt state, interrupt handlers call this too
+	cli();
+	ms = milliseconds;
+	SREG = sreg;
+	return ms;
+}
+
+// system time in timer ticks, for measuring short durations
+uint32_t systemTimeGetTicks(void)
+{
+	uint32_t ms;
+	uint16_t ticks;
+	uint8_t sreg = SREG;
+
+	cli();
+	ms = milliseconds;
+	ticks = TCNT3;
+	// a compare match that is not serviced yet already ended the millisecond
+	if((TIFR3 & (1<<OCF3A)) && ticks < SYSTEMTIME_TICKS_PER_MS/2)
+		ms++;
+	SREG = sreg;
+	return ms*SYSTEMTIME_TICKS_PER_MS + ticks;
+}
+
+// system time in microseconds, wraps after about 71 minutes
+uint32_t systemTimeGetMicros(void)
+{
+	// the tick count wraps at a multiple of 2^32/SYSTEMTIME_US_PER_TICK,
+	// so the product wraps consistently
+	return systemTimeGetTicks() * SYSTEMTIME_US_PER_TICK;
+}
+
+// delay (ticks > 0) or advance (ticks < 0) the millisecond tick,
+// called from the PPS capture interrupt
+void systemTimeAdjustPhase(int16_t ticks)
+{
+	phaseSlew = ticks;
 }
\ No newline at end of file
@@ -3,8 +3,15 @@
 
 #include "global.h"
 
+// timer3 ticks per millisecond (F_CPU/64)
+#define SYSTEMTIME_TICKS_PER_MS		(F_CPU/64/1000)
+// microseconds per timer3 tick
+#define SYSTEMTIME_US_PER_TICK		(64000000UL/F_CPU)
+
 void systemTimeInit(void);
-void systemTimeMillisecondsTick(void);
 uint32_t systemTimeGetMilliseconds(void);
+uint32_t systemTimeGetTicks(void);
+uint32_t systemTimeGetMicros(void);
+void systemTimeAdjustPhase(int16_t ticks);
 
 #endif
\ No newline at end of file
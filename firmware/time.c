@@ -42,11 +42,95 @@ void timeInit(void)
 void timeRefreshCache( time_t t)
 {
 	static time_t cacheTime;   // the time the cache was updated
-	if( t != cacheTime )
-	{
+	static uint8_t cacheValid; // the cache holds cacheTime
+	time_t delta = t - cacheTime;
+
+	if( cacheValid && delta == 0 )
+		return;
+	// the clock normally moves on by a second at a time,
+	// roll the elements forward instead of breaking t up again
+	if( cacheValid && delta < SECS_PER_MIN )
+		timeAdvance(&tm, delta);
+	else
 		timeBreak(t, &tm);
-		cacheTime = t;
+	cacheTime = t;
+	cacheValid = TRUE;
+}
+
+void timeAdvance(tmElements_t* el, uint8_t seconds)
+{
+	// seconds must be less than a minute, so there is at most one carry
+	el->Second += seconds;
+	if( el->Second < 60 )
+		return;
+	el->Second -= 60;
+	if( ++el->Minute < 60 )
+		return;
+	el->Minute = 0;
+	if( ++el->Hour < 24 )
+		return;
+	el->Hour = 0;
+	timeNextDay(el);
+}
+
+void timeShift(tmElements_t* el, int16_t minutes)
+{
+	// zone offsets stay below a day, so the date moves by one day at most
+	int16_t minute = el->Hour * 60 + el->Minute + minutes;
+
+	if( minute < 0 )
+	{
+		minute += MINS_PER_DAY;
+		timePreviousDay(el);
+	}
+	else if( minute >= MINS_PER_DAY )
+	{
+		minute -= MINS_PER_DAY;
+		timeNextDay(el);
+	}
+	el->Hour = minute / 60;
+	el->Minute = minute % 60;
+}
+
+void timeNextDay(tmElements_t* el)
+{
+	el->Wday = (el->Wday % 7) + 1;
+	if( ++el->Day <= timeMonthLength(el->Month, el->Year) )
+		return;
+	el->Day = 1;
+	if( ++el->Month <= 12 )
+		return;
+	el->Month = 1;
+	el->Year++;
+}
+
+void timePreviousDay(tmElements_t* el)
+{
+	el->Wday = ((el->Wday + 5) % 7) + 1;
+	if( --el->Day > 0 )
+		return;
+	if( --el->Month == 0 )
+	{
+		el->Month = 12;
+		el->Year--;
 	}
+	el->Day = timeMonthLength(el->Month, el->Year);
+}
+
+uint8_t timeMonthLength(uint8_t month, uint8_t year)
+{
+	// year is offset from 1970, 2100 is the only century in the time_t range
+	if( month == 2 )
+		return ( ((year+2) % 4) == 0 && year != CalendarYrToTm(2100) ) ? 29 : 28;
+	// 31 days up to July, then alternating from August on
+	return ( month < 8 ) ? 30 + (month & 1) : 31 - (month & 1);
+}
+
+void timeGetElements(time_t t, tmElements_t* el)
+{
+	// the cache rolls on with the clock, a copy is cheaper than timeBreak()
+	timeRefreshCache(t);
+	*el = tm;
 }
 
 uint8_t timeGetHour(time_t t)   // the hour for the given time
@@ -116,10 +200,13 @@ uint16_t timeGetYear(time_t t)   // the year for the given time
 /* functions to convert to and from system time */
 /* These are for interfacing with time serivces and are not normally needed in a sketch */
 
-// leap year calulator expects year argument as years offset from 1970
-#define LEAP_YEAR(Y)     ( ((1970+Y)>0) && !((1970+Y)%4) && ( ((1970+Y)%100) || !((1970+Y)%400) ) )
-
-static  const uint8_t monthDays[]= {31,28,31,30,31,30,31,31,30,31,30,31}; // API starts months from 1, this array starts from 0
+// Dates are counted in 4 year cycles from 1 March 1968, so the leap day
+// is the last day of a cycle and the month lengths repeat from March on.
+// 2100 is the only year in the time_t range that breaks the 4 year rule,
+// its missing leap day is skipped explicitly.
+#define CIVIL_EPOCH_DAYS	671		// days from 1 Mar 1968 to 1 Jan 1970
+#define CIVIL_DAYS_PER_4Y	1461	// days in a 4 year cycle
+#define CIVIL_DAYS_2100		48212	// days from 1 Mar 1968 to 1 Mar 2100
 
 void timeBreak(time_t time, tmElements_t* el)
 {
@@ -127,61 +214,44 @@ void timeBreak(time_t time, tmElements_t* el)
 // this is a more compact version of the C library localtime function
 // note that year is offset from 1970 !!!
 
+	uint16_t days;
+	uint16_t cycles;
 	uint8_t year;
-	uint8_t month, monthLength;
-	unsigned long days;
+	uint8_t month;
 
 	el->Second = time % 60;
 	time /= 60; // now it is minutes
 	el->Minute = time % 60;
 	time /= 60; // now it is hours
 	el->Hour = time % 24;
-	time /= 24; // now it is days
+	time /= 24; // now it is days, less than 2^16 in the time_t range
 	el->Wday = ((time + 4) % 7) + 1;  // Sunday is day 1
 
-	year = 0;
-	days = 0;
-	while((unsigned)(days += (LEAP_YEAR(year) ? 366 : 365)) <= time)
-	{
-		year++;
-	}
-	el->Year = year; // year is offset from 1970
-
-	days -= LEAP_YEAR(year) ? 366 : 365;
-	time  -= days; // now it is days in this year, starting at 0
-
-	days=0;
-	month=0;
-	monthLength=0;
-	for (month=0; month<12; month++)
+	days = time + CIVIL_EPOCH_DAYS;
+	// pretend 2100 has a 29 February
+	if(days >= CIVIL_DAYS_2100)
+		days++;
+	cycles = days / CIVIL_DAYS_PER_4Y;
+	days -= cycles * (uint16_t)CIVIL_DAYS_PER_4Y;
+	// the leap day at the end of a cycle belongs to the last year
+	year = days / 365;
+	if(year > 3)
+		year = 3;
+	days -= year * 365; // now it is days since 1 March, starting at 0
+
+	// months from March on have 31,30,31,30,31 days, twice,
+	// then January and February follow
+	month = (5*days + 2) / 153;
+	el->Day = days - (153*month + 2) / 5 + 1;
+	if(month < 10)
+		month += 3;
+	else
 	{
-		if (month==1)   // february
-		{
-			if (LEAP_YEAR(year))
-			{
-				monthLength=29;
-			}
-			else
-			{
-				monthLength=28;
-			}
-		}
-		else
-		{
-			monthLength = monthDays[month];
-		}
-
-		if (time >= monthLength)
-		{
-			time -= monthLength;
-		}
-		else
-		{
-			break;
-		}
+		month -= 9;
+		year++;   // January and February belong to the next year
 	}
-	el->Month = month + 1;  // jan is month 1
-	el->Day = time + 1;     // day of month
+	el->Month = month;  // jan is month 1
+	el->Year = cycles*4 + year - 2; // year is offset from 1970
 }
 
 time_t timeMake(tmElements_t el)
@@ -190,36 +260,26 @@ time_t timeMake(tmElements_t el)
 // note year argument is offset from 1970 (see macros in time.h to convert to other formats)
 // previous version used full four digit year (or digits since 2000),i.e. 2009 was 2009 or 9
 
-	int i;
-	time_t seconds;
+	uint8_t year;
+	uint8_t month;
+	uint16_t days;
 
-	// seconds from 1970 till 1 jan 00:00:00 of the given year
-	seconds= el.Year*(SECS_PER_DAY * 365);
-	for (i = 0; i < el.Year; i++)
+	// years and months counted from 1 March 1968, see timeBreak()
+	year = el.Year + 2;
+	if(el.Month > 2)
+		month = el.Month - 3;
+	else
 	{
-		if (LEAP_YEAR(i))
-		{
-			seconds +=  SECS_PER_DAY;   // add extra days for leap years
-		}
+		month = el.Month + 9;
+		year--;
 	}
+	days = (uint16_t)year*365 + year/4 + (153*month + 2)/5 + el.Day - 1;
+	// 2100 has no 29 February
+	if(days > CIVIL_DAYS_2100)
+		days--;
+	days -= CIVIL_EPOCH_DAYS;
 
-	// add days for this year, months start from 1
-	for (i = 1; i < el.Month; i++)
-	{
-		if ( (i == 2) && LEAP_YEAR(el.Year))
-		{
-			seconds += SECS_PER_DAY * 29;
-		}
-		else
-		{
-			seconds += SECS_PER_DAY * monthDays[i-1];  //monthDay array starts from 0
-		}
-	}
-	seconds+= (el.Day-1) * SECS_PER_DAY;
-	seconds+= el.Hour * SECS_PER_HOUR;
-	seconds+= el.Minute * SECS_PER_MIN;
-	seconds+= el.Second;
-	return seconds;
+	return days * SECS_PER_DAY + el.Hour * SECS_PER_HOUR + el.Minute * SECS_PER_MIN + el.Second;
 }
 /*=====================================================*/
 /* Low level system time functions  */
@@ -239,15 +299,36 @@ timesync_t timesync = {0,300,0,0,timeNotSet};
 getExternalTime getTimePtr;  // pointer to external sync function
 //setExternalTime setTimePtr; // not used in this version
 
+timeStall_t timestall;
+
 time_t timeNow(void)
 {
-	while( (int64_t)systemTimeGetMilliseconds() - (int64_t)timesync.prevMilliseconds >= 1000)
+	uint32_t now = systemTimeGetMilliseconds();
+	// wraps correctly, prevMilliseconds never lies far ahead of now
+	int32_t elapsed = now - timesync.prevMilliseconds;
+	uint32_t seconds;
+	uint32_t gap;
+
+	if( elapsed >= 1000 )
 	{
 		LED_RED_ON;
-		timesync.sysTime++;
-		timesync.prevMilliseconds += 1000;
+		// any backlog in one step, the division is rarely needed
+		seconds = (elapsed < 2000) ? 1 : (uint32_t)elapsed / 1000;
+		timesync.sysTime += seconds;
+		timesync.prevMilliseconds += seconds * 1000;
 		LED_RED_OFF;
 	}
+
+	gap = now - timestall.lastCall;
+	timestall.lastCall = now;
+	if( gap > timestall.maxGap )
+	{
+		timestall.maxGap = gap;
+		timestall.maxGapTime = timesync.sysTime;
+	}
+	if( gap >= 1000 )
+		timestall.longGaps++;
+
 	if(timesync.nextSyncTime <= timesync.sysTime)
 	{
 		if(getTimePtr != 0)
@@ -255,7 +336,11 @@ time_t timeNow(void)
 			time_t t = getTimePtr();
 			if(t != 0)
 			{
-				timeSetTime(t);
+				// a whole second source that agrees tells nothing about the phase
+				if(t == timesync.sysTime)
+					timeSetTimeAt(t, timesync.prevMilliseconds);
+				else
+					timeSetTime(t);
 			}
 			else
 				timesync.status = (timesync.status == timeNotSet) ?  timeNotSet : timeNeedsSync;
@@ -264,12 +349,44 @@ time_t timeNow(void)
 	return timesync.sysTime;
 }
 
+time_t timeNowPrecise(uint16_t* millis)
+{
+	time_t t;
+	int32_t elapsed;
+
+	// read again if the second ended between the two readings
+	do
+	{
+		t = timeNow();
+		elapsed = systemTimeGetMilliseconds() - timesync.prevMilliseconds;
+	} while(elapsed >= 1000);
+	*millis = (elapsed > 0) ? elapsed : 0;
+	return t;
+}
+
 void timeSetTime(time_t t)
 {
+	timeSetTimeAt(t, systemTimeGetMilliseconds());  // restart counting from now (thanks to Korman for this fix)
+}
+
+void timeSetTimeAt(time_t t, uint32_t millis)
+{
+	// millis may lie in the past, timeNow() catches up on the next call
+	// the main loop only asks for the time once it is set,
+	// the wait for the first sync is no stall
+	if(timesync.status == timeNotSet)
+		timestall.lastCall = systemTimeGetMilliseconds();
 	timesync.sysTime = t;
 	timesync.nextSyncTime = t + timesync.syncInterval;
 	timesync.status = timeSet;
-	timesync.prevMilliseconds = systemTimeGetMilliseconds();  // restart counting from now (thanks to Korman for this fix)
+	timesync.prevMilliseconds = millis;
+}
+
+void timeSetTimePrecise(time_t t, uint16_t millis)
+{
+	if(millis > 999)
+		millis = 999;
+	timeSetTimeAt(t, systemTimeGetMilliseconds() - millis);
 }
 
 /*
@@ -295,6 +412,19 @@ void timeAdjust(int32_t adjustment)
 	timesync.sysTime += adjustment;
 }
 
+timeStall_t* timeGetStall(void)
+{
+	return &timestall;
+}
+
+void timeResetStall(void)
+{
+	timestall.lastCall = systemTimeGetMilliseconds();
+	timestall.maxGap = 0;
+	timestall.maxGapTime = 0;
+	timestall.longGaps = 0;
+}
+
 timeStatus_t timeStatus(void)  // indicates if time has been set and recently synchronized
 {
 	return timesync.status;
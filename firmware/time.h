@@ -19,6 +19,15 @@ typedef enum
 	tmSecond, tmMinute, tmHour, tmWday, tmDay,tmMonth, tmYear, tmNbrFields
 } tmByteFields;
 
+//! Gaps between timeNow() calls, a long one means the main loop stalled
+typedef struct
+{
+	uint32_t lastCall;		// system millisecond of the last call
+	uint32_t maxGap;		// longest gap in ms
+	time_t maxGapTime;		// time the longest gap ended at
+	uint16_t longGaps;		// gaps of a second or more, the display missed a second
+} timeStall_t;
+
 typedef struct
 {
 	uint8_t Second;
@@ -45,6 +54,7 @@ typedef time_t(*getExternalTime)(void);
 #define SECS_PER_MIN  (60UL)
 #define SECS_PER_HOUR (3600UL)
 #define SECS_PER_DAY  (SECS_PER_HOUR * 24UL)
+#define MINS_PER_DAY  (1440)      // signed, zone offsets are negative too
 #define DAYS_PER_WEEK (7UL)
 #define SECS_PER_WEEK (SECS_PER_DAY * DAYS_PER_WEEK)
 #define SECS_PER_YEAR (SECS_PER_WEEK * 52UL)
@@ -88,8 +98,13 @@ uint8_t		timeGetMonth(time_t t);   // the month for the given time
 uint16_t	timeGetYear(time_t t);    // the year for the given time
 
 time_t  timeNow(void);              // return the current time as seconds since Jan 1 1970
+time_t  timeNowPrecise(uint16_t* millis); // as timeNow(), millis gets the milliseconds into the second
 void    timeSetTime(time_t t);
+void    timeSetTimeAt(time_t t, uint32_t millis); // t started at the given system millisecond
+void    timeSetTimePrecise(time_t t, uint16_t millis); // millis of second t have passed already
 void    timeAdjust(int32_t adjustment);
+timeStall_t* timeGetStall(void);    // gaps between timeNow() calls
+void    timeResetStall(void);
 
 /* date strings */
 /*
@@ -108,5 +123,11 @@ void    timeSetSyncInterval(time_t interval); // set the number of seconds betwe
 /* low level functions to convert to and from system time                     */
 void timeBreak(time_t time, tmElements_t* el);  // break time_t into elements
 time_t timeMake(tmElements_t el);  // convert time elements into time_t
+void timeAdvance(tmElements_t* el, uint8_t seconds);  // move elements on by less than a minute
+void timeShift(tmElements_t* el, int16_t minutes);  // move elements by a zone offset of less than a day
+void timeNextDay(tmElements_t* el);  // move the date of the elements on by a day
+void timePreviousDay(tmElements_t* el);  // move the date of the elements back by a day
+void timeGetElements(time_t t, tmElements_t* el);  // elements of t from the cache
+uint8_t timeMonthLength(uint8_t month, uint8_t year);  // days in month, year is offset from 1970
 
 #endif
\ No newline at end of file
@@ -940,6 +940,7 @@ TIMER_INTERRUPT_HANDLER(TIMER3_OVF_vect)
 		TimerIntFunc[TIMER3OVERFLOW_INT]();
 }
 
+#ifndef TIMER3_COMPA_HANDLER_EXTERNAL
 //! Interrupt handler for CutputCompare3A match (OC3A) interrupt
 TIMER_INTERRUPT_HANDLER(TIMER3_COMPA_vect)
 {
@@ -947,6 +948,7 @@ TIMER_INTERRUPT_HANDLER(TIMER3_COMPA_vect)
 	if(TimerIntFunc[TIMER3OUTCOMPAREA_INT])
 		TimerIntFunc[TIMER3OUTCOMPAREA_INT]();
 }
+#endif
 
 //! Interrupt handler for OutputCompare3B match (OC3B) interrupt
 TIMER_INTERRUPT_HANDLER(TIMER3_COMPB_vect)
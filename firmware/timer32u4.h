@@ -191,6 +191,10 @@
 #define TIMER_INTERRUPT_HANDLER		ISR
 #endif
 
+// OutputCompare3A drives the system time, systemtime.c has its own
+// interrupt handler for it and timerAttach() does not apply
+#define TIMER3_COMPA_HANDLER_EXTERNAL
+
 
 // timer modes of operation
 #define TIMER_MODE_NORMAL 									0b00000000
@@ -1,73 +1,322 @@
-#include <avr/eeprom.h>
+#include <avr/pgmspace.h>
+#include <string.h>
 #include "time.h"
+#include "config.h"
 #include "timezone.h"
+#include "tzdb.h"
 
-//Germany
-timeChangeRule_t EEMEM EEtimezoneDstRule = {"MESZ", 120, 2, Sun, Last, Mar};
-timeChangeRule_t EEMEM EEtimezoneStdRule = {"MEZ", 60, 3, Sun, Last, Oct};
-
-timeChangeRule_t timezoneDstRule;
-timeChangeRule_t timezoneStdRule;
+timezoneZone_t timezoneRules;	// rules and transitions of the selected zone
+uint8_t timezoneZone;			// selected zone, index into TzdbZones
 
 time_t timezoneDstStartUtc;
 time_t timezoneStdStartUtc;
 time_t timezoneDstStartLocal;
 time_t timezoneStdStartLocal;
 
+timezoneCache_t timezoneCache;
+
+timezoneListEntry_t timezoneList[TIMEZONE_LIST_LENGTH-1];
+uint8_t timezoneListLength;		// used entries of timezoneList
+
 void timezoneInit(void)
 {
-	eeprom_read_block(&timezoneDstRule, &EEtimezoneDstRule, sizeof(timeChangeRule_t));
-	eeprom_read_block(&timezoneStdRule, &EEtimezoneStdRule, sizeof(timeChangeRule_t));
-	//maybe validity check here
+	configData_t* config = configGet();
+	uint8_t i;
+
+	// the configuration is crc checked, defaults replace a bad one
+	timezoneRules.dst = config->dst;
+	timezoneRules.std = config->std;
+	// the zone is stored by name, the table may change with the tzdata,
+	// its rules take precedence over the copy in the configuration
+	timezoneLoadZone(timezoneFindZone(config->zone));
+
+	// names no longer in the table are skipped
+	timezoneListLength = 0;
+	for(i=0; i<TIMEZONE_LIST_LENGTH-1; i++)
+		timezoneListAppend(timezoneFindZone(config->list[i]));
 }
 
 void timezoneSetDst(timeChangeRule_t dst)
 {
-	timezoneDstRule = dst;
-	eeprom_write_block(&timezoneDstRule, &EEtimezoneDstRule, sizeof(timeChangeRule_t));
+	timezoneRules.dst = dst;
+	configGet()->dst = dst;
+	timezoneSetCustom();
 }
 
 void timezoneSetStd(timeChangeRule_t std)
 {
-	timezoneStdRule = std;
-	eeprom_write_block(&timezoneStdRule, &EEtimezoneStdRule, sizeof(timeChangeRule_t));
+	timezoneRules.std = std;
+	configGet()->std = std;
+	timezoneSetCustom();
+}
+
+void timezoneSetCustom(void)
+{
+	// own rules replace the zone and its transitions
+	configGet()->zone[0] = 0;
+	configChanged();
+	timezoneLoadZone(TIMEZONE_CUSTOM);
 }
 
 timeChangeRule_t timezoneGetDst(void)
 {
-	eeprom_read_block(&timezoneDstRule, &EEtimezoneDstRule, sizeof(timeChangeRule_t));
-	return timezoneDstRule;
+	return timezoneRules.dst;
 }
 
 timeChangeRule_t timezoneGetStd(void)
 {
-	eeprom_read_block(&timezoneStdRule, &EEtimezoneStdRule, sizeof(timeChangeRule_t));
-	return timezoneStdRule;
+	return timezoneRules.std;
+}
+
+uint8_t timezoneFindZone(const char* name)
+{
+	uint8_t first = 0;
+	uint8_t last = TZDB_ZONES;
+	uint8_t zone;
+	int8_t cmp;
+
+	// the generator sorts the zones by name
+	while(first < last)
+	{
+		zone = (first + last) / 2;
+		cmp = strcmp_P(name, (const char*)pgm_read_word(&TzdbZones[zone].name));
+		if(cmp == 0)
+			return zone;
+		if(cmp < 0)
+			last = zone;
+		else
+			first = zone + 1;
+	}
+	return TIMEZONE_CUSTOM;
+}
+
+uint8_t timezoneSetZone(const char* name)
+{
+	configData_t* config = configGet();
+	uint8_t zone = timezoneFindZone(name);
+
+	if(zone == TIMEZONE_CUSTOM)
+		return FALSE;
+	timezoneLoadZone(zone);
+	// keep the stored rules in step, setdst/setstd start from them
+	config->dst = timezoneRules.dst;
+	config->std = timezoneRules.std;
+	strncpy_P(config->zone, timezoneGetZoneName(zone), TIMEZONE_NAME_LENGTH);
+	configChanged();
+	return TRUE;
+}
+
+void timezoneLoadZone(uint8_t zone)
+{
+	timezoneZone = zone;
+	if(zone != TIMEZONE_CUSTOM)
+	{
+		memcpy_P(&timezoneRules, &TzdbZones[zone], sizeof(timezoneZone_t));
+	}
+	else
+	{
+		// keep the rules, they apply all the time
+		timezoneRules.name = 0;
+		timezoneRules.rulesFrom = 0;
+		timezoneRules.transition = 0;
+		timezoneRules.transitions = 0;
+	}
+	timezoneCache.length = 0;
+	// the local start times are calculated again for any year
+	timezoneDstStartLocal = 0;
+}
+
+// zone name in program memory
+const char* timezoneGetZoneName(uint8_t zone)
+{
+	return (const char*)pgm_read_word(&TzdbZones[zone].name);
+}
+
+uint8_t timezoneGetZone(void)
+{
+	return timezoneZone;
+}
+
+uint8_t timezoneListAppend(uint8_t zone)
+{
+	timezoneListEntry_t* entry = &timezoneList[timezoneListLength];
+
+	if(zone == TIMEZONE_CUSTOM || timezoneListLength >= TIMEZONE_LIST_LENGTH-1)
+		return FALSE;
+	entry->zone = zone;
+	entry->cache.length = 0;
+	timezoneListLength++;
+	return TRUE;
+}
+
+uint8_t timezoneListAdd(const char* name)
+{
+	uint8_t zone = timezoneFindZone(name);
+
+	if(!timezoneListAppend(zone))
+		return FALSE;
+	strncpy_P(configGet()->list[timezoneListLength-1], timezoneGetZoneName(zone), TIMEZONE_NAME_LENGTH);
+	configChanged();
+	return TRUE;
+}
+
+void timezoneListClear(void)
+{
+	// an empty name marks the entry unused, names skipped by
+	// timezoneInit() go as well
+	memset(configGet()->list, 0, sizeof(configGet()->list));
+	configChanged();
+	timezoneListLength = 0;
+}
+
+// the selected zone at position 0 and the further zones of the list
+uint8_t timezoneListGetLength(void)
+{
+	return timezoneListLength + 1;
+}
+
+uint8_t timezoneListGetZone(uint8_t position)
+{
+	return position ? timezoneList[position-1].zone : timezoneZone;
+}
+
+int16_t timezoneListGetOffset(uint8_t position, time_t utc)
+{
+	timezoneListEntry_t* entry;
+	timezoneZone_t zone;
+
+	if(position == 0)
+	{
+		timezoneRefreshCache(utc);
+		return timezoneCache.offset / (int32_t)SECS_PER_MIN;
+	}
+
+	// the zone is only read from the table when a transition was crossed
+	entry = &timezoneList[position-1];
+	if(utc - entry->cache.start >= entry->cache.length)
+	{
+		memcpy_P(&zone, &TzdbZones[entry->zone], sizeof(timezoneZone_t));
+		timezoneZoneToCache(&zone, &entry->cache, utc);
+	}
+	return entry->cache.offset / (int32_t)SECS_PER_MIN;
 }
 
 void timezoneCalculateStartTime(uint16_t year)
 {
-	timezoneDstStartLocal = timezoneRuleToTime(timezoneDstRule, year);
-	timezoneStdStartLocal = timezoneRuleToTime(timezoneStdRule, year);
-	timezoneDstStartUtc = timezoneDstStartLocal - timezoneStdRule.offset * SECS_PER_MIN;
-	timezoneStdStartUtc = timezoneStdStartLocal - timezoneDstRule.offset * SECS_PER_MIN;
+	timezoneDstStartLocal = timezoneRuleToTime(timezoneRules.dst, year);
+	timezoneStdStartLocal = timezoneRuleToTime(timezoneRules.std, year);
+	timezoneDstStartUtc = timezoneDstStartLocal - timezoneRules.std.offset * SECS_PER_MIN;
+	timezoneStdStartUtc = timezoneStdStartLocal - timezoneRules.dst.offset * SECS_PER_MIN;
 }
 
-uint8_t timezoneUtcIsDst(time_t utc)
+void timezoneRefreshCache(time_t utc)
 {
-	if(timeGetYear(utc) != timeGetYear(timezoneDstStartUtc))
+	// one compare while utc stays between two transitions, the
+	// subtraction wraps for utc before the start
+	if(utc - timezoneCache.start < timezoneCache.length)
+		return;
+	timezoneZoneToCache(&timezoneRules, &timezoneCache, utc);
+}
+
+void timezoneZoneToCache(const timezoneZone_t* zone, timezoneCache_t* cache, time_t utc)
+{
+	tmElements_t el;
+	uint16_t year;
+	uint8_t dstFirst;
+	time_t dstStart, stdStart;
+	time_t first, second, start, end;
+
+	// the current rules of a zone only hold since they came into effect
+	if(utc < zone->rulesFrom)
+	{
+		timezoneHistoryToCache(zone, cache, utc);
+		return;
+	}
+
+	year = timeGetYear(utc);
+	dstStart = timezoneRuleToTime(zone->dst, year) - zone->std.offset * SECS_PER_MIN;
+	stdStart = timezoneRuleToTime(zone->std, year) - zone->dst.offset * SECS_PER_MIN;
+	dstFirst = (stdStart > dstStart);
+	if(dstFirst)
+	{
+		first = dstStart;
+		second = stdStart;
+	}
+	else
 	{
-		timezoneCalculateStartTime(timeGetYear(utc));
+		first = stdStart;
+		second = dstStart;
 	}
 
-	if(timezoneStdStartUtc > timezoneDstStartUtc)
+	// the transitions of the year split it in three parts,
+	// the rules are evaluated per year, so none crosses its end
+	el.Second = 0;
+	el.Minute = 0;
+	el.Hour = 0;
+	el.Day = 1;
+	el.Month = 1;
+	el.Year = CalendarYrToTm(year);
+	start = timeMake(el);
+	el.Year++;
+	end = timeMake(el);
+	if(utc < first)
 	{
-		return (utc >= timezoneDstStartUtc && utc < timezoneStdStartUtc);
+		if(first < end)
+			end = first;
+	}
+	else if(utc < second)
+	{
+		if(first > start)
+			start = first;
+		if(second < end)
+			end = second;
 	}
 	else
 	{
-		return !(utc >= timezoneStdStartUtc && utc < timezoneDstStartUtc);
+		if(second > start)
+			start = second;
+	}
+	if(start < zone->rulesFrom)
+		start = zone->rulesFrom;
+	cache->start = start;
+	cache->length = end - start;
+
+	// DST between the transitions if it starts first in the year,
+	// never if both rules have the same offset (zones without DST)
+	cache->dst = ((utc >= first && utc < second) == dstFirst) &&
+		(zone->dst.offset != zone->std.offset);
+	cache->offset = (cache->dst ? zone->dst.offset : zone->std.offset) * (int32_t)SECS_PER_MIN;
+}
+
+void timezoneHistoryToCache(const timezoneZone_t* zone, timezoneCache_t* cache, time_t utc)
+{
+	const timezoneTransition_t* transition = &TzdbTransitions[zone->transition];
+	uint8_t first = 0;
+	uint8_t last = zone->transitions;
+	uint8_t i;
+	time_t end;
+
+	// last transition at or before utc, the first one also covers
+	// everything earlier
+	while(last - first > 1)
+	{
+		i = (first + last) / 2;
+		if(pgm_read_dword(&transition[i].start) <= utc)
+			first = i;
+		else
+			last = i;
 	}
+	end = (first+1 < zone->transitions) ? pgm_read_dword(&transition[first+1].start) : zone->rulesFrom;
+	cache->start = first ? pgm_read_dword(&transition[first].start) : 0;
+	cache->length = end - cache->start;
+	cache->offset = (int16_t)pgm_read_word(&transition[first].offset) * (int32_t)SECS_PER_MIN;
+	cache->dst = pgm_read_byte(&transition[first].dst);
+}
+
+uint8_t timezoneUtcIsDst(time_t utc)
+{
+	timezoneRefreshCache(utc);
+	return timezoneCache.dst;
 }
 
 uint8_t timezoneLocalIsDst(time_t local)
@@ -123,19 +372,9 @@ time_t timezoneRuleToTime(timeChangeRule_t rule, uint16_t year)
 
 time_t timezoneTimeToLocal(time_t utc)
 {
-	if(timeGetYear(utc) != timeGetYear(timezoneDstStartUtc))
-	{
-		timezoneCalculateStartTime(timeGetYear(utc));
-	}
-
-	if(timezoneUtcIsDst(utc))
-	{
-		return utc + timezoneDstRule.offset * SECS_PER_MIN;
-	}
-	else 
-	{
-		return utc + timezoneStdRule.offset * SECS_PER_MIN;
-	}
+	// the rules are only evaluated when a transition was crossed
+	timezoneRefreshCache(utc);
+	return utc + timezoneCache.offset;
 }
 
 time_t timezoneTimeToUTC(time_t local)
@@ -147,10 +386,10 @@ time_t timezoneTimeToUTC(time_t local)
 
 	if(timezoneLocalIsDst(local))
 	{
-		return local - timezoneDstRule.offset * SECS_PER_MIN;
+		return local - timezoneRules.dst.offset * SECS_PER_MIN;
 	}
 	else
 	{
-		return local - timezoneStdRule.offset * SECS_PER_MIN;
+		return local - timezoneRules.std.offset * SECS_PER_MIN;
 	}
 }
\ No newline at end of file
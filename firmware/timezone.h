@@ -17,12 +17,66 @@ typedef struct
 	uint8_t month:4;
 } timeChangeRule_t;
 
+#define TIMEZONE_NAME_LENGTH	32		// longest IANA zone name with the NUL
+#define TIMEZONE_CUSTOM			0xFF	// rules set with setdst/setstd, no zone
+#define TIMEZONE_LIST_LENGTH	4		// selected zone and further zones to show
+
+// Offset of a compiled zone, valid from start until the next transition
+typedef struct
+{
+	time_t start;		// first UTC second
+	int16_t offset;		// minutes to add to UTC
+	uint8_t dst;		// daylight saving time applies
+} timezoneTransition_t;
+
+// Zone of the compiled tz database (tzdb.c), lives in program memory
+typedef struct
+{
+	const char* name;			// IANA zone name, in program memory
+	timeChangeRule_t dst;		// rules in effect since rulesFrom
+	timeChangeRule_t std;
+	time_t rulesFrom;			// UTC the rules apply from, transitions before
+	uint16_t transition;		// index of the first transition in TzdbTransitions
+	uint8_t transitions;		// number of transitions
+} timezoneZone_t;
+
+// UTC interval in which the local time offset does not change
+typedef struct
+{
+	time_t start;		// first UTC second of the interval
+	time_t length;		// seconds in the interval, 0 if not valid
+	int32_t offset;		// seconds to add to UTC
+	uint8_t dst;		// daylight saving time applies
+} timezoneCache_t;
+
+// Further zone of the list, with its own offset cache
+typedef struct
+{
+	uint8_t zone;			// index into TzdbZones
+	timezoneCache_t cache;
+} timezoneListEntry_t;
+
 void timezoneInit(void);
 void timezoneSetDst(timeChangeRule_t dst);
 void timezoneSetStd(timeChangeRule_t std);
 timeChangeRule_t timezoneGetDst(void);
 timeChangeRule_t timezoneGetStd(void);
-void timezoneCalculateStartTimes(uint16_t year);
+void timezoneCalculateStartTime(uint16_t year);
+void timezoneRefreshCache(time_t utc);
+void timezoneZoneToCache(const timezoneZone_t* zone, timezoneCache_t* cache, time_t utc);
+void timezoneHistoryToCache(const timezoneZone_t* zone, timezoneCache_t* cache, time_t utc);
+void timezoneSetCustom(void);
+uint8_t timezoneFindZone(const char* name);
+uint8_t timezoneSetZone(const char* name);
+void timezoneLoadZone(uint8_t zone);
+const char* timezoneGetZoneName(uint8_t zone);
+uint8_t timezoneGetZone(void);
+uint8_t timezoneListAppend(uint8_t zone);
+uint8_t timezoneListAdd(const char* name);
+void timezoneListClear(void);
+uint8_t timezoneListGetLength(void);
+uint8_t timezoneListGetZone(uint8_t position);
+int16_t timezoneListGetOffset(uint8_t position, time_t utc);
 uint8_t timezoneUtcIsDst(time_t utc);
 uint8_t timezoneLocalIsDst(time_t local);
 time_t timezoneRuleToTime(timeChangeRule_t rule, uint16_t year);
@@ -0,0 +1,333 @@
+#!/usr/bin/env python3
+"""Compile selected IANA tz zones into the PROGMEM table in tzdb.c.
+
+The zones listed in zones.txt are compiled from the vendored tzdata.zi
+with zic.  For every zone the current rule pair is taken from the POSIX
+TZ string at the end of the TZif file.  The transitions since --since
+that the rule pair does not reproduce are stored as well.  The rule
+evaluation below mirrors timezone.c, so "reproduce" means the firmware
+would show the same offset.
+
+Run from the firmware directory:
+
+    python3 tzdata/tzgen.py
+
+Needs only Python 3 and zic, no network access.
+"""
+
+import argparse
+import calendar
+import os
+import re
+import struct
+import subprocess
+import sys
+import tempfile
+import time
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+NAME_LENGTH = 32        # TIMEZONE_NAME_LENGTH in timezone.h, with the NUL
+ABBREV_LENGTH = 6       # timeChangeRule_t.abbrev, with the NUL
+CHECK_UNTIL = 2037      # explicit transitions of a fat TZif file end here
+
+DOW = ["Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"]
+WEEK = ["Last", "First", "Second", "Third", "Fourth"]
+MONTH = [None, "Jan", "Feb", "Mar", "Apr", "May", "Jun",
+         "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"]
+
+
+class ZoneError(Exception):
+    pass
+
+
+def read_tzif(path):
+    """Return (transitions, types, footer) from the 64-bit part of a TZif file."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] != b"TZif" or data[4] < ord("2"):
+        raise ZoneError("%s is not a version 2+ TZif file" % path)
+
+    def counts(offset):
+        return struct.unpack(">6l", data[offset + 20:offset + 44])
+
+    isut, isstd, leap, timecnt, typecnt, charcnt = counts(0)
+    # skip the 32-bit block
+    pos = 44 + timecnt * 5 + typecnt * 6 + charcnt + leap * 8 + isstd + isut
+    isut, isstd, leap, timecnt, typecnt, charcnt = counts(pos)
+    pos += 44
+    times = struct.unpack(">%dq" % timecnt, data[pos:pos + timecnt * 8])
+    pos += timecnt * 8
+    indices = data[pos:pos + timecnt]
+    pos += timecnt
+    types = []
+    for i in range(typecnt):
+        utoff, isdst, _ = struct.unpack(">lBB", data[pos:pos + 6])
+        types.append((utoff, bool(isdst)))
+        pos += 6
+    pos += charcnt + leap * 12 + isstd + isut
+    footer = data[pos:].strip(b"\n").decode("ascii")
+    return [(t, types[i]) for t, i in zip(times, indices)], types, footer
+
+
+def parse_posix(tz):
+    """Split a POSIX TZ string into (std, stdoff, dst, dstoff, start, end)."""
+    pos = 0
+
+    def name():
+        nonlocal pos
+        if tz[pos] == "<":
+            end = tz.index(">", pos)
+            value = tz[pos + 1:end]
+            pos = end + 1
+        else:
+            m = re.match(r"[A-Za-z]+", tz[pos:])
+            value = m.group(0)
+            pos += len(value)
+        return value
+
+    def offset():
+        # POSIX offsets count west of Greenwich, return minutes east
+        nonlocal pos
+        m = re.match(r"([+-]?)(\d+)(?::(\d+))?(?::(\d+))?", tz[pos:])
+        pos += len(m.group(0))
+        minutes = int(m.group(2)) * 60 + int(m.group(3) or 0)
+        if m.group(4):
+            raise ZoneError("offset with seconds in %s" % tz)
+        return minutes if m.group(1) == "-" else -minutes
+
+    def rule():
+        nonlocal pos
+        m = re.match(r",M(\d+)\.(\d)\.(\d)(?:/([+-]?\d+)(?::(\d+))?)?", tz[pos:])
+        if not m:
+            raise ZoneError("only Mm.w.d rules are supported: %s" % tz)
+        pos += len(m.group(0))
+        hour = int(m.group(4)) if m.group(4) else 2
+        if m.group(5) and int(m.group(5)) or not 0 <= hour <= 31:
+            raise ZoneError("rule time does not fit timeChangeRule_t: %s" % tz)
+        week = int(m.group(2))
+        return (int(m.group(1)), 0 if week == 5 else week, int(m.group(3)) + 1, hour)
+
+    std = name()
+    stdoff = offset()
+    if pos == len(tz):
+        return std, stdoff, None, None, None, None
+    dst = name()
+    dstoff = offset() if tz[pos] != "," else stdoff + 60
+    start = rule()
+    end = rule()
+    return std, stdoff, dst, dstoff, start, end
+
+
+def rule_to_time(rule, year):
+    """Local time of a rule in a year, as timezoneRuleToTime() computes it."""
+    month, week, dow, hour = rule
+    if week == 0:
+        month += 1
+        if month > 12:
+            month = 1
+            year += 1
+        weeks = 1
+    else:
+        weeks = week
+    t = calendar.timegm((year, month, 1, hour, 0, 0))
+    wday = (t // 86400 + 4) % 7 + 1
+    t += (7 * (weeks - 1) + (dow - wday + 7) % 7) * 86400
+    if week == 0:
+        t -= 7 * 86400
+    return t
+
+
+class Rules:
+    """The rule pair as timezone.c evaluates it."""
+
+    def __init__(self, posix):
+        self.std, self.stdoff, self.dst, self.dstoff, self.start, self.end = parse_posix(posix)
+        if self.dst is None:
+            # no daylight saving time, both rules are the same
+            self.dst, self.dstoff = self.std, self.stdoff
+            self.start = self.end = (1, 1, 1, 0)
+        for abbrev in (self.std, self.dst):
+            if len(abbrev) >= ABBREV_LENGTH:
+                raise ZoneError("abbreviation %s too long" % abbrev)
+
+    def starts(self, year):
+        dst = rule_to_time(self.start, year) - self.stdoff * 60
+        std = rule_to_time(self.end, year) - self.dstoff * 60
+        return dst, std
+
+    def at(self, utc):
+        year = time_year(utc)
+        dst_start, std_start = self.starts(year)
+        dst_first = std_start > dst_start
+        first, second = (dst_start, std_start) if dst_first else (std_start, dst_start)
+        dst = (first <= utc < second) == dst_first
+        if self.dstoff == self.stdoff:
+            dst = False
+        return (self.dstoff if dst else self.stdoff, dst)
+
+    def breakpoints(self, since):
+        points = []
+        for year in range(since - 1, CHECK_UNTIL + 2):
+            points.extend(self.starts(year))
+            points.append(calendar.timegm((year, 1, 1, 0, 0, 0)))
+        return points
+
+    def c_rule(self, dst):
+        month, week, dow, hour = self.start if dst else self.end
+        return '{"%s", %d, %d, %s, %s, %s}' % (
+            self.dst if dst else self.std, self.dstoff if dst else self.stdoff,
+            hour, DOW[dow - 1], WEEK[week], MONTH[month])
+
+
+def time_year(utc):
+    return time.gmtime(utc).tm_year
+
+
+def compile_zone(name, path, since):
+    transitions, types, footer = read_tzif(path)
+    rules = Rules(footer)
+    begin = calendar.timegm((since, 1, 1, 0, 0, 0))
+    until = calendar.timegm((CHECK_UNTIL, 1, 1, 0, 0, 0))
+
+    def explicit(utc):
+        value = None
+        for t, kind in transitions:
+            if t > utc:
+                break
+            value = kind
+        if value is None:
+            value = types[0]
+        if value[0] % 60:
+            raise ZoneError("%s: offset with seconds after %d" % (name, since))
+        return (value[0] // 60, value[1])
+
+    points = sorted(set([begin] + [t for t, _ in transitions if begin < t < until] +
+                        [t for t in rules.breakpoints(since) if begin < t < until]))
+    if explicit(points[-1]) != rules.at(points[-1]):
+        raise ZoneError("%s: the rules do not reproduce the tz data" % name)
+
+    # the rules apply from the start of the final run where both agree
+    first = len(points) - 1
+    while first > 0 and explicit(points[first - 1]) == rules.at(points[first - 1]):
+        first -= 1
+    if first == 0:
+        return rules, 0, []
+    rules_from = points[first]
+
+    history = []
+    for t in [begin] + [t for t, _ in transitions if begin < t < rules_from]:
+        offset, dst = explicit(t)
+        if not history or history[-1][1:] != (offset, dst):
+            history.append((t, offset, dst))
+    return rules, rules_from, history
+
+
+def write_source(path, version, zones):
+    out = []
+    out.append("// tzdb.c - compiled tz database, generated by tzdata/tzgen.py")
+    out.append("// from tzdata %s, do not edit, change tzdata/zones.txt instead" % version)
+    out.append("")
+    out.append("#include <avr/pgmspace.h>")
+    out.append('#include "time.h"')
+    out.append('#include "timezone.h"')
+    out.append('#include "tzdb.h"')
+    out.append("")
+    out.append("// zone names, sorted for the binary search in timezoneFindZone()")
+    for i, (name, _, _, _) in enumerate(zones):
+        out.append('const char TzdbName%02d[] PROGMEM = "%s";' % (i, name))
+    out.append("")
+    out.append("// offsets the current rules do not reproduce, per zone in time order")
+    out.append("const timezoneTransition_t TzdbTransitions[] PROGMEM =")
+    out.append("{")
+    count = 0
+    for name, _, _, history in zones:
+        if history:
+            out.append("\t// %s" % name)
+        for t, offset, dst in history:
+            out.append("\t{%du, %d, %d},\t// %s" % (
+                t, offset, 1 if dst else 0,
+                time.strftime("%Y-%m-%d %H:%M", time.gmtime(t))))
+            count += 1
+    if not count:
+        out.append("\t{0, 0, 0}")
+    out.append("};")
+    out.append("")
+    out.append("const timezoneZone_t TzdbZones[TZDB_ZONES] PROGMEM =")
+    out.append("{")
+    index = 0
+    for i, (name, rules, rules_from, history) in enumerate(zones):
+        out.append("\t{TzdbName%02d, %s, %s, %du, %d, %d}," % (
+            i, rules.c_rule(True), rules.c_rule(False), rules_from, index, len(history)))
+        index += len(history)
+    out.append("};")
+    with open(path, "w") as f:
+        f.write("\n".join(out) + "\n")
+    return count
+
+
+def write_header(path, version, zones):
+    out = []
+    out.append("// tzdb.h - compiled tz database, generated by tzdata/tzgen.py")
+    out.append("// from tzdata %s, do not edit, change tzdata/zones.txt instead" % version)
+    out.append("")
+    out.append("#ifndef TZDB_H")
+    out.append("#define TZDB_H")
+    out.append("")
+    out.append("#include <avr/pgmspace.h>")
+    out.append('#include "timezone.h"')
+    out.append("")
+    out.append('#define TZDB_VERSION\t"%s"' % version)
+    out.append("#define TZDB_ZONES\t\t%d" % len(zones))
+    out.append("")
+    out.append("extern const timezoneTransition_t TzdbTransitions[] PROGMEM;")
+    out.append("extern const timezoneZone_t TzdbZones[TZDB_ZONES] PROGMEM;")
+    out.append("")
+    out.append("#endif")
+    with open(path, "w") as f:
+        f.write("\n".join(out) + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--tzdata", default=os.path.join(HERE, "tzdata.zi"))
+    parser.add_argument("--zones", default=os.path.join(HERE, "zones.txt"))
+    parser.add_argument("--out", default=os.path.dirname(HERE))
+    parser.add_argument("--since", type=int, default=2010,
+                        help="first year with historical transitions (default 2010)")
+    args = parser.parse_args()
+
+    with open(args.tzdata) as f:
+        version = f.readline().split()[-1]
+    with open(args.zones) as f:
+        names = sorted(set(line.strip() for line in f
+                           if line.strip() and not line.startswith("#")))
+
+    zones = []
+    failed = False
+    with tempfile.TemporaryDirectory() as tmp:
+        # fat files list the transitions up to 2037, so the rules can be checked
+        subprocess.check_call(["zic", "-b", "fat", "-d", tmp, args.tzdata])
+        for name in names:
+            try:
+                if len(name) >= NAME_LENGTH:
+                    raise ZoneError("%s: name too long" % name)
+                rules, rules_from, history = compile_zone(name, os.path.join(tmp, name), args.since)
+                zones.append((name, rules, rules_from, history))
+            except (ZoneError, OSError) as e:
+                print("tzgen: %s" % e, file=sys.stderr)
+                failed = True
+    if failed:
+        return 1
+
+    count = write_source(os.path.join(args.out, "tzdb.c"), version, zones)
+    write_header(os.path.join(args.out, "tzdb.h"), version, zones)
+    print("tzgen: tzdata %s, %d zones, %d transitions, %d bytes of flash" % (
+        version, len(zones), count,
+        # name, pointer, 2 rules, rulesFrom, first index, count + 7 per transition
+        sum(len(z[0]) + 1 + 2 + 2 * 10 + 4 + 2 + 1 for z in zones) + count * 7))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,90 @@
+// tzdb.c - compiled tz database, generated by tzdata/tzgen.py
+// from tzdata 2025b, do not edit, change tzdata/zones.txt instead
+
+#include <avr/pgmspace.h>
+#include "time.h"
+#include "timezone.h"
+#include "tzdb.h"
+
+// zone names, sorted for the binary search in timezoneFindZone()
+const char TzdbName00[] PROGMEM = "America/Chicago";
+const char TzdbName01[] PROGMEM = "America/Denver";
+const char TzdbName02[] PROGMEM = "America/Los_Angeles";
+const char TzdbName03[] PROGMEM = "America/New_York";
+const char TzdbName04[] PROGMEM = "America/Phoenix";
+const char TzdbName05[] PROGMEM = "America/Sao_Paulo";
+const char TzdbName06[] PROGMEM = "Asia/Kolkata";
+const char TzdbName07[] PROGMEM = "Asia/Shanghai";
+const char TzdbName08[] PROGMEM = "Asia/Tokyo";
+const char TzdbName09[] PROGMEM = "Australia/Sydney";
+const char TzdbName10[] PROGMEM = "Europe/Berlin";
+const char TzdbName11[] PROGMEM = "Europe/Istanbul";
+const char TzdbName12[] PROGMEM = "Europe/London";
+const char TzdbName13[] PROGMEM = "Europe/Moscow";
+const char TzdbName14[] PROGMEM = "Pacific/Auckland";
+const char TzdbName15[] PROGMEM = "UTC";
+
+// offsets the current rules do not reproduce, per zone in time order
+const timezoneTransition_t TzdbTransitions[] PROGMEM =
+{
+	// America/Sao_Paulo
+	{1262304000u, -120, 1},	// 2010-01-01 00:00
+	{1266717600u, -180, 0},	// 2010-02-21 02:00
+	{1287284400u, -120, 1},	// 2010-10-17 03:00
+	{1298167200u, -180, 0},	// 2011-02-20 02:00
+	{1318734000u, -120, 1},	// 2011-10-16 03:00
+	{1330221600u, -180, 0},	// 2012-02-26 02:00
+	{1350788400u, -120, 1},	// 2012-10-21 03:00
+	{1361066400u, -180, 0},	// 2013-02-17 02:00
+	{1382238000u, -120, 1},	// 2013-10-20 03:00
+	{1392516000u, -180, 0},	// 2014-02-16 02:00
+	{1413687600u, -120, 1},	// 2014-10-19 03:00
+	{1424570400u, -180, 0},	// 2015-02-22 02:00
+	{1445137200u, -120, 1},	// 2015-10-18 03:00
+	{1456020000u, -180, 0},	// 2016-02-21 02:00
+	{1476586800u, -120, 1},	// 2016-10-16 03:00
+	{1487469600u, -180, 0},	// 2017-02-19 02:00
+	{1508036400u, -120, 1},	// 2017-10-15 03:00
+	{1518919200u, -180, 0},	// 2018-02-18 02:00
+	{1541300400u, -120, 1},	// 2018-11-04 03:00
+	// Europe/Istanbul
+	{1262304000u, 120, 0},	// 2010-01-01 00:00
+	{1269738000u, 180, 1},	// 2010-03-28 01:00
+	{1288486800u, 120, 0},	// 2010-10-31 01:00
+	{1301274000u, 180, 1},	// 2011-03-28 01:00
+	{1319936400u, 120, 0},	// 2011-10-30 01:00
+	{1332637200u, 180, 1},	// 2012-03-25 01:00
+	{1351386000u, 120, 0},	// 2012-10-28 01:00
+	{1364691600u, 180, 1},	// 2013-03-31 01:00
+	{1382835600u, 120, 0},	// 2013-10-27 01:00
+	{1396227600u, 180, 1},	// 2014-03-31 01:00
+	{1414285200u, 120, 0},	// 2014-10-26 01:00
+	{1427590800u, 180, 1},	// 2015-03-29 01:00
+	{1446944400u, 120, 0},	// 2015-11-08 01:00
+	{1459040400u, 180, 1},	// 2016-03-27 01:00
+	// Europe/Moscow
+	{1262304000u, 180, 0},	// 2010-01-01 00:00
+	{1269730800u, 240, 1},	// 2010-03-27 23:00
+	{1288479600u, 180, 0},	// 2010-10-30 23:00
+	{1301180400u, 240, 0},	// 2011-03-26 23:00
+};
+
+const timezoneZone_t TzdbZones[TZDB_ZONES] PROGMEM =
+{
+	{TzdbName00, {"CDT", -300, 2, Sun, Second, Mar}, {"CST", -360, 2, Sun, First, Nov}, 0u, 0, 0},
+	{TzdbName01, {"MDT", -360, 2, Sun, Second, Mar}, {"MST", -420, 2, Sun, First, Nov}, 0u, 0, 0},
+	{TzdbName02, {"PDT", -420, 2, Sun, Second, Mar}, {"PST", -480, 2, Sun, First, Nov}, 0u, 0, 0},
+	{TzdbName03, {"EDT", -240, 2, Sun, Second, Mar}, {"EST", -300, 2, Sun, First, Nov}, 0u, 0, 0},
+	{TzdbName04, {"MST", -420, 0, Sun, First, Jan}, {"MST", -420, 0, Sun, First, Jan}, 0u, 0, 0},
+	{TzdbName05, {"-03", -180, 0, Sun, First, Jan}, {"-03", -180, 0, Sun, First, Jan}, 1550368800u, 0, 19},
+	{TzdbName06, {"IST", 330, 0, Sun, First, Jan}, {"IST", 330, 0, Sun, First, Jan}, 0u, 19, 0},
+	{TzdbName07, {"CST", 480, 0, Sun, First, Jan}, {"CST", 480, 0, Sun, First, Jan}, 0u, 19, 0},
+	{TzdbName08, {"JST", 540, 0, Sun, First, Jan}, {"JST", 540, 0, Sun, First, Jan}, 0u, 19, 0},
+	{TzdbName09, {"AEDT", 660, 2, Sun, First, Oct}, {"AEST", 600, 3, Sun, First, Apr}, 0u, 19, 0},
+	{TzdbName10, {"CEST", 120, 2, Sun, Last, Mar}, {"CET", 60, 3, Sun, Last, Oct}, 0u, 19, 0},
+	{TzdbName11, {"+03", 180, 0, Sun, First, Jan}, {"+03", 180, 0, Sun, First, Jan}, 1473195600u, 19, 14},
+	{TzdbName12, {"BST", 60, 1, Sun, Last, Mar}, {"GMT", 0, 2, Sun, Last, Oct}, 0u, 33, 0},
+	{TzdbName13, {"MSK", 180, 0, Sun, First, Jan}, {"MSK", 180, 0, Sun, First, Jan}, 1414274400u, 33, 4},
+	{TzdbName14, {"NZDT", 780, 2, Sun, Last, Sep}, {"NZST", 720, 3, Sun, First, Apr}, 0u, 37, 0},
+	{TzdbName15, {"UTC", 0, 0, Sun, First, Jan}, {"UTC", 0, 0, Sun, First, Jan}, 0u, 37, 0},
+};
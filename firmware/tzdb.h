@@ -0,0 +1,16 @@
+// tzdb.h - compiled tz database, generated by tzdata/tzgen.py
+// from tzdata 2025b, do not edit, change tzdata/zones.txt instead
+
+#ifndef TZDB_H
+#define TZDB_H
+
+#include <avr/pgmspace.h>
+#include "timezone.h"
+
+#define TZDB_VERSION	"2025b"
+#define TZDB_ZONES		16
+
+extern const timezoneTransition_t TzdbTransitions[] PROGMEM;
+extern const timezoneZone_t TzdbZones[TZDB_ZONES] PROGMEM;
+
+#endif
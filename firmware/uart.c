@@ -17,8 +17,10 @@
 
 #include <avr/io.h>
 #include <avr/interrupt.h>
+#include <string.h>
 
-#include "buffer.h"
+#include "ring.h"
+#include "systemtime.h"
 #include "uart.h"
 
 // UART global variables
@@ -26,9 +28,15 @@
 volatile uint8_t   uartReadyTx;			///< uartReadyTx flag
 volatile uint8_t   uartBufferedTx;		///< uartBufferedTx flag
 // receive and transmit buffers
-cBuffer uartRxBuffer;				///< uart receive buffer
-cBuffer uartTxBuffer;				///< uart transmit buffer
-uint16_t uartRxOverflow;		///< receive overflow counter
+ringBuffer uartRxBuffer;			///< uart receive buffer
+ringBuffer uartTxBuffer;			///< uart transmit buffer
+UartStatsType uartStats;		///< receive and transmit health counters
+// arrival times of the last message starts
+volatile uint8_t uartRxStampCount;			///< number of UART_RX_STAMP_CHAR received
+uint32_t uartRxStamp[UART_RX_STAMPS];		///< system time of the last ones
+// ends of the last lines
+volatile uint8_t uartRxLineCount;			///< number of '\n' received
+uint8_t uartRxLineEnd[UART_RX_LINES];		///< receive buffer head after the last '\n'
 
 #ifndef UART_BUFFERS_EXTERNAL_RAM
 // using internal ram,
@@ -36,6 +44,9 @@ uint16_t uartRxOverflow;		///< receive overflow counter
 static uint8_t uartRxData[UART_RX_BUFFER_SIZE];
 static uint8_t uartTxData[UART_TX_BUFFER_SIZE];
 #endif
+// the rings wrap with a mask
+RING_SIZE_CHECK(UART_RX_BUFFER_SIZE);
+RING_SIZE_CHECK(UART_TX_BUFFER_SIZE);
 
 typedef void (*voidFuncPtruint8_t)(uint8_t);
 volatile static voidFuncPtruint8_t UartRxFunc;
@@ -56,8 +67,10 @@ void uartInit(void)
 	// initialize states
 	uartReadyTx = TRUE;
 	uartBufferedTx = FALSE;
-	// clear overflow count
-	uartRxOverflow = 0;
+	// clear health counters
+	memset(&uartStats, 0, sizeof(uartStats));
+	uartRxStampCount = 0;
+	uartRxLineCount = 0;
 	// enable interrupts
 	sei();
 }
@@ -67,14 +80,14 @@ void uartInitBuffers(void)
 {
 #ifndef UART_BUFFERS_EXTERNAL_RAM
 	// initialize the UART receive buffer
-	bufferInit(&uartRxBuffer, uartRxData, UART_RX_BUFFER_SIZE);
+	ringInit(&uartRxBuffer, uartRxData, UART_RX_BUFFER_SIZE);
 	// initialize the UART transmit buffer
-	bufferInit(&uartTxBuffer, uartTxData, UART_TX_BUFFER_SIZE);
+	ringInit(&uartTxBuffer, uartTxData, UART_TX_BUFFER_SIZE);
 #else
 	// initialize the UART receive buffer
-	bufferInit(&uartRxBuffer, (uint8_t*) UART_RX_BUFFER_ADDR, UART_RX_BUFFER_SIZE);
+	ringInit(&uartRxBuffer, (uint8_t*) UART_RX_BUFFER_ADDR, UART_RX_BUFFER_SIZE);
 	// initialize the UART transmit buffer
-	bufferInit(&uartTxBuffer, (uint8_t*) UART_TX_BUFFER_ADDR, UART_TX_BUFFER_SIZE);
+	ringInit(&uartTxBuffer, (uint8_t*) UART_TX_BUFFER_ADDR, UART_TX_BUFFER_SIZE);
 #endif
 }
 
@@ -97,14 +110,14 @@ void uartSetBaudRate(uint32_t baudrate)
 }
 
 // returns the receive buffer structure
-cBuffer* uartGetRxBuffer(void)
+ringBuffer* uartGetRxBuffer(void)
 {
 	// return rx buffer pointer
 	return &uartRxBuffer;
 }
 
 // returns the transmit buffer structure
-cBuffer* uartGetTxBuffer(void)
+ringBuffer* uartGetTxBuffer(void)
 {
 	// return tx buffer pointer
 	return &uartTxBuffer;
@@ -117,6 +130,7 @@ void uartSendByte(uint8_t txData)
 	while(!uartReadyTx);
 	// send byte
 	outb(UDR, txData);
+	uartStats.txBytes++;
 	// set ready state to FALSE
 	uartReadyTx = FALSE;
 }
@@ -134,25 +148,16 @@ int uartGetByte(void)
 // gets a byte (if available) from the uart receive buffer
 uint8_t uartReceiveByte(uint8_t* rxData)
 {
-	// make sure we have a receive buffer
-	if(uartRxBuffer.size)
+	// make sure we have data
+	if(ringGetDataLength(&uartRxBuffer))
 	{
-		// make sure we have data
-		if(uartRxBuffer.datalength)
-		{
-			// get byte from beginning of buffer
-			*rxData = bufferGetFromFront(&uartRxBuffer);
-			return TRUE;
-		}
-		else
-		{
-			// no data
-			return FALSE;
-		}
+		// get byte from beginning of buffer
+		*rxData = ringGetFromFront(&uartRxBuffer);
+		return TRUE;
 	}
 	else
 	{
-		// no buffer
+		// no data
 		return FALSE;
 	}
 }
@@ -161,15 +166,13 @@ uint8_t uartReceiveByte(uint8_t* rxData)
 void uartFlushReceiveBuffer(void)
 {
 	// flush all data from receive buffer
-	//bufferFlush(&uartRxBuffer);
-	// same effect as above
-	uartRxBuffer.datalength = 0;
+	ringFlush(&uartRxBuffer);
 }
 
 // return true if uart receive buffer is empty
 uint8_t uartReceiveBufferIsEmpty(void)
 {
-	if(uartRxBuffer.datalength == 0)
+	if(ringGetDataLength(&uartRxBuffer) == 0)
 	{
 		return TRUE;
 	}
@@ -179,11 +182,86 @@ uint8_t uartReceiveBufferIsEmpty(void)
 	}
 }
 
+// return the number of bytes lost because the receive buffer was full
+uint16_t uartGetRxOverflow(void)
+{
+	uint16_t overflow;
+	uint8_t sreg = SREG;
+	// counter is modified by the receive interrupt
+	cli();
+	overflow = uartStats.rxOverflow;
+	SREG = sreg;
+	return overflow;
+}
+
+// copy the health counters
+void uartGetStats(UartStatsType* stats)
+{
+	uint8_t sreg = SREG;
+	// counters are modified by the interrupts
+	cli();
+	*stats = uartStats;
+	SREG = sreg;
+}
+
+// clear the health counters
+void uartResetStats(void)
+{
+	uint8_t sreg = SREG;
+	cli();
+	memset(&uartStats, 0, sizeof(uartStats));
+	SREG = sreg;
+}
+
+// get the arrival time of the stamped byte received after count others
+uint8_t uartGetRxStamp(uint8_t count, uint32_t* millis)
+{
+	uint8_t valid;
+	uint8_t sreg = SREG;
+
+	// timestamps are written by the receive interrupt
+	cli();
+	valid = (uint8_t)(uartRxStampCount - count - 1) < UART_RX_STAMPS;
+	*millis = uartRxStamp[count & (UART_RX_STAMPS-1)];
+	SREG = sreg;
+	return valid;
+}
+
+// get the end of the line received after count others
+uint8_t uartGetRxLine(uint8_t count, uint8_t* end)
+{
+	uint8_t pending;
+	uint8_t sreg = SREG;
+
+	// line ends are written by the receive interrupt
+	cli();
+	pending = uartRxLineCount - count;
+	*end = uartRxLineEnd[count & (UART_RX_LINES-1)];
+	SREG = sreg;
+	return pending;
+}
+
+// return true if the last transmission is complete
+uint8_t uartTransmitIsIdle(void)
+{
+	return uartReadyTx;
+}
+
 // add byte to end of uart Tx buffer
 uint8_t uartAddToTxBuffer(uint8_t data)
 {
+	uint8_t length;
+
 	// add data byte to the end of the tx buffer
-	return bufferAddToEnd(&uartTxBuffer, data);
+	if(!ringAddToEnd(&uartTxBuffer, data))
+	{
+		uartStats.txOverflow++;
+		return FALSE;
+	}
+	length = ringGetDataLength(&uartTxBuffer);
+	if(length > uartStats.txPeak)
+		uartStats.txPeak = length;
+	return TRUE;
 }
 
 // start transmission of the current uart Tx buffer contents
@@ -192,7 +270,7 @@ void uartSendTxBuffer(void)
 	// turn on buffered transmit
 	uartBufferedTx = TRUE;
 	// send the first byte to get things going by interrupts
-	uartSendByte(bufferGetFromFront(&uartTxBuffer));
+	uartSendByte(ringGetFromFront(&uartTxBuffer));
 }
 /*
 // transmit nBytes from buffer out the uart
@@ -202,7 +280,7 @@ uint8_t uartSendBuffer(char *buffer, uint16_t nBytes)
 	register uint16_t i;
 
 	// check if there's space (and that we have any bytes to send at all)
-	if((uartTxBuffer.datalength + nBytes < uartTxBuffer.size) && nBytes)
+	if((nBytes < ringIsNotFull(&uartTxBuffer)) && nBytes)
 	{
 		// grab first character
 		first = *buffer++;
@@ -210,7 +288,7 @@ uint8_t uartSendBuffer(char *buffer, uint16_t nBytes)
 		for(i = 0; i < nBytes-1; i++)
 		{
 			// put data bytes at end of buffer
-			bufferAddToEnd(&uartTxBuffer, *buffer++);
+			ringAddToEnd(&uartTxBuffer, *buffer++);
 		}
 
 		// send the first byte to get things going by interrupts
@@ -233,10 +311,11 @@ UART_INTERRUPT_HANDLER(UART_TRANS_vect)
 	if(uartBufferedTx)
 	{
 		// check if there's data left in the buffer
-		if(uartTxBuffer.datalength)
+		if(ringGetDataLength(&uartTxBuffer))
 		{
 			// send byte from top of buffer
-			outb(UDR, bufferGetFromFront(&uartTxBuffer));
+			outb(UDR, ringGetFromFront(&uartTxBuffer));
+			uartStats.txBytes++;
 		}
 		else
 		{
@@ -258,10 +337,25 @@ UART_INTERRUPT_HANDLER(UART_TRANS_vect)
 UART_INTERRUPT_HANDLER(UART_RECV_vect)
 {
 	uint8_t c;
+	uint8_t status;
+	uint8_t length;
 
+	// error flags belong to the char in UDR, read them first
+	status = inb(USR);
 	// get received char
 	c = inb(UDR);
 
+	uartStats.rxBytes++;
+	if(status & (BV(FE)|BV(DOR)|BV(UPE)))
+	{
+		if(status & BV(FE))
+			uartStats.rxFrameError++;
+		if(status & BV(DOR))
+			uartStats.rxOverrun++;
+		if(status & BV(UPE))
+			uartStats.rxParityError++;
+	}
+
 	// if there's a user function to handle this receive event
 	if(UartRxFunc)
 	{
@@ -273,11 +367,32 @@ UART_INTERRUPT_HANDLER(UART_RECV_vect)
 		// otherwise do default processing
 		// put received char in buffer
 		// check if there's space
-		if( !bufferAddToEnd(&uartRxBuffer, c) )
+		if( !ringAddToEnd(&uartRxBuffer, c) )
 		{
 			// no space in buffer
 			// count overflow
-			uartRxOverflow++;
+			uartStats.rxOverflow++;
+		}
+		else
+		{
+			// highest occupancy tells whether the buffer is big enough
+			length = ringGetDataLength(&uartRxBuffer);
+			if(length > uartStats.rxPeak)
+				uartStats.rxPeak = length;
+
+			if(c == UART_RX_STAMP_CHAR)
+			{
+				// remember when the message started, the main loop may
+				// only get to it much later
+				uartRxStamp[uartRxStampCount & (UART_RX_STAMPS-1)] = systemTimeGetMilliseconds();
+				uartRxStampCount++;
+			}
+			else if(c == '\n')
+			{
+				// a complete line is waiting, the main loop has work to do
+				uartRxLineEnd[uartRxLineCount & (UART_RX_LINES-1)] = uartRxBuffer.head;
+				uartRxLineCount++;
+			}
 		}
 	}
 }
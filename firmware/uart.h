@@ -56,7 +56,7 @@
 #define UART_H
 
 #include "global.h"
-#include "buffer.h"
+#include "ring.h"
 
 //! Default uart baud rate.
 /// This is the default speed after a uartInit() command,
@@ -78,6 +78,23 @@
 #define UART_RX_BUFFER_SIZE		0x0040
 #endif
 
+//! Number of receive timestamps kept, must be a power of two.
+/// The arrival time of every UART_RX_STAMP_CHAR is recorded
+/// by the receive interrupt, see uartGetRxStamp().
+#define UART_RX_STAMPS			4
+
+#ifndef UART_RX_STAMP_CHAR
+//! Received byte whose arrival time is recorded, the start of a message.
+/// '$' starts an NMEA sentence, a UBX build overrides it with the
+/// first sync char in global.h.
+#define UART_RX_STAMP_CHAR		'$'
+#endif
+
+//! Number of line ends kept, must be a power of two.
+/// The receive interrupt records where every '\n' ends a line,
+/// see uartGetRxLine().
+#define UART_RX_LINES			8
+
 // define this key if you wish to use
 // external RAM for the	UART buffers
 //#define UART_BUFFER_EXTERNAL_RAM
@@ -87,6 +104,20 @@
 #define UART_RX_BUFFER_ADDR	0x1100
 #endif
 
+//! UART health counters, updated by the interrupt handlers
+typedef struct struct_UartStatistics
+{
+	uint32_t rxBytes;			///< bytes received
+	uint16_t rxOverflow;		///< bytes lost because the receive buffer was full
+	uint16_t rxOverrun;			///< bytes lost in hardware, the interrupt came too late
+	uint16_t rxFrameError;		///< bytes received without a valid stop bit
+	uint16_t rxParityError;		///< bytes received with a parity error
+	uint8_t rxPeak;				///< highest receive buffer occupancy
+	uint32_t txBytes;			///< bytes transmitted
+	uint16_t txOverflow;		///< bytes dropped because the transmit buffer was full
+	uint8_t txPeak;				///< highest transmit buffer occupancy
+} UartStatsType;
+
 //! Type of interrupt handler to use for uart interrupts.
 /// Value may be SIGNAL or INTERRUPT.
 /// \warning Do not change unless you know what you're doing.
@@ -123,6 +154,10 @@
 #if defined(__AVR_ATmega32U4__)
 #define UDR					UDR1
 #define UCR 				UCSR1B
+#define USR					UCSR1A
+#define FE					FE1
+#define DOR					DOR1
+#define UPE					UPE1
 #define RXCIE 				RXCIE1
 #define TXCIE 				TXCIE1
 #define RXC 				RXC1
@@ -193,11 +228,11 @@ void uartSetBaudRate(uint32_t baudrate);
 
 //! Returns pointer to the receive buffer structure.
 ///
-cBuffer* uartGetRxBuffer(void);
+ringBuffer* uartGetRxBuffer(void);
 
 //! Returns pointer to the transmit buffer structure.
 ///
-cBuffer* uartGetTxBuffer(void);
+ringBuffer* uartGetTxBuffer(void);
 
 //! Sends a single byte over the uart.
 /// \note This function waits for the uart to be ready,
@@ -228,6 +263,29 @@ uint8_t uartReceiveBufferIsEmpty(void);
 ///
 void uartFlushReceiveBuffer(void);
 
+uint16_t uartGetRxOverflow(void);
+
+//! Copies the health counters to stats.
+void uartGetStats(UartStatsType* stats);
+
+//! Clears the health counters.
+void uartResetStats(void);
+
+uint8_t uartTransmitIsIdle(void);
+
+//! Gets the arrival time of a UART_RX_STAMP_CHAR in the receive buffer.
+/// \param count	number of them received before the requested one
+///	\param millis	system time in milliseconds it was received at
+/// Returns FALSE if the timestamp was already overwritten.
+uint8_t uartGetRxStamp(uint8_t count, uint32_t* millis);
+
+//! Gets the end of a line in the receive buffer.
+/// \param count	number of lines received before the requested one
+///	\param end		receive buffer head count just after the line's '\n'
+/// Returns the number of lines received after count others, *end is
+/// only valid if that is between 1 and UART_RX_LINES.
+uint8_t uartGetRxLine(uint8_t count, uint8_t* end);
+
 //! Add byte to end of uart Tx buffer.
 ///	Returns TRUE if successful, FALSE if failed (no room left in buffer).
 uint8_t uartAddToTxBuffer(uint8_t data);
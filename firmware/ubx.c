@@ -0,0 +1,351 @@
+/*! \file ubx.c \brief UBX protocol function library. */
+//*****************************************************************************
+//
+// File Name	: 'ubx.c'
+// Title		: UBX (u-blox binary) protocol function library
+// Target MCU	: Atmel AVR Series
+// Editor Tabs	: 4
+//
+// This code is distributed under the GNU Public License
+//		which can be found at http://www.gnu.org/licenses/gpl.txt
+//
+//*****************************************************************************
+
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+
+#include "global.h"
+#include "ring.h"
+#include "uart.h"
+#include "systemtime.h"
+#include "gps.h"
+
+#include "ubx.h"
+
+
+// Program ROM constants
+
+// CFG-PRT: UBX only output on the receiver UART, 8N1, UBX+NMEA input
+const uint8_t UbxCfgPrt[] PROGMEM =
+{
+	UBX_PORT_ID, 0x00,			// portID, reserved
+	0x00, 0x00,					// txReady
+	0xD0, 0x08, 0x00, 0x00,		// mode: 8 data bits, no parity, 1 stop bit
+	0x80, 0x25, 0x00, 0x00,		// baudRate: replaced by the autobaud rate
+	0x03, 0x00,					// inProtoMask: UBX, NMEA
+	0x01, 0x00,					// outProtoMask: UBX
+	0x00, 0x00,					// flags
+	0x00, 0x00					// reserved
+};
+
+// CFG-MSG: send NAV-TIMEUTC once per navigation solution on the current port
+const uint8_t UbxCfgMsgTimeUtc[] PROGMEM =
+{
+	UBX_CLASS_NAV, UBX_NAV_TIMEUTC, 0x01
+};
+
+// CFG-PRT poll of the receiver UART, answered in UBX even with UBX output off
+const uint8_t UbxPollPrt[] PROGMEM =
+{
+	UBX_PORT_ID
+};
+
+// Global variables
+extern GpsInfoType GpsInfo;
+UbxParserType UbxParser;
+uint32_t UbxConfigMillis;
+uint8_t UbxSendCkA;
+uint8_t UbxSendCkB;
+
+void ubxInit(void)
+{
+	UbxParser.state = UBX_STATE_SYNC1;
+	UbxParser.starts = 0;
+	GpsInfo.UbxStats.configured = FALSE;
+	// the receiver needs some time to boot, ubxProcess() sends the
+	// configuration as soon as UBX_CONFIG_RETRY_MS have passed
+	UbxConfigMillis = systemTimeGetMilliseconds();
+}
+
+void ubxConfigure(void)
+{
+	uint32_t rate = gpsGetBaud()->rate;
+	uint8_t i;
+
+	// queue all messages first, the interrupt driven transmit
+	// must only be started once
+	ubxSendStart(UBX_CLASS_CFG, UBX_CFG_PRT, sizeof(UbxCfgPrt));
+	for(i=0; i<sizeof(UbxCfgPrt); i++)
+	{
+		// keep the rate the receiver was found at
+		if(i >= UBX_CFG_PRT_BAUD && i < UBX_CFG_PRT_BAUD+4)
+			ubxSendByte(rate>>(8*(i-UBX_CFG_PRT_BAUD)));
+		else
+			ubxSendByte(pgm_read_byte(&UbxCfgPrt[i]));
+	}
+	ubxSendEnd();
+	ubxSendMessage(UBX_CLASS_CFG, UBX_CFG_MSG, UbxCfgMsgTimeUtc, sizeof(UbxCfgMsgTimeUtc));
+	uartSendTxBuffer();
+	UbxConfigMillis = systemTimeGetMilliseconds();
+}
+
+void ubxPollPort(void)
+{
+	ubxSendMessage(UBX_CLASS_CFG, UBX_CFG_PRT, UbxPollPrt, sizeof(UbxPollPrt));
+	uartSendTxBuffer();
+}
+
+void ubxSendMessage(uint8_t msgClass, uint8_t msgId, const uint8_t* payload, uint16_t length)
+{
+	uint16_t i;
+
+	ubxSendStart(msgClass, msgId, length);
+	// payload is stored in program memory
+	for(i=0; i<length; i++)
+		ubxSendByte(pgm_read_byte(&payload[i]));
+	ubxSendEnd();
+}
+
+void ubxSendStart(uint8_t msgClass, uint8_t msgId, uint16_t length)
+{
+	uartAddToTxBuffer(UBX_SYNC1);
+	uartAddToTxBuffer(UBX_SYNC2);
+	// Fletcher checksum over class, id, length and payload
+	UbxSendCkA = 0;
+	UbxSendCkB = 0;
+	ubxSendByte(msgClass);
+	ubxSendByte(msgId);
+	ubxSendByte(length);
+	ubxSendByte(length>>8);
+}
+
+void ubxSendByte(uint8_t c)
+{
+	UbxSendCkA += c;
+	UbxSendCkB += UbxSendCkA;
+	uartAddToTxBuffer(c);
+}
+
+void ubxSendEnd(void)
+{
+	uartAddToTxBuffer(UbxSendCkA);
+	uartAddToTxBuffer(UbxSendCkB);
+}
+
+uint8_t ubxProcess(ringBuffer* rxBuffer)
+{
+	uint8_t foundpacket = UBX_NODATA;
+	ringSpans spans;
+	uint8_t* data;
+	uint8_t span;
+	uint8_t count;
+	uint8_t i = 0;
+
+	// configure only once the rate is known, the port settings keep it
+	if(!GpsInfo.UbxStats.configured && gpsBaudIsLocked() &&
+	   (systemTimeGetMilliseconds() - UbxConfigMillis) >= UBX_CONFIG_RETRY_MS)
+	{
+		ubxConfigure();
+	}
+
+	// take one snapshot of the received data, the bytes in it
+	// are not touched by the receive interrupt anymore
+	ringPeekSpans(rxBuffer, &spans);
+
+	// feed every received byte to the parser exactly once
+	// stop after one complete packet to keep the time per call bounded
+	for(span=0; span<2 && !foundpacket; span++)
+	{
+		data = spans.data[span];
+		count = spans.length[span];
+		while(count--)
+		{
+			i++;
+			if((foundpacket = ubxParseByte(*data++)))
+				break;
+		}
+	}
+
+	// release everything the parser has seen
+	if(i)
+		ringDumpFromFront(rxBuffer, i);
+	return foundpacket;
+}
+
+uint8_t ubxParseByte(uint8_t c)
+{
+	uint32_t stamp;
+
+	if(c == UBX_SYNC1)
+	{
+		// each sync char is seen here exactly once, in the order the
+		// receive interrupt stamped them, payload bytes included
+		if(!uartGetRxStamp(UbxParser.starts++, &stamp))
+			stamp = systemTimeGetMilliseconds();
+		// outside a message it may start the next one
+		if(UbxParser.state <= UBX_STATE_SYNC2)
+			UbxParser.stamp = stamp;
+	}
+
+	// Fletcher checksum covers class, id, length and payload
+	if(UbxParser.state >= UBX_STATE_CLASS && UbxParser.state <= UBX_STATE_PAYLOAD)
+	{
+		UbxParser.ckA += c;
+		UbxParser.ckB += UbxParser.ckA;
+	}
+
+	switch(UbxParser.state)
+	{
+	case UBX_STATE_SYNC1:
+		if(c == UBX_SYNC1)
+			UbxParser.state = UBX_STATE_SYNC2;
+		break;
+	case UBX_STATE_SYNC2:
+		if(c == UBX_SYNC2)
+		{
+			UbxParser.ckA = 0;
+			UbxParser.ckB = 0;
+			UbxParser.state = UBX_STATE_CLASS;
+		}
+		else
+			UbxParser.state = (c == UBX_SYNC1) ? UBX_STATE_SYNC2 : UBX_STATE_SYNC1;
+		break;
+	case UBX_STATE_CLASS:
+		UbxParser.msgClass = c;
+		UbxParser.state = UBX_STATE_ID;
+		break;
+	case UBX_STATE_ID:
+		UbxParser.msgId = c;
+		UbxParser.state = UBX_STATE_LENGTH1;
+		break;
+	case UBX_STATE_LENGTH1:
+		UbxParser.length = c;
+		UbxParser.state = UBX_STATE_LENGTH2;
+		break;
+	case UBX_STATE_LENGTH2:
+		UbxParser.length |= (uint16_t)c<<8;
+		UbxParser.index = 0;
+		UbxParser.state = UbxParser.length ? UBX_STATE_PAYLOAD : UBX_STATE_CK_A;
+		// a corrupted length would swallow the stream for seconds before
+		// the checksum fails, nothing longer than UBX_MAXLENGTH is decoded
+		if(UbxParser.length > UBX_MAXLENGTH)
+		{
+			GpsInfo.UbxStats.badLength++;
+			UbxParser.state = UBX_STATE_SYNC1;
+		}
+		break;
+	case UBX_STATE_PAYLOAD:
+		// keep only the start of the payload, everything we decode is there
+		if(UbxParser.index < UBX_MAXPAYLOAD)
+			UbxParser.payload[UbxParser.index] = c;
+		if(++UbxParser.index >= UbxParser.length)
+			UbxParser.state = UBX_STATE_CK_A;
+		break;
+	case UBX_STATE_CK_A:
+		UbxParser.state = (c == UbxParser.ckA) ? UBX_STATE_CK_B : UBX_STATE_SYNC1;
+		if(UbxParser.state == UBX_STATE_SYNC1)
+			GpsInfo.UbxStats.badChecksum++;
+		break;
+	case UBX_STATE_CK_B:
+		UbxParser.state = UBX_STATE_SYNC1;
+		if(c != UbxParser.ckB)
+		{
+			GpsInfo.UbxStats.badChecksum++;
+			break;
+		}
+		GpsInfo.UbxStats.accepted++;
+		// have a valid packet, decode it
+		if(UbxParser.msgClass == UBX_CLASS_NAV)
+		{
+			// navigation data arrives, so the configuration was applied
+			GpsInfo.UbxStats.configured = TRUE;
+			if(UbxParser.msgId == UBX_NAV_TIMEUTC && UbxParser.length == 20)
+			{
+				ubxProcessTIMEUTC();
+				return UBX_TIMEUTC;
+			}
+			if(UbxParser.msgId == UBX_NAV_PVT && UbxParser.length >= UBX_MAXPAYLOAD)
+			{
+				ubxProcessPVT();
+				return UBX_PVT;
+			}
+		}
+		return UBX_UNKNOWN;
+	default:
+		UbxParser.state = UBX_STATE_SYNC1;
+		break;
+	}
+	return UBX_NODATA;
+}
+
+uint16_t ubxGetU16(uint8_t offset)
+{
+	// UBX is little endian
+	return UbxParser.payload[offset] | ((uint16_t)UbxParser.payload[offset+1]<<8);
+}
+
+uint32_t ubxGetU32(uint8_t offset)
+{
+	return ubxGetU16(offset) | ((uint32_t)ubxGetU16(offset+2)<<16);
+}
+
+uint8_t ubxDecodeTime(uint8_t offset, GpsTimeType* time)
+{
+	// year [U2], month, day, hour, min, sec [U1] in a row
+	uint16_t year = ubxGetU16(offset);
+
+	if(year < 2000 || year > 2099)
+		return FALSE;
+	time->year = year - 2000;
+	time->month = UbxParser.payload[offset+2];
+	time->day = UbxParser.payload[offset+3];
+	time->hour = UbxParser.payload[offset+4];
+	time->minute = UbxParser.payload[offset+5];
+	time->second = UbxParser.payload[offset+6];
+	return (time->month >= 1 && time->month <= 12 && time->day >= 1 && time->day <= 31 &&
+			time->hour <= 23 && time->minute <= 59 && time->second <= 60);
+}
+
+void ubxSetTime(GpsTimeType* time, int32_t nano, uint32_t accuracy)
+{
+	// the seconds are rounded, a negative fraction means the solution
+	// lies just before them, count that as the start of the second
+	time->millis = (nano > 0) ? nano / 1000000L : 0;
+
+	GpsInfo.UtcTime = *time;
+	GpsInfo.UtcNano = nano;
+	GpsInfo.UtcAccuracy = accuracy;
+	// the time belongs to the moment the message started arriving,
+	// not to the moment it was parsed
+	GpsInfo.validTimeReceivedMillis = UbxParser.stamp;
+}
+
+void ubxProcessTIMEUTC(void)
+{
+	GpsTimeType time;
+
+	// iTOW [U4], tAcc [U4], nano [I4], year [U2], month, day, hour, min, sec, valid
+	GpsInfo.UtcValid = UbxParser.payload[19];
+	if((GpsInfo.UtcValid & UBX_VALID_MASK) != UBX_VALID_MASK)
+		return;
+	if(!ubxDecodeTime(12, &time))
+		return;
+
+	ubxSetTime(&time, (int32_t)ubxGetU32(8), ubxGetU32(4));
+}
+
+void ubxProcessPVT(void)
+{
+	GpsTimeType time;
+
+	// iTOW [U4], year [U2], month, day, hour, min, sec, valid, tAcc [U4], nano [I4],
+	// fixType, flags, flags2, numSV, ...
+	GpsInfo.UtcValid = UbxParser.payload[11];
+	GpsInfo.numSVs = UbxParser.payload[23];
+	if((GpsInfo.UtcValid & UBX_VALID_MASK) != UBX_VALID_MASK)
+		return;
+	if(!ubxDecodeTime(4, &time))
+		return;
+
+	ubxSetTime(&time, (int32_t)ubxGetU32(16), ubxGetU32(12));
+}
@@ -0,0 +1,106 @@
+/*! \file ubx.h \brief UBX protocol function library. */
+//*****************************************************************************
+//
+// File Name	: 'ubx.h'
+// Title		: UBX (u-blox binary) protocol function library
+// Target MCU	: Atmel AVR Series
+// Editor Tabs	: 4
+//
+///	\ingroup driver_hw
+/// \defgroup ubx UBX Packet Interface for u-blox GPS Receivers (ubx.c)
+/// \code #include "ubx.h" \endcode
+/// \par Overview
+///		This library configures a u-blox receiver to send binary UBX
+/// navigation messages instead of NMEA text, parses the UBX stream and
+/// stores the time solution in the gps.c library.  It replaces nmea.c
+/// when GPS_PROTOCOL = ubx is selected in the Makefile.
+//
+// This code is distributed under the GNU Public License
+//		which can be found at http://www.gnu.org/licenses/gpl.txt
+//
+//*****************************************************************************
+
+#ifndef UBX_H
+#define UBX_H
+
+#include "global.h"
+#include "ring.h"
+#include "gps.h"
+
+// constants/macros/typdefs
+#define UBX_SYNC1			0xB5
+#define UBX_SYNC2			0x62
+#define UBX_MAXPAYLOAD		24		///< payload bytes kept, the rest is only checksummed
+#define UBX_MAXLENGTH		92		///< longest payload accepted, NAV-PVT is the longest decoded
+#define UBX_PORT_ID			1		///< receiver port the AVR is connected to (UART1)
+#define UBX_CONFIG_RETRY_MS	1000	///< resend the configuration until navigation data arrives
+#define UBX_CFG_PRT_BAUD	8		///< offset of the baud rate in the CFG-PRT payload
+
+// Message classes and IDs
+#define UBX_CLASS_NAV		0x01
+#define UBX_CLASS_ACK		0x05
+#define UBX_CLASS_CFG		0x06
+#define UBX_NAV_PVT			0x07
+#define UBX_NAV_TIMEUTC		0x21
+#define UBX_ACK_NAK			0x00
+#define UBX_ACK_ACK			0x01
+#define UBX_CFG_PRT			0x00
+#define UBX_CFG_MSG			0x01
+
+// NAV-TIMEUTC valid flags (NAV-PVT uses the same bits for validDate,
+// validTime and fullyResolved)
+#define UBX_VALID_TOW		0x01
+#define UBX_VALID_WKN		0x02
+#define UBX_VALID_UTC		0x04
+#define UBX_VALID_MASK		(UBX_VALID_TOW|UBX_VALID_WKN|UBX_VALID_UTC)
+
+// Message Codes
+#define UBX_NODATA			0	// No data. Packet not available, bad, or not decoded
+#define UBX_TIMEUTC			1	// UTC time solution
+#define UBX_PVT				2	// Navigation position velocity time solution
+#define UBX_UNKNOWN			0xFF// Packet received but not decoded
+
+// Parser states
+#define UBX_STATE_SYNC1		0	// waiting for first sync char
+#define UBX_STATE_SYNC2		1	// waiting for second sync char
+#define UBX_STATE_CLASS		2
+#define UBX_STATE_ID		3
+#define UBX_STATE_LENGTH1	4
+#define UBX_STATE_LENGTH2	5
+#define UBX_STATE_PAYLOAD	6
+#define UBX_STATE_CK_A		7
+#define UBX_STATE_CK_B		8
+
+//! Incremental UBX parser state, survives between ubxProcess() calls
+typedef struct struct_UbxParser
+{
+	uint8_t state;					///< current parser state (UBX_STATE_*)
+	uint8_t msgClass;				///< class of the message being received
+	uint8_t msgId;					///< id of the message being received
+	uint16_t length;				///< payload length from the header
+	uint16_t index;					///< number of payload bytes received
+	uint8_t ckA;					///< running Fletcher checksum, first byte
+	uint8_t ckB;					///< running Fletcher checksum, second byte
+	uint8_t starts;					///< sync chars seen, counts the receive stamps
+	uint32_t stamp;					///< system time the message started arriving
+	uint8_t payload[UBX_MAXPAYLOAD];	///< first bytes of the payload
+} UbxParserType;
+
+// functions
+void ubxInit(void);
+void ubxConfigure(void);
+void ubxPollPort(void);
+void ubxSendMessage(uint8_t msgClass, uint8_t msgId, const uint8_t* payload, uint16_t length);
+void ubxSendStart(uint8_t msgClass, uint8_t msgId, uint16_t length);
+void ubxSendByte(uint8_t c);
+void ubxSendEnd(void);
+uint8_t ubxProcess(ringBuffer* rxBuffer);
+uint8_t ubxParseByte(uint8_t c);
+uint16_t ubxGetU16(uint8_t offset);
+uint32_t ubxGetU32(uint8_t offset);
+uint8_t ubxDecodeTime(uint8_t offset, GpsTimeType* time);
+void ubxSetTime(GpsTimeType* time, int32_t nano, uint32_t accuracy);
+void ubxProcessTIMEUTC(void);
+void ubxProcessPVT(void);
+
+#endif